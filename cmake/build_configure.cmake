@@ -33,11 +33,14 @@ get_property(GENERATOR_IS_MULTI_CONFIG GLOBAL PROPERTY GENERATOR_IS_MULTI_CONFIG
 
 set(EXECUTABLE_OUTPUT_DIR ${CMAKE_BINARY_DIR}/bin)
 set(TEST_EXECUTABLE_OUTPUT_DIR ${EXECUTABLE_OUTPUT_DIR}/tests)
+set(BENCHMARK_EXECUTABLE_OUTPUT_DIR ${EXECUTABLE_OUTPUT_DIR}/benchmarks)
 set(LIBRARY_OUTPUT_DIR ${CMAKE_BINARY_DIR}/lib)
 
 if(GENERATOR_IS_MULTI_CONFIG AND NOT WIN32)
   set(EXECUTABLE_OUTPUT_DIR ${EXECUTABLE_OUTPUT_DIR}/$<CONFIG>)
   set(TEST_EXECUTABLE_OUTPUT_DIR ${TEST_EXECUTABLE_OUTPUT_DIR}/$<CONFIG>)
+  set(BENCHMARK_EXECUTABLE_OUTPUT_DIR
+      ${BENCHMARK_EXECUTABLE_OUTPUT_DIR}/$<CONFIG>)
   set(LIBRARY_OUTPUT_DIR ${LIBRARY_OUTPUT_DIR}/$<CONFIG>)
 endif()
 
@@ -63,6 +66,11 @@ enable_testing()
 
 include(target_test)
 
+################################################################################
+# Performance benchmarks.
+
+include(target_benchmark)
+
 ################################################################################
 # Platform specific configuration.
 
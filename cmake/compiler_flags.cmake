@@ -189,8 +189,8 @@ endfunction()
 function(disable_target_exceptions TARGET)
   if (MSVC)
     # TODO: Needs implementation
-    # target_compile_options(tl_${TEST_NAME}_noexc_test PRIVATE /EHsc-)
+    # target_compile_options(${TARGET} PRIVATE /EHsc-)
   else()
-    target_compile_options(tl_${TEST_NAME}_noexc_test PRIVATE -fno-exceptions)
+    target_compile_options(${TARGET} PRIVATE -fno-exceptions)
   endif()
 endfunction()
@@ -0,0 +1,135 @@
+# Copyright (c) 2026 tiny lib authors
+#
+# SPDX-License-Identifier: MIT-0
+
+# Utility functions for defining performance benchmark targets.
+
+find_program(TL_SIZE_EXECUTABLE NAMES size llvm-size)
+
+# Define benchmark target.
+#
+# The target is specified by the name of a benchmark (without "_benchmark"
+# suffix) and the file name it is compiled from. The "_benchmark" suffix for the
+# target will be added automatically.
+#
+# Extra definitions and compiler options are controlled via the DEFINITIONS
+# and COMPILE_OPTIONS flags.
+#
+# It is possible to pass additional include directories and linking libraries
+# by specifying "INCLUDES" and "LIBRARIES" arguments.
+#
+# Benchmarks are not registered as tests: they are to be run manually from the
+# benchmarks directory inside of the binary directory.
+#
+# Example:
+#
+#   tl_benchmark(static_vector benchmark/tl_static_vector_benchmark.cc
+#                LIBRARIES tl_container)
+function(tl_benchmark BENCHMARK_NAME FILENAME)
+  if(NOT WITH_BENCHMARKS)
+    return()
+  endif()
+
+  cmake_parse_arguments(
+    BENCHMARK
+    ""
+    ""
+    "COMPILE_OPTIONS;DEFINITIONS;INCLUDES;LIBRARIES"
+    ${ARGN}
+  )
+
+  set(target_name "tl_${BENCHMARK_NAME}_benchmark")
+
+  add_executable(${target_name} ${FILENAME})
+
+  target_include_directories(${target_name} SYSTEM PRIVATE
+    ${BENCHMARK_INCLUDES}
+  )
+
+  target_compile_options(${target_name} PRIVATE ${BENCHMARK_COMPILE_OPTIONS})
+  target_compile_definitions(${target_name} PRIVATE ${BENCHMARK_DEFINITIONS})
+
+  target_link_libraries(${target_name}
+    ${BENCHMARK_LIBRARIES}
+    tl_benchmark_main
+  )
+
+  target_set_output_directory(${target_name} ${BENCHMARK_EXECUTABLE_OUTPUT_DIR})
+endfunction()
+
+# Define a pair of executables which are used to measure the code size of the
+# given source file: one compiled with the default configuration, and one with
+# exceptions disabled. The executables are optimized for size.
+#
+# The targets are named "tl_${PROBE_NAME}_size_probe" and
+# "tl_${PROBE_NAME}_noexc_size_probe".
+#
+# Accepts the same COMPILE_OPTIONS, DEFINITIONS, INCLUDES, and LIBRARIES
+# arguments as the tl_benchmark().
+function(tl_size_probe PROBE_NAME FILENAME)
+  if(NOT WITH_BENCHMARKS)
+    return()
+  endif()
+
+  cmake_parse_arguments(
+    PROBE
+    ""
+    ""
+    "COMPILE_OPTIONS;DEFINITIONS;INCLUDES;LIBRARIES"
+    ${ARGN}
+  )
+
+  foreach(suffix "" "_noexc")
+    set(target_name "tl_${PROBE_NAME}${suffix}_size_probe")
+
+    add_executable(${target_name} ${FILENAME})
+
+    target_include_directories(${target_name} SYSTEM PRIVATE
+      ${PROBE_INCLUDES}
+    )
+
+    if(NOT MSVC)
+      target_compile_options(${target_name} PRIVATE -Os)
+    endif()
+    target_compile_options(${target_name} PRIVATE ${PROBE_COMPILE_OPTIONS})
+    target_compile_definitions(${target_name} PRIVATE ${PROBE_DEFINITIONS})
+
+    target_link_libraries(${target_name} ${PROBE_LIBRARIES})
+
+    target_set_output_directory(
+        ${target_name} ${BENCHMARK_EXECUTABLE_OUTPUT_DIR})
+  endforeach()
+
+  disable_target_exceptions(tl_${PROBE_NAME}_noexc_size_probe)
+endfunction()
+
+# Define a target which prints sizes of sections of the given size probes.
+#
+# The probes are specified by their names as passed to the tl_size_probe().
+# The target is only defined when the `size` utility is available.
+#
+# Example:
+#
+#   tl_size_report(container_size_report baseline std_vector static_vector)
+function(tl_size_report REPORT_NAME)
+  if(NOT WITH_BENCHMARKS OR NOT TL_SIZE_EXECUTABLE)
+    return()
+  endif()
+
+  set(probe_files)
+  set(probe_targets)
+  foreach(probe ${ARGN})
+    foreach(suffix "" "_noexc")
+      set(target_name "tl_${probe}${suffix}_size_probe")
+      list(APPEND probe_files $<TARGET_FILE:${target_name}>)
+      list(APPEND probe_targets ${target_name})
+    endforeach()
+  endforeach()
+
+  add_custom_target(tl_${REPORT_NAME}
+    COMMAND ${TL_SIZE_EXECUTABLE} ${probe_files}
+    DEPENDS ${probe_targets}
+    COMMENT "Code size of ${REPORT_NAME} probes"
+    VERBATIM
+  )
+endfunction()
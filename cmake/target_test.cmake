@@ -97,5 +97,5 @@ function(tl_test TEST_NAME FILENAME)
   tl_single_test(${TEST_NAME} ${FILENAME} ${ARGN})
 
   tl_single_test(${TEST_NAME}_noexc ${FILENAME} ${ARGN})
-  disable_target_exceptions(tl_${TEST_NAME}_noexc_test COMPILE_OPTIONS)
+  disable_target_exceptions(tl_${TEST_NAME}_noexc_test)
 endfunction()
@@ -0,0 +1,76 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A minimal timing harness for the performance benchmarks.
+//
+// Benchmark is a function which runs the measured operation the given number of
+// times. The harness calibrates the number of iterations so that a single run
+// takes a measurable amount of time, repeats the run several times, and reports
+// the fastest time per iteration.
+//
+// Benchmarks are registered at the static initialization time:
+//
+//   static void BM_PushBack(const std::size_t num_iterations) {
+//     for (std::size_t i = 0; i < num_iterations; ++i) {
+//       ...
+//       benchmark::DoNotOptimize(vector);
+//     }
+//   }
+//   TL_BENCHMARK(BM_PushBack);
+//
+// The main() function is provided by the tl_benchmark_main library. It accepts
+// an optional substring as an argument, and only runs benchmarks whose name
+// contains it.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace tiny_lib::benchmark {
+
+// Function which runs the measured operation num_iterations times.
+using BenchmarkFunction = void (*)(std::size_t num_iterations);
+
+// Register benchmark with the given name.
+// Always returns true, which allows to register benchmarks from initializers
+// of static variables.
+auto RegisterBenchmark(std::string name, BenchmarkFunction function) -> bool;
+
+// Run all registered benchmarks whose name contains the filter substring, and
+// print results to the standard output.
+void RunBenchmarks(const std::string& filter);
+
+// Prevent the compiler from optimizing out computation of the value, and from
+// assuming anything about its content.
+template <class T>
+inline void DoNotOptimize(T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  const void* volatile sink = &value;
+  (void)sink;
+#endif
+}
+
+// Force all pending writes to the memory to be observable.
+inline void ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+}  // namespace tiny_lib::benchmark
+
+#define TL_BENCHMARK_CONCAT_HELPER(a, b) a##b
+#define TL_BENCHMARK_CONCAT(a, b) TL_BENCHMARK_CONCAT_HELPER(a, b)
+
+// Register benchmark function under its own name.
+#define TL_BENCHMARK(function) TL_BENCHMARK_NAMED(#function, function)
+
+// Register benchmark function under the given name.
+#define TL_BENCHMARK_NAMED(name, function)                                     \
+  [[maybe_unused]] static const bool TL_BENCHMARK_CONCAT(                      \
+      tl_benchmark_registered_, __LINE__) =                                    \
+      ::tiny_lib::benchmark::RegisterBenchmark(name, function)
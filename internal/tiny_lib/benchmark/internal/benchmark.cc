@@ -0,0 +1,100 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tiny_lib/benchmark/benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+namespace tiny_lib::benchmark {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The minimum duration of a single run of a benchmark.
+constexpr std::chrono::nanoseconds kMinRunTime = std::chrono::milliseconds(20);
+
+// The number of runs of a benchmark. The fastest run is reported.
+constexpr int kNumRepetitions = 5;
+
+struct Benchmark {
+  std::string name;
+  BenchmarkFunction function;
+};
+
+auto GetRegistry() -> std::vector<Benchmark>& {
+  static std::vector<Benchmark> registry;
+  return registry;
+}
+
+auto TimeRun(const BenchmarkFunction function, const std::size_t num_iterations)
+    -> std::chrono::nanoseconds {
+  const Clock::time_point start = Clock::now();
+  function(num_iterations);
+  return Clock::now() - start;
+}
+
+// Find the number of iterations for which a run takes at least kMinRunTime.
+auto CalibrateNumIterations(const BenchmarkFunction function) -> std::size_t {
+  std::size_t num_iterations = 1;
+  while (true) {
+    const std::chrono::nanoseconds time = TimeRun(function, num_iterations);
+    if (time >= kMinRunTime) {
+      return num_iterations;
+    }
+
+    // Aim slightly above the minimum time to avoid an extra calibration step,
+    // but never grow the number of iterations too aggressively since the first
+    // runs are affected by cold caches.
+    std::size_t multiplier = 10;
+    if (time.count() > 0) {
+      const double ratio = 1.4 * double(kMinRunTime.count()) / time.count();
+      multiplier = std::clamp<std::size_t>(std::size_t(ratio), 2, 10);
+    }
+    num_iterations *= multiplier;
+  }
+}
+
+}  // namespace
+
+auto RegisterBenchmark(std::string name, const BenchmarkFunction function)
+    -> bool {
+  GetRegistry().push_back({std::move(name), function});
+  return true;
+}
+
+void RunBenchmarks(const std::string& filter) {
+  std::printf("%-56s %12s %14s\n", "Benchmark", "Iterations", "Time");
+  std::printf("%s\n", std::string(56 + 1 + 12 + 1 + 14, '-').c_str());
+
+  for (const Benchmark& benchmark : GetRegistry()) {
+    if (benchmark.name.find(filter) == std::string::npos) {
+      continue;
+    }
+
+    const std::size_t num_iterations =
+        CalibrateNumIterations(benchmark.function);
+
+    std::chrono::nanoseconds best_time = std::chrono::nanoseconds::max();
+    for (int i = 0; i < kNumRepetitions; ++i) {
+      best_time =
+          std::min(best_time, TimeRun(benchmark.function, num_iterations));
+    }
+
+    const double ns_per_iteration =
+        double(best_time.count()) / double(num_iterations);
+
+    std::printf("%-56s %12zu %11.1f ns\n",
+                benchmark.name.c_str(),
+                num_iterations,
+                ns_per_iteration);
+    std::fflush(stdout);
+  }
+}
+
+}  // namespace tiny_lib::benchmark
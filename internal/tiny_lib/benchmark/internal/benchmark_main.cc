@@ -0,0 +1,13 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include <string>
+
+#include "tiny_lib/benchmark/benchmark.h"
+
+auto main(int argc, char** argv) -> int {
+  const std::string filter = argc > 1 ? argv[1] : "";
+  tiny_lib::benchmark::RunBenchmarks(filter);
+  return 0;
+}
@@ -19,6 +19,28 @@ static_assert(_TL_BUILD_CONFIG_CAN_USE(FLAG_EMPTY));
 static_assert(!_TL_BUILD_CONFIG_CAN_USE(FLAG_ZERO));
 static_assert(_TL_BUILD_CONFIG_CAN_USE(FLAG_ONE));
 
+// The instruction set symbols are defined on all CPU families, and imply the
+// instruction sets they extend.
+#if ISA_CPU_X86_AVX2 || ISA_CPU_X86_FMA || ISA_CPU_X86_F16C
+static_assert(ISA_CPU_X86_AVX);
+#endif
+#if ISA_CPU_X86_AVX512DQ || ISA_CPU_X86_AVX512BW || ISA_CPU_X86_AVX512VL ||    \
+    ISA_CPU_X86_AVX512VNNI
+static_assert(ISA_CPU_X86_AVX512F);
+#endif
+#if ISA_CPU_X86_AVX512F
+static_assert(ISA_CPU_X86_AVX2);
+#endif
+#if ISA_CPU_X86_SSE4_2
+static_assert(ISA_CPU_X86_SSE4_1 && ISA_CPU_X86_SSSE3);
+#endif
+#if ISA_CPU_X86_BMI2 || ISA_CPU_X86_POPCNT
+static_assert(ARCH_CPU_X86_FAMILY);
+#endif
+#if ISA_CPU_ARM_SVE || ISA_CPU_ARM_DOTPROD
+static_assert(ARCH_CPU_ARM_FAMILY);
+#endif
+
 namespace tl {
 
 TEST(BuildConfig, Endian) {
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_cpu_features.h"
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::cpu_features {
+
+namespace {
+
+auto GetScalar() -> int { return 1; }
+auto GetSSE2() -> int { return 2; }
+auto GetAVX2() -> int { return 3; }
+
+#if ARCH_CPU_X86_FAMILY
+TL_CPU_FEATURES_TARGET("avx2")
+auto AddAVX2(const int a, const int b) -> int { return a + b; }
+#endif
+
+auto SelectGet(const CPUFeatures& features) -> int (*)() {
+  return SelectImplementation(
+      features,
+      {
+          {[](const CPUFeatures& f) { return f.avx2; }, GetAVX2},
+          {[](const CPUFeatures& f) { return f.sse2; }, GetSSE2},
+      },
+      GetScalar);
+}
+
+}  // namespace
+
+TEST(tl_cpu_features, Detect) {
+  const CPUFeatures& features = GetCPUFeatures();
+
+  // The result is cached.
+  EXPECT_EQ(&GetCPUFeatures(), &features);
+
+  // The features which the compiler is allowed to use are supported by the CPU
+  // the test runs on.
+#if ARCH_CPU_X86_FAMILY
+  EXPECT_EQ(features.sse2, bool(ISA_CPU_X86_SSE2));
+#  if ISA_CPU_X86_AVX2
+  EXPECT_TRUE(features.avx2);
+#  endif
+#  if ISA_CPU_X86_FMA
+  EXPECT_TRUE(features.fma);
+#  endif
+#  if ISA_CPU_X86_BMI2
+  EXPECT_TRUE(features.bmi2);
+#  endif
+#  if ISA_CPU_X86_AVX512BW
+  EXPECT_TRUE(features.avx512bw);
+#  endif
+  EXPECT_FALSE(features.neon);
+#elif ARCH_CPU_ARM_FAMILY
+#  if ISA_CPU_ARM_NEON
+  EXPECT_TRUE(features.neon);
+#  endif
+#  if ISA_CPU_ARM_SVE
+  EXPECT_TRUE(features.sve);
+#  endif
+  EXPECT_FALSE(features.sse2);
+#endif
+
+  // Features which depend on other features.
+  if (features.avx2 || features.fma || features.f16c) {
+    EXPECT_TRUE(features.avx);
+  }
+  if (features.avx512bw || features.avx512vl || features.avx512vnni) {
+    EXPECT_TRUE(features.avx512f);
+  }
+}
+
+TEST(tl_cpu_features, SelectImplementation) {
+  CPUFeatures features;
+  EXPECT_EQ(SelectGet(features)(), 1);
+
+  features.sse2 = true;
+  EXPECT_EQ(SelectGet(features)(), 2);
+
+  features.avx2 = true;
+  EXPECT_EQ(SelectGet(features)(), 3);
+
+  features.sse2 = false;
+  EXPECT_EQ(SelectGet(features)(), 3);
+
+  // Selection for the CPU the test runs on.
+  static const auto kGet = SelectImplementation(
+      {
+          {[](const CPUFeatures& f) { return f.avx2; }, GetAVX2},
+          {[](const CPUFeatures& f) { return f.sse2; }, GetSSE2},
+      },
+      GetScalar);
+  EXPECT_EQ(kGet, SelectGet(GetCPUFeatures()));
+}
+
+TEST(tl_cpu_features, SIMDWidth) {
+  CPUFeatures features;
+  EXPECT_EQ(GetSIMDWidth(features), sizeof(void*));
+
+  features.sse2 = true;
+  EXPECT_EQ(GetSIMDWidth(features), 16);
+  features.avx = true;
+  EXPECT_EQ(GetSIMDWidth(features), 32);
+  features.avx512f = true;
+  EXPECT_EQ(GetSIMDWidth(features), 64);
+
+  features = CPUFeatures();
+  features.neon = true;
+  EXPECT_EQ(GetSIMDWidth(features), 16);
+  features.sve = true;
+  features.sve_vector_size = 16;
+  EXPECT_EQ(GetSIMDWidth(features), 16);
+  features.sve_vector_size = 32;
+  EXPECT_EQ(GetSIMDWidth(features), 32);
+
+  static_assert(GetSIMDWidth(CPUFeatures()) == sizeof(void*));
+
+  // The CPU supports the vector registers the compiler is allowed to use.
+  EXPECT_GE(GetSIMDWidth(), kCompileTimeSIMDWidth);
+}
+
+#if ARCH_CPU_X86_FAMILY
+TEST(tl_cpu_features, Target) {
+  // The kernel compiled for a newer instruction set is only called when the
+  // CPU supports it.
+  if (GetCPUFeatures().avx2) {
+    EXPECT_EQ(AddAVX2(2, 3), 5);
+  }
+}
+#endif
+
+}  // namespace tiny_lib::cpu_features
@@ -55,10 +55,19 @@
 // definition (otherwise it will just become too much of copy-paste to show all
 // of the available permutations).
 //
+// The instruction sets which the compiler is allowed to use are defined as
+// `ISA_CPU_<FAMILY>_<NAME>` symbols, for example ISA_CPU_X86_AVX2 or
+// ISA_CPU_ARM_SVE. All of them are defined on every CPU family, to 0 for the
+// instruction sets of other families. The tl_cpu_features.h detects the
+// instruction sets supported by the CPU at run time.
+//
 //
 // Version history
 // ===============
 //
+//   0.0.3-alpha    (19 Oct 2026)    Detect AVX-512, BMI, F16C, POPCNT, SSSE3,
+//                                   SSE4.2, SVE and dot product instructions.
+//                                   Define x86 ISA symbols on all CPUs.
 //   0.0.2-alpha    ( 2 Mar 2024)    Correct spelling in comments.
 //   0.0.1-alpha    (28 Dec 2023)    First public release.
 
@@ -454,6 +463,13 @@
 #    define ISA_CPU_X86_SSE3 0
 #  endif
 
+// SSSE 3.
+#  if defined(__SSSE3__) && _TL_BUILD_CONFIG_CAN_USE(__SSSE3__)
+#    define ISA_CPU_X86_SSSE3 1
+#  else
+#    define ISA_CPU_X86_SSSE3 0
+#  endif
+
 // SSE 4.1.
 #  if defined(__SSE4_1__) && _TL_BUILD_CONFIG_CAN_USE(__SSE4_1__)
 #    define ISA_CPU_X86_SSE4_1 1
@@ -461,6 +477,20 @@
 #    define ISA_CPU_X86_SSE4_1 0
 #  endif
 
+// SSE 4.2.
+#  if defined(__SSE4_2__) && _TL_BUILD_CONFIG_CAN_USE(__SSE4_2__)
+#    define ISA_CPU_X86_SSE4_2 1
+#  else
+#    define ISA_CPU_X86_SSE4_2 0
+#  endif
+
+// POPCNT.
+#  if defined(__POPCNT__) && _TL_BUILD_CONFIG_CAN_USE(__POPCNT__)
+#    define ISA_CPU_X86_POPCNT 1
+#  else
+#    define ISA_CPU_X86_POPCNT 0
+#  endif
+
 // AVX.
 #  if defined(__AVX__) && _TL_BUILD_CONFIG_CAN_USE(__AVX__)
 #    define ISA_CPU_X86_AVX 1
@@ -481,6 +511,80 @@
 #  else
 #    define ISA_CPU_X86_FMA 0
 #  endif
+
+// F16C.
+#  if defined(__F16C__) && _TL_BUILD_CONFIG_CAN_USE(__F16C__)
+#    define ISA_CPU_X86_F16C 1
+#  else
+#    define ISA_CPU_X86_F16C 0
+#  endif
+
+// BMI 1.
+#  if defined(__BMI__) && _TL_BUILD_CONFIG_CAN_USE(__BMI__)
+#    define ISA_CPU_X86_BMI1 1
+#  else
+#    define ISA_CPU_X86_BMI1 0
+#  endif
+
+// BMI 2.
+#  if defined(__BMI2__) && _TL_BUILD_CONFIG_CAN_USE(__BMI2__)
+#    define ISA_CPU_X86_BMI2 1
+#  else
+#    define ISA_CPU_X86_BMI2 0
+#  endif
+
+// AVX-512 Foundation.
+#  if defined(__AVX512F__) && _TL_BUILD_CONFIG_CAN_USE(__AVX512F__)
+#    define ISA_CPU_X86_AVX512F 1
+#  else
+#    define ISA_CPU_X86_AVX512F 0
+#  endif
+
+// AVX-512 Doubleword and Quadword Instructions.
+#  if defined(__AVX512DQ__) && _TL_BUILD_CONFIG_CAN_USE(__AVX512DQ__)
+#    define ISA_CPU_X86_AVX512DQ 1
+#  else
+#    define ISA_CPU_X86_AVX512DQ 0
+#  endif
+
+// AVX-512 Byte and Word Instructions.
+#  if defined(__AVX512BW__) && _TL_BUILD_CONFIG_CAN_USE(__AVX512BW__)
+#    define ISA_CPU_X86_AVX512BW 1
+#  else
+#    define ISA_CPU_X86_AVX512BW 0
+#  endif
+
+// AVX-512 Vector Length Extensions.
+#  if defined(__AVX512VL__) && _TL_BUILD_CONFIG_CAN_USE(__AVX512VL__)
+#    define ISA_CPU_X86_AVX512VL 1
+#  else
+#    define ISA_CPU_X86_AVX512VL 0
+#  endif
+
+// AVX-512 Vector Neural Network Instructions.
+#  if defined(__AVX512VNNI__) && _TL_BUILD_CONFIG_CAN_USE(__AVX512VNNI__)
+#    define ISA_CPU_X86_AVX512VNNI 1
+#  else
+#    define ISA_CPU_X86_AVX512VNNI 0
+#  endif
+#else
+#  define ISA_CPU_X86_SSE2 0
+#  define ISA_CPU_X86_SSE3 0
+#  define ISA_CPU_X86_SSSE3 0
+#  define ISA_CPU_X86_SSE4_1 0
+#  define ISA_CPU_X86_SSE4_2 0
+#  define ISA_CPU_X86_POPCNT 0
+#  define ISA_CPU_X86_AVX 0
+#  define ISA_CPU_X86_AVX2 0
+#  define ISA_CPU_X86_FMA 0
+#  define ISA_CPU_X86_F16C 0
+#  define ISA_CPU_X86_BMI1 0
+#  define ISA_CPU_X86_BMI2 0
+#  define ISA_CPU_X86_AVX512F 0
+#  define ISA_CPU_X86_AVX512DQ 0
+#  define ISA_CPU_X86_AVX512BW 0
+#  define ISA_CPU_X86_AVX512VL 0
+#  define ISA_CPU_X86_AVX512VNNI 0
 #endif
 
 #if ARCH_CPU_ARM_FAMILY
@@ -491,7 +595,24 @@
 #  else
 #    define ISA_CPU_ARM_NEON 0
 #  endif
+
+// Dot product instructions (SDOT and UDOT).
+#  if defined(__ARM_FEATURE_DOTPROD) &&                                        \
+      _TL_BUILD_CONFIG_CAN_USE(__ARM_FEATURE_DOTPROD)
+#    define ISA_CPU_ARM_DOTPROD 1
+#  else
+#    define ISA_CPU_ARM_DOTPROD 0
+#  endif
+
+// Scalable Vector Extension.
+#  if defined(__ARM_FEATURE_SVE) && _TL_BUILD_CONFIG_CAN_USE(__ARM_FEATURE_SVE)
+#    define ISA_CPU_ARM_SVE 1
+#  else
+#    define ISA_CPU_ARM_SVE 0
+#  endif
 #else
 #  define ISA_CPU_ARM_NEON 0
 #  define ISA_CPU_ARM_V8 0
+#  define ISA_CPU_ARM_DOTPROD 0
+#  define ISA_CPU_ARM_SVE 0
 #endif
@@ -0,0 +1,431 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Run-time detection of the instruction sets supported by the CPU.
+//
+// The tl_build_config.h tells which instruction sets the compiler is allowed
+// to use for the entire binary. A binary built for a baseline CPU can still
+// benefit from the instruction sets of a newer CPU, provided that the kernels
+// which use them are compiled separately and are only called when the CPU
+// supports them.
+//
+// GetCPUFeatures() returns the features of the CPU the program runs on. The
+// detection happens once, on the first call, and the result is cached:
+//
+//   if (GetCPUFeatures().avx2) {
+//     ...
+//   }
+//
+// On x86 the features are detected using the CPUID instruction. The AVX family
+// of the features is only reported when the operating system saves the wide
+// registers on context switch, which is checked using XGETBV. On ARM Linux and
+// Android the features are read from the hardware capabilities provided by the
+// kernel (getauxval()). On other platforms only the features enabled at
+// compile time are reported.
+//
+// Selecting implementation
+// ========================
+//
+// A kernel which uses a newer instruction set is compiled for this instruction
+// set using the TL_CPU_FEATURES_TARGET() attribute, and SelectImplementation()
+// picks the first implementation which is supported by the CPU. Storing the
+// result in a static variable makes the selection to happen once:
+//
+//   TL_CPU_FEATURES_TARGET("avx2,fma")
+//   auto SumAVX2(std::span<const float> values) -> float { ... }
+//
+//   auto SumScalar(std::span<const float> values) -> float { ... }
+//
+//   auto Sum(std::span<const float> values) -> float {
+//     static const auto kSum = SelectImplementation(
+//         {
+//             {[](const CPUFeatures& f) { return f.avx2 && f.fma; }, SumAVX2},
+//         },
+//         SumScalar);
+//     return kSum(values);
+//   }
+//
+// The implementations are checked in the order they are given, so the fastest
+// one is to be listed first. The fallback is used when none of them is
+// supported, and it is not to use instructions beyond the ones enabled at
+// compile time.
+//
+// SIMD width
+// ==========
+//
+// Kernels which process data in blocks can size the blocks after the width of
+// the vector registers. kCompileTimeSIMDWidth is the width of the widest vector
+// registers the compiler is allowed to use, and GetSIMDWidth() is the width of
+// the widest vector registers of the CPU:
+//
+//   constexpr std::size_t kBlockSize = kCompileTimeSIMDWidth / sizeof(float);
+//
+// Both are measured in bytes. When the CPU has no vector instructions the width
+// of the general purpose registers is used.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.2-alpha    (19 Oct 2026)    Detect AVX-512 VNNI and the SVE vector
+//                                   length, add SIMD width helpers.
+//   0.0.1-alpha    (19 Oct 2026)    First public release.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#include "tl_build_config.h"
+
+#if ARCH_CPU_X86_FAMILY
+#  if COMPILER_MSVC
+#    include <intrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+#endif
+
+#if ARCH_CPU_ARM_FAMILY && (OS_LINUX || OS_ANDROID)
+#  include <sys/auxv.h>
+#  include <sys/prctl.h>
+#endif
+
+// Semantic version of the tl_cpu_features library.
+#define TL_CPU_FEATURES_VERSION_MAJOR 0
+#define TL_CPU_FEATURES_VERSION_MINOR 0
+#define TL_CPU_FEATURES_VERSION_REVISION 2
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_CPU_FEATURES_NAMESPACE
+#  define TL_CPU_FEATURES_NAMESPACE tiny_lib::cpu_features
+#endif
+
+// Helpers for TL_CPU_FEATURES_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_CPU_FEATURES_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)         \
+  v_##id1##_##id2##_##id3
+#define TL_CPU_FEATURES_VERSION_NAMESPACE_CONCAT(id1, id2, id3)                \
+  TL_CPU_FEATURES_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_CPU_FEATURES_VERSION_NAMESPACE -> v_0_1_9
+#define TL_CPU_FEATURES_VERSION_NAMESPACE                                      \
+  TL_CPU_FEATURES_VERSION_NAMESPACE_CONCAT(TL_CPU_FEATURES_VERSION_MAJOR,      \
+                                           TL_CPU_FEATURES_VERSION_MINOR,      \
+                                           TL_CPU_FEATURES_VERSION_REVISION)
+
+// Attribute which allows the compiler to use the given instruction sets in the
+// function, regardless of the instruction sets enabled for the entire binary.
+// The argument is the target string of the compiler, such as "avx2,fma".
+//
+// MSVC allows the use of intrinsics of any instruction set in any function, so
+// the attribute expands to nothing.
+#if COMPILER_GCC || COMPILER_CLANG
+#  define TL_CPU_FEATURES_TARGET(isa) __attribute__((target(isa)))
+#else
+#  define TL_CPU_FEATURES_TARGET(isa)
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_CPU_FEATURES_NAMESPACE {
+inline namespace TL_CPU_FEATURES_VERSION_NAMESPACE {
+
+// Instruction sets supported by the CPU.
+// The features of other CPU families are always false.
+struct CPUFeatures {
+  // x86.
+  bool sse2 = false;
+  bool sse3 = false;
+  bool ssse3 = false;
+  bool sse4_1 = false;
+  bool sse4_2 = false;
+  bool popcnt = false;
+  bool avx = false;
+  bool avx2 = false;
+  bool fma = false;
+  bool f16c = false;
+  bool bmi1 = false;
+  bool bmi2 = false;
+  bool avx512f = false;
+  bool avx512dq = false;
+  bool avx512cd = false;
+  bool avx512bw = false;
+  bool avx512vl = false;
+  bool avx512vnni = false;
+
+  // ARM.
+  bool neon = false;
+  bool crc32 = false;
+  bool dotprod = false;
+  bool sve = false;
+
+  // Length of the SVE vector registers in bytes, or 0 if the CPU does not
+  // support SVE.
+  uint32_t sve_vector_size = 0;
+};
+
+namespace internal {
+
+#if ARCH_CPU_X86_FAMILY
+
+struct CPUIDRegisters {
+  uint32_t eax = 0;
+  uint32_t ebx = 0;
+  uint32_t ecx = 0;
+  uint32_t edx = 0;
+};
+
+// Execute CPUID for the given leaf and sub-leaf.
+// Returns all zeros if the leaf is not supported by the CPU.
+inline auto CPUID(const uint32_t leaf, const uint32_t subleaf)
+    -> CPUIDRegisters {
+  CPUIDRegisters regs;
+#  if COMPILER_MSVC
+  int info[4];
+  __cpuid(info, 0);
+  if (uint32_t(info[0]) < leaf) {
+    return regs;
+  }
+  __cpuidex(info, int(leaf), int(subleaf));
+  regs.eax = uint32_t(info[0]);
+  regs.ebx = uint32_t(info[1]);
+  regs.ecx = uint32_t(info[2]);
+  regs.edx = uint32_t(info[3]);
+#  else
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid_count(leaf, subleaf, &eax, &ebx, &ecx, &edx)) {
+    return regs;
+  }
+  regs.eax = eax;
+  regs.ebx = ebx;
+  regs.ecx = ecx;
+  regs.edx = edx;
+#  endif
+  return regs;
+}
+
+// Read the extended control register XCR0, which tells which register states
+// are saved by the operating system on context switch.
+// Is only to be called when the CPU reports OSXSAVE.
+inline auto ReadXCR0() -> uint64_t {
+#  if COMPILER_MSVC
+  return _xgetbv(0);
+#  else
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (uint64_t(edx) << 32) | eax;
+#  endif
+}
+
+inline auto HasBit(const uint32_t reg, const int bit) -> bool {
+  return (reg >> bit) & 1;
+}
+
+inline void DetectX86Features(CPUFeatures& features) {
+  const CPUIDRegisters leaf1 = CPUID(1, 0);
+  const CPUIDRegisters leaf7 = CPUID(7, 0);
+
+  features.sse2 = HasBit(leaf1.edx, 26);
+  features.sse3 = HasBit(leaf1.ecx, 0);
+  features.ssse3 = HasBit(leaf1.ecx, 9);
+  features.sse4_1 = HasBit(leaf1.ecx, 19);
+  features.sse4_2 = HasBit(leaf1.ecx, 20);
+  features.popcnt = HasBit(leaf1.ecx, 23);
+  features.bmi1 = HasBit(leaf7.ebx, 3);
+  features.bmi2 = HasBit(leaf7.ebx, 8);
+
+  // The AVX registers are only usable when the operating system saves the XMM
+  // and YMM states, and the AVX-512 ones when it also saves the opmask and ZMM
+  // states.
+  uint64_t xcr0 = 0;
+  if (HasBit(leaf1.ecx, 27)) {
+    xcr0 = ReadXCR0();
+  }
+  const bool os_avx = (xcr0 & 0x06) == 0x06;
+  const bool os_avx512 = os_avx && (xcr0 & 0xe0) == 0xe0;
+
+  if (os_avx) {
+    features.avx = HasBit(leaf1.ecx, 28);
+    features.fma = HasBit(leaf1.ecx, 12);
+    features.f16c = HasBit(leaf1.ecx, 29);
+    features.avx2 = HasBit(leaf7.ebx, 5);
+  }
+
+  if (os_avx512) {
+    features.avx512f = HasBit(leaf7.ebx, 16);
+    features.avx512dq = HasBit(leaf7.ebx, 17);
+    features.avx512cd = HasBit(leaf7.ebx, 28);
+    features.avx512bw = HasBit(leaf7.ebx, 30);
+    features.avx512vl = HasBit(leaf7.ebx, 31);
+    features.avx512vnni = HasBit(leaf7.ecx, 11);
+  }
+}
+
+#endif  // ARCH_CPU_X86_FAMILY
+
+#if ARCH_CPU_ARM_FAMILY
+
+inline void DetectARMFeatures(CPUFeatures& features) {
+  // Features which the compiler is allowed to use are known to be supported.
+  features.neon = ISA_CPU_ARM_NEON;
+  features.dotprod = ISA_CPU_ARM_DOTPROD;
+  features.sve = ISA_CPU_ARM_SVE;
+#  if defined(__ARM_FEATURE_CRC32)
+  features.crc32 = true;
+#  endif
+#  if defined(__ARM_FEATURE_SVE_BITS)
+  features.sve_vector_size = __ARM_FEATURE_SVE_BITS / 8;
+#  endif
+
+#  if OS_LINUX || OS_ANDROID
+  // Bits of the AT_HWCAP, as defined in the asm/hwcap.h of the kernel. They
+  // are not used by name as older C libraries do not define all of them.
+  const unsigned long hwcap = getauxval(AT_HWCAP);
+#    if ARCH_CPU_64_BITS
+  features.neon = features.neon || (hwcap & (1UL << 1));
+  features.crc32 = features.crc32 || (hwcap & (1UL << 7));
+  features.dotprod = features.dotprod || (hwcap & (1UL << 20));
+  features.sve = features.sve || (hwcap & (1UL << 22));
+
+  // The vector length is configured by the kernel per process, and is returned
+  // in the lower bits of PR_SVE_GET_VL.
+  if (features.sve) {
+    const int vector_length = prctl(/*PR_SVE_GET_VL=*/51);
+    if (vector_length > 0) {
+      features.sve_vector_size = uint32_t(vector_length) & 0xffff;
+    }
+  }
+#    else
+  features.neon = features.neon || (hwcap & (1UL << 12));
+  const unsigned long hwcap2 = getauxval(AT_HWCAP2);
+  features.crc32 = features.crc32 || (hwcap2 & (1UL << 4));
+#    endif
+#  endif
+
+  // The vector registers are at least 128 bits wide.
+  if (features.sve && features.sve_vector_size == 0) {
+    features.sve_vector_size = 16;
+  }
+}
+
+#endif  // ARCH_CPU_ARM_FAMILY
+
+}  // namespace internal
+
+// Detect the features of the CPU the program runs on.
+//
+// Every call performs the detection. Use GetCPUFeatures() to access the cached
+// result of the detection.
+inline auto DetectCPUFeatures() -> CPUFeatures {
+  CPUFeatures features;
+#if ARCH_CPU_X86_FAMILY
+  internal::DetectX86Features(features);
+#elif ARCH_CPU_ARM_FAMILY
+  internal::DetectARMFeatures(features);
+#endif
+  return features;
+}
+
+// Get features of the CPU the program runs on.
+//
+// The detection happens on the first call, and it is safe to call this function
+// from multiple threads.
+inline auto GetCPUFeatures() -> const CPUFeatures& {
+  static const CPUFeatures features = DetectCPUFeatures();
+  return features;
+}
+
+// Width in bytes of the widest vector registers the compiler is allowed to use.
+#if ISA_CPU_X86_AVX512F
+inline constexpr std::size_t kCompileTimeSIMDWidth = 64;
+#elif ISA_CPU_X86_AVX
+inline constexpr std::size_t kCompileTimeSIMDWidth = 32;
+#elif ISA_CPU_ARM_SVE && defined(__ARM_FEATURE_SVE_BITS)
+inline constexpr std::size_t kCompileTimeSIMDWidth = __ARM_FEATURE_SVE_BITS / 8;
+#elif ISA_CPU_X86_SSE2 || ISA_CPU_ARM_NEON || ISA_CPU_ARM_SVE
+inline constexpr std::size_t kCompileTimeSIMDWidth = 16;
+#else
+inline constexpr std::size_t kCompileTimeSIMDWidth = sizeof(void*);
+#endif
+
+// Get width in bytes of the widest vector registers of a CPU with the given
+// features.
+constexpr auto GetSIMDWidth(const CPUFeatures& features) -> std::size_t {
+  if (features.avx512f) {
+    return 64;
+  }
+  if (features.avx) {
+    return 32;
+  }
+  if (features.sve && features.sve_vector_size > 16) {
+    return features.sve_vector_size;
+  }
+  if (features.sse2 || features.neon || features.sve) {
+    return 16;
+  }
+  return sizeof(void*);
+}
+
+// Get width in bytes of the widest vector registers of the CPU the program runs
+// on.
+inline auto GetSIMDWidth() -> std::size_t {
+  return GetSIMDWidth(GetCPUFeatures());
+}
+
+// Implementation of a function which requires specific CPU features.
+template <class FunctionPointer>
+struct Implementation {
+  // Returns true if the implementation can be used on a CPU with the given
+  // features.
+  bool (*is_supported)(const CPUFeatures& features);
+
+  FunctionPointer function;
+};
+
+// Select the first of the implementations which is supported by a CPU with the
+// given features, or the fallback if none of them is supported.
+template <class FunctionPointer>
+auto SelectImplementation(
+    const CPUFeatures& features,
+    const std::initializer_list<
+        Implementation<std::type_identity_t<FunctionPointer>>> implementations,
+    const FunctionPointer fallback) -> FunctionPointer {
+  for (const auto& implementation : implementations) {
+    if (implementation.is_supported(features)) {
+      return implementation.function;
+    }
+  }
+  return fallback;
+}
+
+// Select the first of the implementations which is supported by the CPU the
+// program runs on, or the fallback if none of them is supported.
+template <class FunctionPointer>
+auto SelectImplementation(
+    const std::initializer_list<
+        Implementation<std::type_identity_t<FunctionPointer>>> implementations,
+    const FunctionPointer fallback) -> FunctionPointer {
+  return SelectImplementation(GetCPUFeatures(), implementations, fallback);
+}
+
+}  // namespace TL_CPU_FEATURES_VERSION_NAMESPACE
+}  // namespace TL_CPU_FEATURES_NAMESPACE
+
+#undef TL_CPU_FEATURES_VERSION_MAJOR
+#undef TL_CPU_FEATURES_VERSION_MINOR
+#undef TL_CPU_FEATURES_VERSION_REVISION
+
+#undef TL_CPU_FEATURES_VERSION_NAMESPACE
+
+#undef TL_CPU_FEATURES_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_CPU_FEATURES_VERSION_NAMESPACE_CONCAT
+#undef TL_CPU_FEATURES_NAMESPACE
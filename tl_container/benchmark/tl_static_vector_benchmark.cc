@@ -0,0 +1,196 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Benchmarks of the StaticVector operations compared to std::vector with the
+// capacity reserved up-front, and to boost::container::static_vector when it is
+// available.
+//
+// Every operation is measured for a trivially copyable element type (int) and
+// for a type with non-trivial copy and move (std::string short enough to fit
+// into the small string buffer, so that the heap allocator does not dominate
+// the timing).
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tiny_lib/benchmark/benchmark.h"
+#include "tl_container/tl_static_vector.h"
+
+#if __has_include(<boost/container/static_vector.hpp>)
+#  include <boost/container/static_vector.hpp>
+#  define TL_BENCHMARK_WITH_BOOST 1
+#else
+#  define TL_BENCHMARK_WITH_BOOST 0
+#endif
+
+namespace tiny_lib::static_vector {
+namespace {
+
+using benchmark::DoNotOptimize;
+using benchmark::RegisterBenchmark;
+
+// std::vector which reserves capacity for N elements on construction.
+template <class T, std::size_t N>
+class ReservedVector : public std::vector<T> {
+ public:
+  ReservedVector() { this->reserve(N); }
+};
+
+#if TL_BENCHMARK_WITH_BOOST
+template <class T, std::size_t N>
+using BoostStaticVector = boost::container::static_vector<T, N>;
+#endif
+
+template <class T>
+auto MakeValue(int i) -> T;
+
+template <>
+auto MakeValue<int>(const int i) -> int {
+  return i;
+}
+
+template <>
+auto MakeValue<std::string>(const int i) -> std::string {
+  return "value " + std::to_string(i);
+}
+
+template <class T>
+auto GetTypeName() -> std::string;
+
+template <>
+auto GetTypeName<int>() -> std::string {
+  return "int";
+}
+
+template <>
+auto GetTypeName<std::string>() -> std::string {
+  return "string";
+}
+
+// Values which are inserted into the containers.
+template <class T, std::size_t N>
+auto GetValues() -> const std::array<T, N>& {
+  static const std::array<T, N> values = []() {
+    std::array<T, N> result;
+    for (std::size_t i = 0; i < N; ++i) {
+      result[i] = MakeValue<T>(int(i));
+    }
+    return result;
+  }();
+  return values;
+}
+
+template <class Container, std::size_t N>
+auto MakeFullContainer() -> Container {
+  const auto& values = GetValues<typename Container::value_type, N>();
+  Container container;
+  for (const auto& value : values) {
+    container.push_back(value);
+  }
+  return container;
+}
+
+// Construct a container and fill it up to its capacity with push_back().
+template <class Container, std::size_t N>
+void BM_PushBack(const std::size_t num_iterations) {
+  const auto& values = GetValues<typename Container::value_type, N>();
+  for (std::size_t i = 0; i < num_iterations; ++i) {
+    Container container;
+    for (const auto& value : values) {
+      container.push_back(value);
+    }
+    DoNotOptimize(container);
+  }
+}
+
+// Construct a container and fill it up to its capacity inserting elements at
+// its beginning.
+template <class Container, std::size_t N>
+void BM_InsertFront(const std::size_t num_iterations) {
+  const auto& values = GetValues<typename Container::value_type, N>();
+  for (std::size_t i = 0; i < num_iterations; ++i) {
+    Container container;
+    for (const auto& value : values) {
+      container.insert(container.begin(), value);
+    }
+    DoNotOptimize(container);
+  }
+}
+
+// Erase the first element of a full container, and append a new one to keep
+// the container full.
+template <class Container, std::size_t N>
+void BM_EraseFront(const std::size_t num_iterations) {
+  const auto& values = GetValues<typename Container::value_type, N>();
+  Container container = MakeFullContainer<Container, N>();
+  for (std::size_t i = 0; i < num_iterations; ++i) {
+    container.erase(container.begin());
+    container.push_back(values[i % N]);
+    DoNotOptimize(container);
+  }
+}
+
+// Copy construct a full container.
+template <class Container, std::size_t N>
+void BM_Copy(const std::size_t num_iterations) {
+  const Container source = MakeFullContainer<Container, N>();
+  for (std::size_t i = 0; i < num_iterations; ++i) {
+    Container container(source);
+    DoNotOptimize(container);
+  }
+}
+
+// Move a full container to a new one and back.
+template <class Container, std::size_t N>
+void BM_Move(const std::size_t num_iterations) {
+  Container source = MakeFullContainer<Container, N>();
+  for (std::size_t i = 0; i < num_iterations; ++i) {
+    Container container(std::move(source));
+    DoNotOptimize(container);
+    source = std::move(container);
+  }
+}
+
+template <template <class, std::size_t> class Container,
+          class T,
+          std::size_t N>
+void RegisterContainerBenchmarks(const std::string& container_name) {
+  using ContainerType = Container<T, N>;
+
+  const std::string suffix =
+      "/" + container_name + "/" + GetTypeName<T>() + "/" + std::to_string(N);
+
+  RegisterBenchmark("PushBack" + suffix, BM_PushBack<ContainerType, N>);
+  RegisterBenchmark("InsertFront" + suffix, BM_InsertFront<ContainerType, N>);
+  RegisterBenchmark("EraseFront" + suffix, BM_EraseFront<ContainerType, N>);
+  RegisterBenchmark("Copy" + suffix, BM_Copy<ContainerType, N>);
+  RegisterBenchmark("Move" + suffix, BM_Move<ContainerType, N>);
+}
+
+template <class T, std::size_t N>
+void RegisterBenchmarks() {
+  RegisterContainerBenchmarks<StaticVector, T, N>("StaticVector");
+  RegisterContainerBenchmarks<ReservedVector, T, N>("std::vector");
+#if TL_BENCHMARK_WITH_BOOST
+  RegisterContainerBenchmarks<BoostStaticVector, T, N>("boost::static_vector");
+#endif
+}
+
+[[maybe_unused]] const bool kRegistered = []() {
+  RegisterBenchmarks<int, 16>();
+  RegisterBenchmarks<int, 256>();
+  RegisterBenchmarks<int, 4096>();
+
+  RegisterBenchmarks<std::string, 16>();
+  RegisterBenchmarks<std::string, 256>();
+  RegisterBenchmarks<std::string, 4096>();
+
+  return true;
+}();
+
+}  // namespace
+}  // namespace tiny_lib::static_vector
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A program which measures the code size impact of a vector implementation.
+//
+// The program performs the same set of operations for an integer and a string
+// vector. The implementation is chosen by the TL_SIZE_PROBE_CONTAINER:
+//
+//   0 - No container: a baseline which only contains the input and output.
+//   1 - std::vector.
+//   2 - StaticVector.
+//   3 - boost::container::static_vector.
+//
+// Comparing sizes of the program sections against the baseline gives the code
+// size which is added by the use of the container.
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+#if TL_SIZE_PROBE_CONTAINER == 1
+#  include <vector>
+#elif TL_SIZE_PROBE_CONTAINER == 2
+#  include "tl_container/tl_static_vector.h"
+#elif TL_SIZE_PROBE_CONTAINER == 3
+#  include <boost/container/static_vector.hpp>
+#endif
+
+namespace {
+
+constexpr std::size_t kCapacity = 32;
+
+#if TL_SIZE_PROBE_CONTAINER == 1
+template <class T>
+using Vector = std::vector<T>;
+#elif TL_SIZE_PROBE_CONTAINER == 2
+template <class T>
+using Vector = tiny_lib::static_vector::StaticVector<T, kCapacity>;
+#elif TL_SIZE_PROBE_CONTAINER == 3
+template <class T>
+using Vector = boost::container::static_vector<T, kCapacity>;
+#endif
+
+#if TL_SIZE_PROBE_CONTAINER != 0
+// Exercise the commonly used operations of the vector.
+template <class T>
+auto Exercise(const T& value, const int count) -> std::size_t {
+  Vector<T> vector;
+  for (int i = 0; i < count; ++i) {
+    vector.push_back(value);
+  }
+  vector.insert(vector.begin(), value);
+  vector.erase(vector.begin() + 1);
+  vector.pop_back();
+
+  Vector<T> copy(vector);
+  Vector<T> moved(std::move(vector));
+
+  return copy.size() + moved.size();
+}
+#endif
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  // Read inputs from the command line, so that the compiler can not evaluate
+  // the program at compile time.
+  const std::string string = argc > 1 ? argv[1] : "";
+
+  std::size_t result = string.size();
+#if TL_SIZE_PROBE_CONTAINER != 0
+  const int count = argc % int(kCapacity / 2);
+  result += Exercise(argc, count);
+  result += Exercise(string, count);
+#endif
+
+  std::printf("%zu\n", result);
+
+  return 0;
+}
@@ -0,0 +1,260 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Error handling policy which counts the checks, to verify that the deque
+// uses the policy provided by the application.
+namespace tiny_lib::static_deque {
+inline int num_throw_checks = 0;
+}  // namespace tiny_lib::static_deque
+#define TL_STATIC_DEQUE_THROW_IF(ExceptionType, expression)                    \
+  (++tiny_lib::static_deque::num_throw_checks,                                 \
+   tiny_lib::static_deque::internal::ThrowIfOrAbort<ExceptionType>(            \
+       expression, #expression))
+
+#include "tl_container/tl_static_deque.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "tiny_lib/unittest/mock.h"
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::static_deque {
+
+using testing::ElementsAre;
+
+TEST(StaticDeque, ThrowPolicy) {
+  StaticDeque<int, 2> deque;
+
+  num_throw_checks = 0;
+  deque.push_back(1);
+  deque.push_front(2);
+  EXPECT_EQ(num_throw_checks, 2);
+
+  EXPECT_EQ(deque.at(0), 2);
+  EXPECT_EQ(num_throw_checks, 3);
+
+  EXPECT_THROW_OR_ABORT(deque.push_back(3), std::length_error);
+}
+
+TEST(StaticDeque, Construct) {
+  // Default constructor.
+  {
+    const StaticDeque<int, 3> deque;
+    EXPECT_TRUE(deque.empty());
+    EXPECT_EQ(deque.size(), 0);
+    EXPECT_EQ(deque.max_size(), 3);
+  }
+
+  // Count copies.
+  {
+    const StaticDeque<std::string, 3> deque(2, "a");
+    EXPECT_THAT(deque, ElementsAre("a", "a"));
+  }
+
+  // Initializer list.
+  {
+    const StaticDeque<std::string, 3> deque{"a", "b", "c"};
+    EXPECT_THAT(deque, ElementsAre("a", "b", "c"));
+  }
+
+  EXPECT_THROW_OR_ABORT((StaticDeque<int, 2>{1, 2, 3}), std::length_error);
+}
+
+TEST(StaticDeque, CopyMove) {
+  // Make the elements wrap around the end of the storage.
+  StaticDeque<std::string, 5> deque{"c", "d", "e"};
+  deque.push_front("b");
+  deque.push_front("a");
+  deque.pop_back();
+  deque.pop_back();
+  deque.push_front("z");
+
+  const StaticDeque<std::string, 5> deque_copy(deque);
+  EXPECT_THAT(deque_copy, ElementsAre("z", "a", "b", "c"));
+
+  const StaticDeque<std::string, 5> deque_move(std::move(deque));
+  EXPECT_THAT(deque_move, ElementsAre("z", "a", "b", "c"));
+  // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+  EXPECT_TRUE(deque.empty());
+
+  StaticDeque<std::string, 5> deque_assign{"x"};
+  deque_assign = deque_copy;
+  EXPECT_THAT(deque_assign, ElementsAre("z", "a", "b", "c"));
+
+  StaticDeque<std::string, 5> deque_move_assign{"x"};
+  deque_move_assign = std::move(deque_assign);
+  EXPECT_THAT(deque_move_assign, ElementsAre("z", "a", "b", "c"));
+}
+
+TEST(StaticDeque, CopyMoveTriviallyCopyable) {
+  StaticDeque<int, 5> deque{3, 4, 5};
+  deque.push_front(2);
+  deque.push_front(1);
+  deque.pop_back();
+  deque.pop_back();
+  deque.push_front(0);
+
+  const StaticDeque<int, 5> deque_copy(deque);
+  EXPECT_THAT(deque_copy, ElementsAre(0, 1, 2, 3));
+
+  StaticDeque<int, 5> deque_move(std::move(deque));
+  EXPECT_THAT(deque_move, ElementsAre(0, 1, 2, 3));
+
+  // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+  EXPECT_TRUE(deque.empty());
+
+  deque_move.push_back(4);
+  EXPECT_THAT(deque_move, ElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST(StaticDeque, ElementAccess) {
+  StaticDeque<int, 4> deque{1, 2, 3};
+
+  EXPECT_EQ(deque.at(1), 2);
+  EXPECT_EQ(std::as_const(deque).at(2), 3);
+  EXPECT_THROW_OR_ABORT(deque.at(3), std::out_of_range);
+
+  EXPECT_EQ(deque.front(), 1);
+  EXPECT_EQ(deque.back(), 3);
+
+  deque[1] = 20;
+  EXPECT_THAT(deque, ElementsAre(1, 20, 3));
+}
+
+TEST(StaticDeque, PushPop) {
+  StaticDeque<std::string, 3> deque;
+
+  deque.push_back("b");
+  deque.push_front("a");
+  deque.emplace_back(2, 'c');
+  EXPECT_THAT(deque, ElementsAre("a", "b", "cc"));
+
+  EXPECT_THROW_OR_ABORT(deque.push_back("d"), std::length_error);
+  EXPECT_THROW_OR_ABORT(deque.push_front("d"), std::length_error);
+
+  deque.pop_front();
+  EXPECT_THAT(deque, ElementsAre("b", "cc"));
+
+  EXPECT_EQ(deque.emplace_front("x"), "x");
+  EXPECT_THAT(deque, ElementsAre("x", "b", "cc"));
+
+  deque.pop_back();
+  deque.pop_back();
+  deque.pop_back();
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(StaticDeque, Iterator) {
+  StaticDeque<int, 4> deque{2, 3};
+  deque.push_front(1);
+  deque.push_front(0);
+
+  EXPECT_EQ(deque.end() - deque.begin(), 4);
+  EXPECT_EQ(deque.begin()[3], 3);
+  EXPECT_EQ(*(deque.cbegin() + 2), 2);
+  EXPECT_THAT(std::vector<int>(deque.rbegin(), deque.rend()),
+              ElementsAre(3, 2, 1, 0));
+
+  std::sort(deque.begin(), deque.end(), std::greater<>());
+  EXPECT_THAT(deque, ElementsAre(3, 2, 1, 0));
+}
+
+TEST(StaticDeque, erase) {
+  StaticDeque<std::string, 8> deque{"a", "b", "c", "d", "e", "f"};
+
+  // Closer to the front.
+  auto it = deque.erase(deque.begin() + 1);
+  EXPECT_EQ(*it, "c");
+  EXPECT_THAT(deque, ElementsAre("a", "c", "d", "e", "f"));
+
+  // Closer to the back.
+  it = deque.erase(deque.begin() + 3);
+  EXPECT_EQ(*it, "f");
+  EXPECT_THAT(deque, ElementsAre("a", "c", "d", "f"));
+
+  it = deque.erase(deque.end() - 1);
+  EXPECT_EQ(it, deque.end());
+  EXPECT_THAT(deque, ElementsAre("a", "c", "d"));
+}
+
+TEST(StaticDeque, Lifetime) {
+  auto object = std::make_shared<int>(1);
+
+  {
+    StaticDeque<std::shared_ptr<int>, 3> deque;
+    deque.push_back(object);
+    deque.push_front(object);
+    deque.push_back(object);
+    EXPECT_EQ(object.use_count(), 4);
+
+    deque.pop_front();
+    EXPECT_EQ(object.use_count(), 3);
+
+    deque.erase(deque.begin());
+    EXPECT_EQ(object.use_count(), 2);
+
+    deque.push_front(object);
+    deque.push_front(object);
+    EXPECT_EQ(object.use_count(), 4);
+  }
+
+  EXPECT_EQ(object.use_count(), 1);
+}
+
+TEST(StaticDeque, swap) {
+  StaticDeque<std::string, 4> a{"a"};
+  StaticDeque<std::string, 4> b{"b", "c", "d"};
+
+  swap(a, b);
+  EXPECT_THAT(a, ElementsAre("b", "c", "d"));
+  EXPECT_THAT(b, ElementsAre("a"));
+}
+
+TEST(StaticDeque, Compare) {
+  const StaticDeque<int, 4> a{1, 2};
+  const StaticDeque<int, 4> b{1, 2};
+  const StaticDeque<int, 8> c{1, 3};
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+}
+
+TEST(StaticDeque, Random) {
+  // Compare behavior against the std::deque on a random sequence of operations.
+  std::mt19937 rng(0);
+
+  StaticDeque<int, 7> deque;
+  std::deque<int> reference;
+
+  for (int i = 0; i < 20000; ++i) {
+    const int operation = rng() % 5;
+    if (operation == 0 && reference.size() < 7) {
+      deque.push_back(i);
+      reference.push_back(i);
+    } else if (operation == 1 && reference.size() < 7) {
+      deque.push_front(i);
+      reference.push_front(i);
+    } else if (operation == 2 && !reference.empty()) {
+      deque.pop_back();
+      reference.pop_back();
+    } else if (operation == 3 && !reference.empty()) {
+      deque.pop_front();
+      reference.pop_front();
+    } else if (operation == 4 && !reference.empty()) {
+      const size_t index = rng() % reference.size();
+      deque.erase(deque.begin() + index);
+      reference.erase(reference.begin() + index);
+    }
+
+    ASSERT_TRUE(std::equal(
+        deque.begin(), deque.end(), reference.begin(), reference.end()));
+  }
+}
+
+}  // namespace tiny_lib::static_deque
@@ -0,0 +1,377 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_container/tl_static_flat_map.h"
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "tiny_lib/unittest/mock.h"
+#include "tiny_lib/unittest/test.h"
+#include "tl_string/tl_cstring_view.h"
+#include "tl_string/tl_static_string.h"
+
+namespace tiny_lib::static_flat_map {
+
+using cstring_view::CStringView;
+using static_string::StaticString;
+using testing::ElementsAre;
+using testing::Pair;
+
+////////////////////////////////////////////////////////////////////////////////
+// Search.
+
+TEST(StaticFlatMap, LowerUpperBound) {
+  // Test both linear and binary search variants, covering all positions of the
+  // searched key, including the ones in-between and outside of the stored keys.
+  const std::array<int, 7> keys{2, 4, 4, 6, 8, 10, 12};
+  for (int key = 0; key < 14; ++key) {
+    const size_t expected_lower =
+        std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+    const size_t expected_upper =
+        std::upper_bound(keys.begin(), keys.end(), key) - keys.begin();
+
+    for (size_t size = 0; size <= keys.size(); ++size) {
+      const size_t lower = std::min(expected_lower, size);
+      const size_t upper = std::min(expected_upper, size);
+
+      EXPECT_EQ(internal::LowerBound<8>(keys.data(), size, key, Less()), lower);
+      EXPECT_EQ(internal::LowerBound<1024>(keys.data(), size, key, Less()),
+                lower);
+
+      EXPECT_EQ(internal::UpperBound<8>(keys.data(), size, key, Less()), upper);
+      EXPECT_EQ(internal::UpperBound<1024>(keys.data(), size, key, Less()),
+                upper);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticFlatMap.
+
+TEST(StaticFlatMap, Construct) {
+  // Default constructor.
+  {
+    const StaticFlatMap<int, std::string, 4> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.capacity(), 4);
+  }
+
+  // Construct from an unsorted range with duplicates.
+  {
+    const std::vector<std::pair<int, std::string>> elements{
+        {3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+    const StaticFlatMap<int, std::string, 4> map(elements.begin(),
+                                                 elements.end());
+    EXPECT_THAT(map, ElementsAre(Pair(1, "a"), Pair(2, "b"), Pair(3, "c")));
+  }
+
+  // Construct from an initializer list.
+  {
+    const StaticFlatMap<int, std::string, 4> map{{3, "c"}, {1, "a"}};
+    EXPECT_THAT(map, ElementsAre(Pair(1, "a"), Pair(3, "c")));
+  }
+
+  // The range does not fit.
+  {
+    using Map = StaticFlatMap<int, std::string, 2>;
+    EXPECT_THROW_OR_ABORT(Map({{1, "a"}, {2, "b"}, {3, "c"}}),
+                          std::length_error);
+  }
+}
+
+TEST(StaticFlatMap, at) {
+  StaticFlatMap<int, std::string, 4> map{{1, "a"}, {2, "b"}};
+
+  EXPECT_EQ(map.at(1), "a");
+  EXPECT_EQ(std::as_const(map).at(2), "b");
+  EXPECT_THROW_OR_ABORT(map.at(3), std::out_of_range);
+
+  map.at(1) = "x";
+  EXPECT_EQ(map.at(1), "x");
+}
+
+TEST(StaticFlatMap, operator_square_brackets) {
+  StaticFlatMap<int, std::string, 4> map;
+
+  map[2] = "b";
+  map[1] = "a";
+  EXPECT_EQ(map[2], "b");
+  EXPECT_THAT(map, ElementsAre(Pair(1, "a"), Pair(2, "b")));
+}
+
+TEST(StaticFlatMap, insert) {
+  StaticFlatMap<int, std::string, 3> map;
+
+  {
+    const auto [it, inserted] = map.insert({2, "b"});
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(it->first, 2);
+    EXPECT_EQ(it->second, "b");
+  }
+
+  {
+    const auto [it, inserted] = map.insert({2, "x"});
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(it->second, "b");
+  }
+
+  map.insert({1, "a"});
+  map.insert({3, "c"});
+  EXPECT_THAT(map, ElementsAre(Pair(1, "a"), Pair(2, "b"), Pair(3, "c")));
+
+  EXPECT_THROW_OR_ABORT(map.insert({4, "d"}), std::length_error);
+  EXPECT_THAT(map, ElementsAre(Pair(1, "a"), Pair(2, "b"), Pair(3, "c")));
+}
+
+TEST(StaticFlatMap, insert_range) {
+  StaticFlatMap<int, std::string, 6> map{{2, "b"}, {4, "d"}};
+
+  // Elements with the existing keys are not inserted.
+  map.insert({{5, "e"}, {1, "a"}, {4, "x"}, {3, "c"}, {1, "y"}});
+  EXPECT_THAT(map,
+              ElementsAre(Pair(1, "a"),
+                          Pair(2, "b"),
+                          Pair(3, "c"),
+                          Pair(4, "d"),
+                          Pair(5, "e")));
+
+  // The range which does not fit leaves the container unchanged.
+  EXPECT_THROW_OR_ABORT(map.insert({{6, "f"}, {7, "g"}}), std::length_error);
+  EXPECT_EQ(map.size(), 5);
+}
+
+TEST(StaticFlatMap, try_emplace) {
+  StaticFlatMap<int, std::string, 4> map;
+
+  EXPECT_TRUE(map.try_emplace(1, 3, 'a').second);
+  EXPECT_FALSE(map.try_emplace(1, 3, 'b').second);
+  EXPECT_TRUE(map.emplace(2, "b").second);
+  EXPECT_THAT(map, ElementsAre(Pair(1, "aaa"), Pair(2, "b")));
+}
+
+TEST(StaticFlatMap, try_emplace_exception) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  // Key which throws when copied from a negative value.
+  struct Key {
+    explicit Key(const int new_value) : value(new_value) {}
+    Key(const Key& other) : value(other.value) {
+      if (value < 0) {
+        throw std::runtime_error("Negative key");
+      }
+    }
+    Key(Key&& other) noexcept = default;
+    auto operator=(const Key& other) -> Key& = default;
+    auto operator=(Key&& other) noexcept -> Key& = default;
+
+    auto operator<(const Key& other) const -> bool {
+      return value < other.value;
+    }
+
+    int value;
+  };
+
+  StaticFlatMap<Key, std::string, 4> map;
+  map.try_emplace(Key(1), "a");
+  map.try_emplace(Key(3), "c");
+
+  const Key key(-1);
+  EXPECT_THROW(map.try_emplace(key, "b"), std::runtime_error);
+
+  // The keys and the values stay in sync.
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_THAT(map.values(), ElementsAre("a", "c"));
+  EXPECT_EQ(map.at(Key(3)), "c");
+#endif
+}
+
+TEST(StaticFlatMap, insert_or_assign) {
+  StaticFlatMap<int, std::string, 4> map;
+
+  EXPECT_TRUE(map.insert_or_assign(1, "a").second);
+  EXPECT_FALSE(map.insert_or_assign(1, "b").second);
+  EXPECT_THAT(map, ElementsAre(Pair(1, "b")));
+}
+
+TEST(StaticFlatMap, erase) {
+  StaticFlatMap<int, std::string, 4> map{{1, "a"}, {2, "b"}, {3, "c"}};
+
+  auto it = map.erase(map.find(2));
+  EXPECT_EQ(it->first, 3);
+  EXPECT_THAT(map, ElementsAre(Pair(1, "a"), Pair(3, "c")));
+
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  EXPECT_THAT(map, ElementsAre(Pair(3, "c")));
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(StaticFlatMap, erase_if) {
+  StaticFlatMap<int, std::string, 4> map{{1, "a"}, {2, "b"}, {3, "c"}};
+
+  EXPECT_EQ(erase_if(map, [](const auto& element) {
+              return element.first % 2 == 1;
+            }),
+            2);
+  EXPECT_THAT(map, ElementsAre(Pair(2, "b")));
+}
+
+TEST(StaticFlatMap, Lookup) {
+  const StaticFlatMap<int, std::string, 64> map{
+      {10, "a"}, {20, "b"}, {30, "c"}};
+
+  EXPECT_EQ(map.find(20)->second, "b");
+  EXPECT_EQ(map.find(25), map.end());
+
+  EXPECT_TRUE(map.contains(30));
+  EXPECT_FALSE(map.contains(31));
+  EXPECT_EQ(map.count(10), 1);
+  EXPECT_EQ(map.count(11), 0);
+
+  EXPECT_EQ(map.lower_bound(20)->first, 20);
+  EXPECT_EQ(map.upper_bound(20)->first, 30);
+  EXPECT_EQ(map.lower_bound(31), map.end());
+}
+
+TEST(StaticFlatMap, HeterogeneousLookup) {
+  // StaticString as key.
+  {
+    const StaticFlatMap<StaticString<16>, int, 4> map{
+        {"foo", 1}, {"bar", 2}, {"baz", 3}};
+
+    EXPECT_EQ(map.at("foo"), 1);
+    EXPECT_EQ(map.at(CStringView("bar")), 2);
+    EXPECT_EQ(map.find(std::string_view("baz"))->second, 3);
+    EXPECT_FALSE(map.contains("qux"));
+  }
+
+  // CStringView as key.
+  {
+    const StaticFlatMap<CStringView, int, 4> map{
+        {"foo", 1}, {"bar", 2}, {"baz", 3}};
+
+    EXPECT_EQ(map.at(StaticString<8>("foo")), 1);
+    EXPECT_EQ(map.at(std::string("bar")), 2);
+    EXPECT_TRUE(map.contains("baz"));
+  }
+}
+
+TEST(StaticFlatMap, KeysValues) {
+  StaticFlatMap<int, int, 4> map{{3, 30}, {1, 10}, {2, 20}};
+
+  EXPECT_THAT(map.keys(), ElementsAre(1, 2, 3));
+  EXPECT_THAT(map.values(), ElementsAre(10, 20, 30));
+
+  for (int& value : map.values()) {
+    value += 1;
+  }
+  EXPECT_THAT(map.values(), ElementsAre(11, 21, 31));
+}
+
+TEST(StaticFlatMap, Iterator) {
+  StaticFlatMap<int, int, 4> map{{3, 30}, {1, 10}, {2, 20}};
+
+  for (auto [key, value] : map) {
+    value = key * 100;
+  }
+  EXPECT_THAT(map, ElementsAre(Pair(1, 100), Pair(2, 200), Pair(3, 300)));
+
+  EXPECT_EQ(map.end() - map.begin(), 3);
+  EXPECT_EQ(map.begin()[2].second, 300);
+
+  const StaticFlatMap<int, int, 4>::const_iterator it = map.begin();
+  EXPECT_EQ(it, map.cbegin());
+}
+
+TEST(StaticFlatMap, Compare) {
+  const StaticFlatMap<int, int, 4> a{{1, 10}, {2, 20}};
+  const StaticFlatMap<int, int, 4> b{{2, 20}, {1, 10}};
+  const StaticFlatMap<int, int, 4> c{{1, 10}, {2, 21}};
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+}
+
+TEST(StaticFlatMap, swap) {
+  StaticFlatMap<int, int, 4> a{{1, 10}};
+  StaticFlatMap<int, int, 4> b{{2, 20}, {3, 30}};
+
+  swap(a, b);
+  EXPECT_THAT(a, ElementsAre(Pair(2, 20), Pair(3, 30)));
+  EXPECT_THAT(b, ElementsAre(Pair(1, 10)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticFlatSet.
+
+TEST(StaticFlatSet, Construct) {
+  // Default constructor.
+  {
+    const StaticFlatSet<int, 4> set;
+    EXPECT_TRUE(set.empty());
+  }
+
+  // Construct from an unsorted range with duplicates.
+  {
+    const std::vector<int> elements{3, 1, 2, 1, 3};
+    const StaticFlatSet<int, 5> set(elements.begin(), elements.end());
+    EXPECT_THAT(set, ElementsAre(1, 2, 3));
+  }
+
+  // The range does not fit.
+  {
+    using Set = StaticFlatSet<int, 2>;
+    EXPECT_THROW_OR_ABORT(Set({1, 2, 3}), std::length_error);
+  }
+}
+
+TEST(StaticFlatSet, insert) {
+  StaticFlatSet<int, 4> set;
+
+  EXPECT_TRUE(set.insert(2).second);
+  EXPECT_FALSE(set.insert(2).second);
+  EXPECT_TRUE(set.emplace(1).second);
+  EXPECT_THAT(set, ElementsAre(1, 2));
+
+  set.insert({4, 0, 2});
+  EXPECT_THAT(set, ElementsAre(0, 1, 2, 4));
+
+  EXPECT_THROW_OR_ABORT(set.insert(3), std::length_error);
+}
+
+TEST(StaticFlatSet, erase) {
+  StaticFlatSet<int, 4> set{1, 2, 3, 4};
+
+  EXPECT_EQ(*set.erase(set.find(2)), 3);
+  EXPECT_EQ(set.erase(3), 1);
+  EXPECT_EQ(set.erase(3), 0);
+  EXPECT_THAT(set, ElementsAre(1, 4));
+
+  EXPECT_EQ(erase_if(set, [](const int value) { return value > 2; }), 1);
+  EXPECT_THAT(set, ElementsAre(1));
+}
+
+TEST(StaticFlatSet, Lookup) {
+  const StaticFlatSet<StaticString<16>, 4> set{"foo", "bar", "baz"};
+
+  EXPECT_THAT(set, ElementsAre("bar", "baz", "foo"));
+
+  EXPECT_TRUE(set.contains("foo"));
+  EXPECT_TRUE(set.contains(CStringView("bar")));
+  EXPECT_FALSE(set.contains("qux"));
+  EXPECT_EQ(set.count("baz"), 1);
+
+  EXPECT_EQ(*set.lower_bound("bat"), "baz");
+  EXPECT_EQ(*set.upper_bound("baz"), "foo");
+  EXPECT_EQ(set.find("qux"), set.end());
+}
+
+}  // namespace tiny_lib::static_flat_map
@@ -0,0 +1,268 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_container/tl_static_hash_map.h"
+
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "tiny_lib/unittest/mock.h"
+#include "tiny_lib/unittest/test.h"
+#include "tl_string/tl_cstring_view.h"
+#include "tl_string/tl_static_string.h"
+
+namespace tiny_lib::static_hash_map {
+
+using cstring_view::CStringView;
+using static_string::StaticString;
+using testing::Pair;
+using testing::UnorderedElementsAre;
+
+// Hasher which makes all keys to collide, with the configurable home slot.
+// Allows to test long probe sequences and wrapping around the end of the table.
+struct CollidingHash {
+  auto operator()(const int /*key*/) const -> std::size_t {
+    return home_slot << 7;
+  }
+
+  std::size_t home_slot{0};
+};
+
+TEST(StaticHashMap, Construct) {
+  // Default constructor.
+  {
+    const StaticHashMap<int, std::string, 8> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.max_size(), 7);
+    EXPECT_EQ(map.bucket_count(), 8);
+  }
+
+  // Initializer list.
+  {
+    const StaticHashMap<int, std::string, 8> map{{1, "a"}, {2, "b"}, {1, "x"}};
+    EXPECT_THAT(map, UnorderedElementsAre(Pair(1, "a"), Pair(2, "b")));
+  }
+
+  // Copy constructor.
+  {
+    const StaticHashMap<int, std::string, 8> map{{1, "a"}, {2, "b"}};
+    const StaticHashMap<int, std::string, 8> map_copy(map);
+    EXPECT_THAT(map_copy, UnorderedElementsAre(Pair(1, "a"), Pair(2, "b")));
+    EXPECT_EQ(map_copy.at(2), "b");
+  }
+
+  // Move constructor.
+  {
+    StaticHashMap<int, std::string, 8> map{{1, "a"}, {2, "b"}};
+    const StaticHashMap<int, std::string, 8> map_copy(std::move(map));
+    EXPECT_THAT(map_copy, UnorderedElementsAre(Pair(1, "a"), Pair(2, "b")));
+    // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+    EXPECT_TRUE(map.empty());
+  }
+}
+
+TEST(StaticHashMap, Assign) {
+  const StaticHashMap<int, std::string, 8> map{{1, "a"}, {2, "b"}};
+
+  StaticHashMap<int, std::string, 8> map_copy{{3, "c"}};
+  map_copy = map;
+  EXPECT_THAT(map_copy, UnorderedElementsAre(Pair(1, "a"), Pair(2, "b")));
+
+  StaticHashMap<int, std::string, 8> map_move{{3, "c"}};
+  map_move = std::move(map_copy);
+  EXPECT_THAT(map_move, UnorderedElementsAre(Pair(1, "a"), Pair(2, "b")));
+}
+
+TEST(StaticHashMap, at) {
+  StaticHashMap<int, std::string, 8> map{{1, "a"}, {2, "b"}};
+
+  EXPECT_EQ(map.at(1), "a");
+  EXPECT_EQ(std::as_const(map).at(2), "b");
+  EXPECT_THROW_OR_ABORT(map.at(3), std::out_of_range);
+}
+
+TEST(StaticHashMap, operator_square_brackets) {
+  StaticHashMap<int, std::string, 8> map;
+
+  map[1] = "a";
+  map[2] = "b";
+  map[1] += "x";
+  EXPECT_THAT(map, UnorderedElementsAre(Pair(1, "ax"), Pair(2, "b")));
+}
+
+TEST(StaticHashMap, insert) {
+  StaticHashMap<int, std::string, 4> map;
+
+  {
+    const auto [it, inserted] = map.insert({1, "a"});
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(it->first, 1);
+    EXPECT_EQ(it->second, "a");
+  }
+
+  {
+    const auto [it, inserted] = map.insert({1, "x"});
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(it->second, "a");
+  }
+
+  EXPECT_TRUE(map.emplace(2, "b").second);
+  EXPECT_TRUE(map.try_emplace(3, 2, 'c').second);
+  EXPECT_FALSE(map.try_emplace(3, 2, 'x').second);
+  EXPECT_EQ(map.size(), map.max_size());
+
+  EXPECT_THROW_OR_ABORT(map.insert({4, "d"}), std::length_error);
+  EXPECT_THAT(
+      map, UnorderedElementsAre(Pair(1, "a"), Pair(2, "b"), Pair(3, "cc")));
+
+  // Inserting an existing key is possible when the map is full.
+  EXPECT_FALSE(map.insert_or_assign(2, "y").second);
+  EXPECT_EQ(map.at(2), "y");
+}
+
+TEST(StaticHashMap, erase) {
+  StaticHashMap<int, std::string, 8> map{{1, "a"}, {2, "b"}, {3, "c"}};
+
+  EXPECT_EQ(map.erase(2), 1);
+  EXPECT_EQ(map.erase(2), 0);
+  EXPECT_THAT(map, UnorderedElementsAre(Pair(1, "a"), Pair(3, "c")));
+
+  map.erase(map.find(1));
+  EXPECT_THAT(map, UnorderedElementsAre(Pair(3, "c")));
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(StaticHashMap, erase_if) {
+  StaticHashMap<int, int, 16> map;
+  for (int i = 0; i < 14; ++i) {
+    map[i] = i * 10;
+  }
+
+  EXPECT_EQ(erase_if(map, [](const auto& element) {
+              return element.first % 2 == 1;
+            }),
+            7);
+  EXPECT_EQ(map.size(), 7);
+  for (int i = 0; i < 14; ++i) {
+    EXPECT_EQ(map.contains(i), i % 2 == 0);
+  }
+}
+
+TEST(StaticHashMap, Collisions) {
+  // Cover all home slots, including the ones for which the probe sequence wraps
+  // around the end of the table.
+  for (std::size_t home_slot = 0; home_slot < 16; ++home_slot) {
+    StaticHashMap<int, int, 16, CollidingHash> map(CollidingHash{home_slot});
+
+    for (int i = 0; i < 14; ++i) {
+      map[i] = i;
+    }
+    EXPECT_EQ(map.size(), 14);
+
+    // Erase from the middle of the probe sequence, and verify the elements
+    // which follow are still reachable.
+    EXPECT_EQ(map.erase(3), 1);
+    EXPECT_EQ(map.erase(0), 1);
+    EXPECT_EQ(map.erase(13), 1);
+    for (int i = 0; i < 14; ++i) {
+      EXPECT_EQ(map.contains(i), i != 0 && i != 3 && i != 13);
+    }
+
+    map[100] = 100;
+    EXPECT_EQ(map.at(100), 100);
+    EXPECT_EQ(map.size(), 12);
+  }
+}
+
+TEST(StaticHashMap, SmallTable) {
+  // Table which is smaller than a group.
+  StaticHashMap<int, int, 2> map;
+  EXPECT_EQ(map.max_size(), 1);
+
+  map[7] = 70;
+  EXPECT_EQ(map.at(7), 70);
+  EXPECT_FALSE(map.contains(8));
+  EXPECT_THROW_OR_ABORT(map[8], std::length_error);
+
+  EXPECT_EQ(map.erase(7), 1);
+  map[8] = 80;
+  EXPECT_THAT(map, UnorderedElementsAre(Pair(8, 80)));
+}
+
+TEST(StaticHashMap, HeterogeneousLookup) {
+  // StaticString as key.
+  {
+    StaticHashMap<StaticString<32>, int, 8> map{
+        {"foo", 1}, {"bar", 2}, {"a somewhat longer key", 3}};
+
+    EXPECT_EQ(map.at("foo"), 1);
+    EXPECT_EQ(map.at(CStringView("bar")), 2);
+    EXPECT_TRUE(map.contains(std::string_view("a somewhat longer key")));
+    EXPECT_FALSE(map.contains("baz"));
+    EXPECT_EQ(map.erase("foo"), 1);
+    EXPECT_FALSE(map.contains("foo"));
+  }
+
+  // CStringView as key.
+  {
+    const StaticHashMap<CStringView, int, 8> map{{"foo", 1}, {"bar", 2}};
+
+    EXPECT_EQ(map.at(StaticString<8>("foo")), 1);
+    EXPECT_EQ(map.at(std::string("bar")), 2);
+  }
+}
+
+TEST(StaticHashMap, Compare) {
+  const StaticHashMap<int, int, 8> a{{1, 10}, {2, 20}};
+  const StaticHashMap<int, int, 8> b{{2, 20}, {1, 10}};
+  const StaticHashMap<int, int, 8> c{{1, 10}, {2, 21}};
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+}
+
+TEST(StaticHashMap, swap) {
+  StaticHashMap<int, int, 8> a{{1, 10}};
+  StaticHashMap<int, int, 8> b{{2, 20}, {3, 30}};
+
+  swap(a, b);
+  EXPECT_THAT(a, UnorderedElementsAre(Pair(2, 20), Pair(3, 30)));
+  EXPECT_THAT(b, UnorderedElementsAre(Pair(1, 10)));
+}
+
+TEST(StaticHashMap, Random) {
+  // Compare behavior against the std::map on a random sequence of operations.
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> key_distribution(0, 200);
+
+  StaticHashMap<int, int, 128> map;
+  std::map<int, int> reference;
+
+  for (int i = 0; i < 20000; ++i) {
+    const int key = key_distribution(rng);
+    if (rng() % 3 == 0 || reference.size() == map.max_size()) {
+      EXPECT_EQ(map.erase(key), reference.erase(key));
+    } else {
+      EXPECT_EQ(map.insert_or_assign(key, i).second,
+                reference.insert_or_assign(key, i).second);
+    }
+    ASSERT_EQ(map.size(), reference.size());
+  }
+
+  for (const auto& [key, value] : reference) {
+    EXPECT_EQ(map.at(key), value);
+  }
+  for (const auto& [key, value] : map) {
+    EXPECT_EQ(reference.at(key), value);
+  }
+}
+
+}  // namespace tiny_lib::static_hash_map
@@ -0,0 +1,170 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_container/tl_static_object_pool.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tiny_lib/unittest/mock.h"
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::static_object_pool {
+
+using testing::UnorderedElementsAre;
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticObjectPool.
+
+TEST(StaticObjectPool, CreateDestroy) {
+  StaticObjectPool<std::string, 2> pool;
+  EXPECT_TRUE(pool.IsEmpty());
+  EXPECT_EQ(pool.Capacity(), 2);
+
+  const Handle foo = pool.Create("foo");
+  const Handle bar = pool.Create(3, 'b');
+  EXPECT_TRUE(pool.IsFull());
+  EXPECT_EQ(pool.Size(), 2);
+
+  EXPECT_EQ(*pool.Get(foo), "foo");
+  EXPECT_EQ(*pool.Get(bar), "bbb");
+
+  EXPECT_THROW_OR_ABORT(pool.Create("baz"), std::length_error);
+
+  pool.Destroy(foo);
+  EXPECT_EQ(pool.Size(), 1);
+  EXPECT_EQ(pool.Get(foo), nullptr);
+  EXPECT_FALSE(pool.IsAlive(foo));
+
+  // The slot is reused, but the stale handle does not refer to the new object.
+  const Handle baz = pool.Create("baz");
+  EXPECT_EQ(baz.index, foo.index);
+  EXPECT_NE(baz, foo);
+  EXPECT_EQ(pool.Get(foo), nullptr);
+  EXPECT_EQ(*pool.Get(baz), "baz");
+
+  EXPECT_THROW_OR_ABORT(pool.Destroy(foo), std::invalid_argument);
+  EXPECT_THROW_OR_ABORT(pool.Destroy(Handle()), std::invalid_argument);
+}
+
+TEST(StaticObjectPool, Lifetime) {
+  auto object = std::make_shared<int>(1);
+
+  {
+    StaticObjectPool<std::shared_ptr<int>, 4> pool;
+
+    const Handle handle = pool.Create(object);
+    pool.Create(object);
+    EXPECT_EQ(object.use_count(), 3);
+
+    pool.Destroy(handle);
+    EXPECT_EQ(object.use_count(), 2);
+
+    pool.Create(object);
+    pool.Create(object);
+    EXPECT_EQ(object.use_count(), 4);
+
+    pool.Clear();
+    EXPECT_EQ(object.use_count(), 1);
+    EXPECT_FALSE(pool.IsAlive(handle));
+
+    pool.Create(object);
+  }
+
+  EXPECT_EQ(object.use_count(), 1);
+}
+
+TEST(StaticObjectPool, Iterate) {
+  StaticObjectPool<int, 8> pool;
+
+  std::vector<Handle> handles;
+  for (int i = 0; i < 6; ++i) {
+    handles.push_back(pool.Create(i));
+  }
+  pool.Destroy(handles[1]);
+  pool.Destroy(handles[4]);
+
+  EXPECT_THAT(pool, UnorderedElementsAre(0, 2, 3, 5));
+
+  for (int& value : pool) {
+    value *= 10;
+  }
+  EXPECT_EQ(*pool.Get(handles[3]), 30);
+
+  // Destroy objects found during iteration.
+  std::vector<Handle> to_destroy;
+  for (const int& value : pool) {
+    if (value >= 30) {
+      to_destroy.push_back(pool.GetHandle(value));
+    }
+  }
+  for (const Handle handle : to_destroy) {
+    pool.Destroy(handle);
+  }
+  EXPECT_THAT(pool, UnorderedElementsAre(0, 20));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ConcurrentStaticObjectPool.
+
+TEST(ConcurrentStaticObjectPool, CreateDestroy) {
+  ConcurrentStaticObjectPool<std::string, 2> pool;
+
+  const Handle foo = pool.Create("foo");
+  const Handle bar = pool.Create(3, 'b');
+  EXPECT_EQ(pool.Size(), 2);
+
+  EXPECT_EQ(*pool.Get(foo), "foo");
+  EXPECT_EQ(*pool.Get(bar), "bbb");
+
+  EXPECT_THROW_OR_ABORT(pool.Create("baz"), std::length_error);
+
+  pool.Destroy(foo);
+  EXPECT_EQ(pool.Get(foo), nullptr);
+
+  const Handle baz = pool.Create("baz");
+  EXPECT_EQ(baz.index, foo.index);
+  EXPECT_EQ(pool.Get(foo), nullptr);
+  EXPECT_EQ(*pool.Get(baz), "baz");
+
+  EXPECT_THROW_OR_ABORT(pool.Destroy(foo), std::invalid_argument);
+  EXPECT_THROW_OR_ABORT(pool.Destroy(Handle()), std::invalid_argument);
+}
+
+TEST(ConcurrentStaticObjectPool, Threaded) {
+  constexpr int kNumThreads = 4;
+  constexpr int kNumIterations = 20000;
+
+  ConcurrentStaticObjectPool<int, 16> pool;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&pool, t]() {
+      for (int i = 0; i < kNumIterations; ++i) {
+        const int value = t * kNumIterations + i;
+        const Handle first = pool.Create(value);
+        const Handle second = pool.Create(-value);
+
+        // Every thread holds at most two slots at a time, so no other thread
+        // could have modified them.
+        EXPECT_EQ(*pool.Get(first), value);
+        EXPECT_EQ(*pool.Get(second), -value);
+
+        pool.Destroy(first);
+        pool.Destroy(second);
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(pool.Size(), 0);
+}
+
+}  // namespace tiny_lib::static_object_pool
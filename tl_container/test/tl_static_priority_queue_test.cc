@@ -0,0 +1,124 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_container/tl_static_priority_queue.h"
+
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tiny_lib/unittest/mock.h"
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::static_priority_queue {
+
+// Pop all elements from the queue, in the order of their priority.
+template <class Queue>
+static auto PopAll(Queue& queue) -> std::vector<typename Queue::value_type> {
+  std::vector<typename Queue::value_type> result;
+  while (!queue.empty()) {
+    result.push_back(queue.top());
+    queue.pop();
+  }
+  return result;
+}
+
+TEST(StaticPriorityQueue, Construct) {
+  // Default constructor.
+  {
+    const StaticPriorityQueue<int, 8> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.size(), 0);
+    EXPECT_EQ(queue.max_size(), 8);
+  }
+
+  // Initializer list.
+  {
+    StaticPriorityQueue<int, 16> queue{5, 1, 9, 3, 7, 2, 8, 6, 4, 0};
+    EXPECT_EQ(queue.top(), 9);
+    EXPECT_THAT(PopAll(queue),
+                testing::ElementsAre(9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+  }
+
+  // Range with a custom comparator.
+  {
+    const std::vector<int> values{5, 1, 9, 3};
+    StaticPriorityQueue<int, 8, std::greater<>> queue(values.begin(),
+                                                      values.end());
+    EXPECT_EQ(queue.top(), 1);
+    EXPECT_THAT(PopAll(queue), testing::ElementsAre(1, 3, 5, 9));
+  }
+
+  EXPECT_THROW_OR_ABORT((StaticPriorityQueue<int, 2>{1, 2, 3}),
+                        std::length_error);
+}
+
+TEST(StaticPriorityQueue, push) {
+  StaticPriorityQueue<std::string, 4> queue;
+
+  queue.push("b");
+  const std::string d = "d";
+  queue.push(d);
+  queue.emplace(1, 'a');
+  queue.emplace("c");
+  EXPECT_EQ(queue.size(), 4);
+  EXPECT_EQ(queue.top(), "d");
+
+  EXPECT_THROW_OR_ABORT(queue.push("e"), std::length_error);
+
+  EXPECT_THAT(PopAll(queue), testing::ElementsAre("d", "c", "b", "a"));
+}
+
+TEST(StaticPriorityQueue, clear) {
+  StaticPriorityQueue<int, 4> queue{1, 2, 3};
+
+  queue.clear();
+  EXPECT_TRUE(queue.empty());
+
+  queue.push(4);
+  EXPECT_EQ(queue.top(), 4);
+}
+
+TEST(StaticPriorityQueue, swap) {
+  StaticPriorityQueue<int, 4> a{1, 2};
+  StaticPriorityQueue<int, 4> b{3, 4, 5};
+
+  swap(a, b);
+  EXPECT_THAT(PopAll(a), testing::ElementsAre(5, 4, 3));
+  EXPECT_THAT(PopAll(b), testing::ElementsAre(2, 1));
+}
+
+TEST(StaticPriorityQueue, Random) {
+  // Compare behavior against the std::priority_queue on a random sequence of
+  // operations.
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> value_distribution(0, 1000);
+
+  StaticPriorityQueue<int, 256> queue;
+  std::priority_queue<int> reference;
+
+  for (int i = 0; i < 20000; ++i) {
+    if (!reference.empty() && (rng() % 3 == 0 || reference.size() == 256)) {
+      ASSERT_EQ(queue.top(), reference.top());
+      queue.pop();
+      reference.pop();
+    } else {
+      const int value = value_distribution(rng);
+      queue.push(value);
+      reference.push(value);
+    }
+    ASSERT_EQ(queue.size(), reference.size());
+  }
+
+  while (!reference.empty()) {
+    ASSERT_EQ(queue.top(), reference.top());
+    queue.pop();
+    reference.pop();
+  }
+}
+
+}  // namespace tiny_lib::static_priority_queue
@@ -0,0 +1,449 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_container/tl_static_ring_buffer.h"
+
+#include <array>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tiny_lib/unittest/mock.h"
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::static_ring_buffer {
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+// Type which counts its alive instances, and throws from the copy constructor
+// when copied from a negative value.
+class Counted {
+ public:
+  static inline int num_alive = 0;
+
+  Counted() { ++num_alive; }
+  explicit Counted(const int value) : value_(value) { ++num_alive; }
+
+  Counted(const Counted& other) : value_(other.value_) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+    if (value_ < 0) {
+      throw std::runtime_error("Negative value");
+    }
+#endif
+    ++num_alive;
+  }
+  Counted(Counted&& other) noexcept : value_(other.value_) { ++num_alive; }
+
+  ~Counted() { --num_alive; }
+
+  auto operator=(const Counted& other) -> Counted& = default;
+  auto operator=(Counted&& other) -> Counted& {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+    if (other.value_ < 0) {
+      throw std::runtime_error("Negative value");
+    }
+#endif
+    value_ = other.value_;
+    return *this;
+  }
+
+  auto GetValue() const -> int { return value_; }
+
+ private:
+  int value_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticRingBuffer.
+
+TEST(StaticRingBuffer, Construct) {
+  // Default constructor.
+  {
+    StaticRingBuffer<int, 4> buffer;
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.size(), 0);
+    EXPECT_EQ(buffer.capacity(), 4);
+  }
+
+  // Copy constructor.
+  {
+    StaticRingBuffer<std::string, 4> buffer;
+    buffer.push_back("foo");
+    buffer.push_back("bar");
+
+    const StaticRingBuffer<std::string, 4> buffer_copy(buffer);
+    EXPECT_THAT(buffer_copy, ElementsAre("foo", "bar"));
+    EXPECT_THAT(buffer, ElementsAre("foo", "bar"));
+  }
+
+  // Move constructor.
+  {
+    StaticRingBuffer<std::string, 4> buffer;
+    buffer.push_back("foo");
+    buffer.push_back("bar");
+
+    const StaticRingBuffer<std::string, 4> buffer_copy(std::move(buffer));
+    EXPECT_THAT(buffer_copy, ElementsAre("foo", "bar"));
+    // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+    EXPECT_TRUE(buffer.empty());
+  }
+}
+
+TEST(StaticRingBuffer, Assign) {
+  StaticRingBuffer<std::string, 4> buffer;
+  buffer.push_back("foo");
+  buffer.push_back("bar");
+
+  // Copy assignment.
+  {
+    StaticRingBuffer<std::string, 4> buffer_copy;
+    buffer_copy.push_back("baz");
+    buffer_copy = buffer;
+    EXPECT_THAT(buffer_copy, ElementsAre("foo", "bar"));
+  }
+
+  // Move assignment.
+  {
+    StaticRingBuffer<std::string, 4> buffer_copy;
+    buffer_copy.push_back("baz");
+    buffer_copy = std::move(buffer);
+    EXPECT_THAT(buffer_copy, ElementsAre("foo", "bar"));
+    // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+    EXPECT_TRUE(buffer.empty());
+  }
+}
+
+TEST(StaticRingBuffer, push_back) {
+  StaticRingBuffer<int, 4> buffer;
+
+  buffer.push_back(1);
+  buffer.push_back(2);
+  buffer.push_back(3);
+  buffer.push_back(4);
+  EXPECT_TRUE(buffer.full());
+  EXPECT_THAT(buffer, ElementsAre(1, 2, 3, 4));
+
+  EXPECT_THROW_OR_ABORT(buffer.push_back(5), std::length_error);
+  EXPECT_THAT(buffer, ElementsAre(1, 2, 3, 4));
+}
+
+TEST(StaticRingBuffer, emplace_back) {
+  StaticRingBuffer<std::string, 2> buffer;
+
+  EXPECT_EQ(buffer.emplace_back(3, 'a'), "aaa");
+  EXPECT_EQ(buffer.emplace_back("foo"), "foo");
+  EXPECT_THAT(buffer, ElementsAre("aaa", "foo"));
+
+  EXPECT_THROW_OR_ABORT(buffer.emplace_back("bar"), std::length_error);
+}
+
+TEST(StaticRingBuffer, pop_front) {
+  StaticRingBuffer<std::string, 4> buffer;
+
+  // Push and pop more elements than the capacity, so that the positions wrap
+  // around the storage.
+  for (int i = 0; i < 10; ++i) {
+    buffer.push_back(std::to_string(i));
+    buffer.push_back(std::to_string(i + 100));
+    EXPECT_EQ(buffer.front(), std::to_string(i));
+    EXPECT_EQ(buffer.back(), std::to_string(i + 100));
+    buffer.pop_front();
+    buffer.pop_front();
+    EXPECT_TRUE(buffer.empty());
+  }
+
+  buffer.push_back("foo");
+  buffer.push_back("bar");
+  buffer.pop_front();
+  EXPECT_THAT(buffer, ElementsAre("bar"));
+}
+
+TEST(StaticRingBuffer, ElementAccess) {
+  StaticRingBuffer<int, 4> buffer;
+  buffer.push_back(0);
+  buffer.push_back(0);
+  buffer.pop_front();
+  buffer.pop_front();
+
+  buffer.push_back(1);
+  buffer.push_back(2);
+  buffer.push_back(3);
+
+  EXPECT_EQ(buffer[0], 1);
+  EXPECT_EQ(buffer[1], 2);
+  EXPECT_EQ(buffer[2], 3);
+
+  EXPECT_EQ(buffer.at(0), 1);
+  EXPECT_EQ(buffer.at(2), 3);
+  EXPECT_THROW_OR_ABORT(buffer.at(3), std::out_of_range);
+
+  EXPECT_EQ(buffer.front(), 1);
+  EXPECT_EQ(buffer.back(), 3);
+}
+
+TEST(StaticRingBuffer, array_one_two) {
+  StaticRingBuffer<int, 4> buffer;
+
+  EXPECT_THAT(buffer.array_one(), IsEmpty());
+  EXPECT_THAT(buffer.array_two(), IsEmpty());
+
+  buffer.push_back(1);
+  buffer.push_back(2);
+  EXPECT_THAT(buffer.array_one(), ElementsAre(1, 2));
+  EXPECT_THAT(buffer.array_two(), IsEmpty());
+
+  // Make the elements to wrap around the end of the storage.
+  buffer.push_back(3);
+  buffer.pop_front();
+  buffer.pop_front();
+  buffer.push_back(4);
+  buffer.push_back(5);
+  buffer.push_back(6);
+  EXPECT_THAT(buffer.array_one(), ElementsAre(3, 4));
+  EXPECT_THAT(buffer.array_two(), ElementsAre(5, 6));
+}
+
+TEST(StaticRingBuffer, write_read) {
+  StaticRingBuffer<int, 8> buffer;
+
+  const std::array<int, 6> input{1, 2, 3, 4, 5, 6};
+  std::array<int, 6> output{};
+
+  EXPECT_EQ(buffer.write(input), 6);
+  EXPECT_EQ(buffer.read(std::span(output).first(4)), 4);
+  EXPECT_THAT(output, ElementsAre(1, 2, 3, 4, 0, 0));
+
+  // Write which wraps around the end of the storage and is truncated to the
+  // available space.
+  EXPECT_EQ(buffer.write(input), 6);
+  EXPECT_EQ(buffer.write(input), 0);
+  EXPECT_TRUE(buffer.full());
+  EXPECT_THAT(buffer, ElementsAre(5, 6, 1, 2, 3, 4, 5, 6));
+
+  // Read which wraps around the end of the storage.
+  EXPECT_EQ(buffer.read(output), 6);
+  EXPECT_THAT(output, ElementsAre(5, 6, 1, 2, 3, 4));
+  EXPECT_EQ(buffer.read(output), 2);
+  EXPECT_THAT(output, ElementsAre(5, 6, 1, 2, 3, 4));
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(StaticRingBuffer, write_read_non_trivial) {
+  StaticRingBuffer<std::string, 4> buffer;
+
+  const std::array<std::string, 3> input{"foo", "bar", "baz"};
+  std::array<std::string, 3> output;
+
+  EXPECT_EQ(buffer.write(input), 3);
+  EXPECT_EQ(buffer.read(std::span(output).first(2)), 2);
+  EXPECT_THAT(output, ElementsAre("foo", "bar", ""));
+
+  EXPECT_EQ(buffer.write(input), 3);
+  EXPECT_THAT(buffer, ElementsAre("baz", "foo", "bar", "baz"));
+
+  EXPECT_EQ(buffer.read(output), 3);
+  EXPECT_THAT(output, ElementsAre("baz", "foo", "bar"));
+  EXPECT_THAT(buffer, ElementsAre("baz"));
+}
+
+TEST(StaticRingBuffer, write_exception) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  {
+    StaticRingBuffer<Counted, 4> buffer;
+
+    // Move the tail close to the end of the storage, so that the write wraps
+    // around.
+    for (int i = 0; i < 3; ++i) {
+      buffer.emplace_back(i);
+      buffer.pop_front();
+    }
+    EXPECT_EQ(Counted::num_alive, 0);
+
+    // The copy of the last element throws after one element has been copied to
+    // each of the regions.
+    const std::array<Counted, 3> input{Counted(1), Counted(2), Counted(-1)};
+    EXPECT_THROW(buffer.write(input), std::runtime_error);
+
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(Counted::num_alive, 3);
+  }
+  EXPECT_EQ(Counted::num_alive, 0);
+#endif
+}
+
+TEST(StaticRingBuffer, read_exception) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  {
+    StaticRingBuffer<Counted, 4> buffer;
+
+    // Move the head close to the end of the storage, so that the read wraps
+    // around.
+    for (int i = 0; i < 3; ++i) {
+      buffer.emplace_back(i);
+      buffer.pop_front();
+    }
+    buffer.emplace_back(1);
+    buffer.emplace_back(-1);
+    buffer.emplace_back(3);
+    EXPECT_EQ(Counted::num_alive, 3);
+
+    // The move of the second element throws after the first element has been
+    // moved. None of the elements is removed from the buffer.
+    std::array<Counted, 3> output;
+    EXPECT_THROW(buffer.read(output), std::runtime_error);
+
+    EXPECT_EQ(buffer.size(), 3);
+    EXPECT_EQ(Counted::num_alive, 6);
+  }
+  EXPECT_EQ(Counted::num_alive, 0);
+#endif
+}
+
+TEST(StaticRingBuffer, clear) {
+  StaticRingBuffer<std::string, 4> buffer;
+  buffer.push_back("foo");
+  buffer.push_back("bar");
+
+  buffer.clear();
+  EXPECT_TRUE(buffer.empty());
+
+  buffer.push_back("baz");
+  EXPECT_THAT(buffer, ElementsAre("baz"));
+}
+
+TEST(StaticRingBuffer, swap) {
+  StaticRingBuffer<std::string, 4> a;
+  a.push_back("foo");
+
+  StaticRingBuffer<std::string, 4> b;
+  b.push_back("bar");
+  b.push_back("baz");
+
+  swap(a, b);
+  EXPECT_THAT(a, ElementsAre("bar", "baz"));
+  EXPECT_THAT(b, ElementsAre("foo"));
+}
+
+TEST(StaticRingBuffer, Iterator) {
+  StaticRingBuffer<int, 4> buffer;
+  buffer.push_back(0);
+  buffer.pop_front();
+  buffer.push_back(1);
+  buffer.push_back(2);
+  buffer.push_back(3);
+  buffer.push_back(4);
+
+  EXPECT_EQ(buffer.end() - buffer.begin(), 4);
+  EXPECT_EQ(buffer.begin()[3], 4);
+  EXPECT_EQ(std::accumulate(buffer.cbegin(), buffer.cend(), 0), 10);
+
+  for (int& value : buffer) {
+    value *= 2;
+  }
+  EXPECT_THAT(buffer, ElementsAre(2, 4, 6, 8));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticSPSCRingBuffer.
+
+TEST(StaticSPSCRingBuffer, try_push_pop) {
+  StaticSPSCRingBuffer<std::string, 2> buffer;
+  std::string value;
+
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_FALSE(buffer.try_pop(value));
+
+  EXPECT_TRUE(buffer.try_push("foo"));
+  EXPECT_TRUE(buffer.try_emplace(3, 'a'));
+  EXPECT_FALSE(buffer.try_push("bar"));
+  EXPECT_EQ(buffer.size(), 2);
+
+  EXPECT_TRUE(buffer.try_pop(value));
+  EXPECT_EQ(value, "foo");
+  EXPECT_TRUE(buffer.try_push("bar"));
+
+  EXPECT_TRUE(buffer.try_pop(value));
+  EXPECT_EQ(value, "aaa");
+  EXPECT_TRUE(buffer.try_pop(value));
+  EXPECT_EQ(value, "bar");
+  EXPECT_FALSE(buffer.try_pop(value));
+}
+
+TEST(StaticSPSCRingBuffer, write_read) {
+  StaticSPSCRingBuffer<int, 8> buffer;
+
+  const std::array<int, 6> input{1, 2, 3, 4, 5, 6};
+  std::array<int, 6> output{};
+
+  EXPECT_EQ(buffer.write(input), 6);
+  EXPECT_EQ(buffer.read(std::span(output).first(4)), 4);
+  EXPECT_THAT(output, ElementsAre(1, 2, 3, 4, 0, 0));
+
+  EXPECT_EQ(buffer.write(input), 6);
+  EXPECT_EQ(buffer.write(input), 0);
+  EXPECT_EQ(buffer.size(), 8);
+
+  EXPECT_EQ(buffer.read(output), 6);
+  EXPECT_THAT(output, ElementsAre(5, 6, 1, 2, 3, 4));
+  EXPECT_EQ(buffer.read(output), 2);
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(StaticSPSCRingBuffer, Threaded) {
+  constexpr int kNumValues = 10000;
+
+  StaticSPSCRingBuffer<int, 64> buffer;
+
+  std::thread producer([&buffer]() {
+    std::array<int, 7> chunk;
+    int next_value = 0;
+    while (next_value < kNumValues) {
+      // Alternate between single element and bulk transfers.
+      if (next_value % 2) {
+        if (buffer.try_push(next_value)) {
+          ++next_value;
+        } else {
+          std::this_thread::yield();
+        }
+        continue;
+      }
+      const int num_values =
+          std::min<int>(chunk.size(), kNumValues - next_value);
+      std::iota(chunk.begin(), chunk.begin() + num_values, next_value);
+      const int num_written =
+          int(buffer.write(std::span(chunk).first(num_values)));
+      if (num_written == 0) {
+        std::this_thread::yield();
+      }
+      next_value += num_written;
+    }
+  });
+
+  std::vector<int> received;
+  received.reserve(kNumValues);
+  std::array<int, 5> chunk;
+  while (received.size() < kNumValues) {
+    int value;
+    const bool popped = buffer.try_pop(value);
+    if (popped) {
+      received.push_back(value);
+    }
+    const size_t num_read = buffer.read(chunk);
+    received.insert(received.end(), chunk.begin(), chunk.begin() + num_read);
+    if (!popped && num_read == 0) {
+      std::this_thread::yield();
+    }
+  }
+
+  producer.join();
+
+  std::vector<int> expected(kNumValues);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(received, expected);
+}
+
+}  // namespace tiny_lib::static_ring_buffer
@@ -0,0 +1,286 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_container/tl_static_soa_vector.h"
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "tiny_lib/unittest/mock.h"
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::static_soa_vector {
+
+using testing::ElementsAre;
+using testing::UnorderedElementsAre;
+
+using Vector = StaticSoAVector<8, int, std::string>;
+
+// Type which counts its alive instances, and throws from the constructor when
+// constructed from a negative value.
+class Counted {
+ public:
+  static inline int num_alive = 0;
+
+  explicit Counted(const int value) : value_(value) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+    if (value < 0) {
+      throw std::runtime_error("Negative value");
+    }
+#endif
+    ++num_alive;
+  }
+
+  Counted(const Counted& other) : value_(other.value_) { ++num_alive; }
+  Counted(Counted&& other) noexcept : value_(other.value_) { ++num_alive; }
+
+  ~Counted() { --num_alive; }
+
+  auto operator=(const Counted& other) -> Counted& = default;
+  auto operator=(Counted&& other) noexcept -> Counted& = default;
+
+  auto GetValue() const -> int { return value_; }
+
+ private:
+  int value_;
+};
+
+static auto IsAligned(const void* pointer, const size_t alignment) -> bool {
+  return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+TEST(StaticSoAVector, Construct) {
+  // Default constructor.
+  {
+    const Vector vector;
+    EXPECT_TRUE(vector.empty());
+    EXPECT_EQ(vector.size(), 0);
+    EXPECT_EQ(vector.max_size(), 8);
+  }
+
+  // Initializer list.
+  {
+    const Vector vector{{1, "a"}, {2, "b"}};
+    EXPECT_THAT(vector, ElementsAre(std::tuple(1, "a"), std::tuple(2, "b")));
+  }
+
+  // Copy constructor.
+  {
+    const Vector vector{{1, "a"}, {2, "b"}};
+    const Vector vector_copy(vector);
+    EXPECT_THAT(vector_copy,
+                ElementsAre(std::tuple(1, "a"), std::tuple(2, "b")));
+  }
+
+  // Move constructor.
+  {
+    Vector vector{{1, "a"}, {2, "b"}};
+    const Vector vector_copy(std::move(vector));
+    EXPECT_THAT(vector_copy,
+                ElementsAre(std::tuple(1, "a"), std::tuple(2, "b")));
+    // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+    EXPECT_TRUE(vector.empty());
+  }
+}
+
+TEST(StaticSoAVector, Assign) {
+  const Vector vector{{1, "a"}, {2, "b"}};
+
+  Vector vector_copy{{3, "c"}};
+  vector_copy = vector;
+  EXPECT_THAT(vector_copy, ElementsAre(std::tuple(1, "a"), std::tuple(2, "b")));
+
+  Vector vector_move{{3, "c"}};
+  vector_move = std::move(vector_copy);
+  EXPECT_THAT(vector_move, ElementsAre(std::tuple(1, "a"), std::tuple(2, "b")));
+}
+
+TEST(StaticSoAVector, ElementAccess) {
+  Vector vector{{1, "a"}, {2, "b"}, {3, "c"}};
+
+  EXPECT_EQ(vector[1], std::tuple(2, "b"));
+  EXPECT_EQ(vector.at(2), std::tuple(3, "c"));
+  EXPECT_EQ(std::as_const(vector).at(0), std::tuple(1, "a"));
+  EXPECT_THROW_OR_ABORT(vector.at(3), std::out_of_range);
+
+  EXPECT_EQ(vector.front(), std::tuple(1, "a"));
+  EXPECT_EQ(vector.back(), std::tuple(3, "c"));
+
+  auto [number, letter] = vector[1];
+  number = 20;
+  letter = "x";
+  EXPECT_EQ(vector[1], std::tuple(20, "x"));
+}
+
+TEST(StaticSoAVector, column) {
+  StaticSoAVector<16, uint8_t, double, float> vector;
+  for (int i = 0; i < 10; ++i) {
+    vector.emplace_back(i, i * 2.0, i * 3.0f);
+  }
+
+  const std::span<uint8_t> bytes = vector.column<0>();
+  const std::span<double> doubles = vector.column<1>();
+  const std::span<const float> floats = std::as_const(vector).column<2>();
+
+  EXPECT_EQ(bytes.size(), 10);
+  EXPECT_EQ(doubles.size(), 10);
+  EXPECT_EQ(floats.size(), 10);
+
+  EXPECT_TRUE(IsAligned(bytes.data(), 64));
+  EXPECT_TRUE(IsAligned(doubles.data(), 64));
+  EXPECT_TRUE(IsAligned(floats.data(), 64));
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(bytes[i], i);
+    EXPECT_EQ(doubles[i], i * 2.0);
+    EXPECT_EQ(floats[i], i * 3.0f);
+  }
+
+  // Modification via column is visible in the element access.
+  for (double& value : doubles) {
+    value += 1;
+  }
+  EXPECT_EQ(std::get<1>(vector[4]), 9.0);
+}
+
+TEST(StaticSoAVector, Iterator) {
+  Vector vector{{1, "a"}, {2, "b"}, {3, "c"}};
+
+  for (auto [number, letter] : vector) {
+    number *= 10;
+    letter += letter;
+  }
+  EXPECT_THAT(vector,
+              ElementsAre(std::tuple(10, "aa"),
+                          std::tuple(20, "bb"),
+                          std::tuple(30, "cc")));
+
+  EXPECT_EQ(vector.end() - vector.begin(), 3);
+  EXPECT_EQ(vector.begin()[2], std::tuple(30, "cc"));
+  EXPECT_EQ(*(vector.cbegin() + 1), std::tuple(20, "bb"));
+}
+
+TEST(StaticSoAVector, push_back) {
+  StaticSoAVector<2, int, std::string> vector;
+
+  vector.push_back({1, "a"});
+  const std::tuple<int, std::string> element(2, "b");
+  vector.push_back(element);
+  EXPECT_THAT(vector, ElementsAre(std::tuple(1, "a"), std::tuple(2, "b")));
+
+  EXPECT_THROW_OR_ABORT(vector.push_back({3, "c"}), std::length_error);
+  EXPECT_EQ(vector.size(), 2);
+
+  vector.pop_back();
+  EXPECT_THAT(vector, ElementsAre(std::tuple(1, "a")));
+
+  auto [number, letter] = vector.emplace_back(4, std::string(3, 'x'));
+  EXPECT_EQ(number, 4);
+  EXPECT_EQ(letter, "xxx");
+}
+
+TEST(StaticSoAVector, erase) {
+  Vector vector{{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}};
+
+  // Erase from the middle: the last element takes place of the erased one.
+  auto it = vector.erase(vector.begin() + 1);
+  EXPECT_EQ(*it, std::tuple(4, "d"));
+  EXPECT_THAT(vector,
+              ElementsAre(std::tuple(1, "a"),
+                          std::tuple(4, "d"),
+                          std::tuple(3, "c")));
+
+  // Erase the last element.
+  it = vector.erase(vector.begin() + 2);
+  EXPECT_EQ(it, vector.end());
+  EXPECT_THAT(vector, ElementsAre(std::tuple(1, "a"), std::tuple(4, "d")));
+}
+
+TEST(StaticSoAVector, erase_if) {
+  StaticSoAVector<16, int, float> vector;
+  for (int i = 0; i < 10; ++i) {
+    vector.emplace_back(i, float(i));
+  }
+
+  EXPECT_EQ(erase_if(vector,
+                     [](const auto& element) {
+                       return std::get<0>(element) % 3 == 0;
+                     }),
+            4);
+  EXPECT_THAT(vector.column<0>(), UnorderedElementsAre(1, 2, 4, 5, 7, 8));
+}
+
+TEST(StaticSoAVector, resize) {
+  Vector vector{{1, "a"}};
+
+  vector.resize(3);
+  EXPECT_THAT(vector,
+              ElementsAre(std::tuple(1, "a"),
+                          std::tuple(0, ""),
+                          std::tuple(0, "")));
+
+  vector.resize(1);
+  EXPECT_THAT(vector, ElementsAre(std::tuple(1, "a")));
+
+  EXPECT_THROW_OR_ABORT(vector.resize(9), std::length_error);
+}
+
+TEST(StaticSoAVector, swap) {
+  Vector a{{1, "a"}};
+  Vector b{{2, "b"}, {3, "c"}, {4, "d"}};
+
+  swap(a, b);
+  EXPECT_THAT(a,
+              ElementsAre(std::tuple(2, "b"),
+                          std::tuple(3, "c"),
+                          std::tuple(4, "d")));
+  EXPECT_THAT(b, ElementsAre(std::tuple(1, "a")));
+
+  a.swap(b);
+  EXPECT_THAT(a, ElementsAre(std::tuple(1, "a")));
+  EXPECT_THAT(b,
+              ElementsAre(std::tuple(2, "b"),
+                          std::tuple(3, "c"),
+                          std::tuple(4, "d")));
+}
+
+TEST(StaticSoAVector, Compare) {
+  const Vector a{{1, "a"}, {2, "b"}};
+  const Vector b{{1, "a"}, {2, "b"}};
+  const Vector c{{1, "a"}, {2, "x"}};
+  const StaticSoAVector<4, int, std::string> d{{1, "a"}, {2, "b"}};
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_EQ(a, d);
+}
+
+TEST(StaticSoAVector, Lifetime) {
+  {
+    StaticSoAVector<4, Counted, Counted> vector;
+
+    vector.emplace_back(1, 2);
+    vector.emplace_back(3, 4);
+    EXPECT_EQ(Counted::num_alive, 4);
+
+    vector.erase(vector.begin());
+    EXPECT_EQ(Counted::num_alive, 2);
+    EXPECT_EQ(std::get<0>(vector[0]).GetValue(), 3);
+
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+    // Construction of the second field throws: the first field is destroyed
+    // and the container is not modified.
+    EXPECT_THROW(vector.emplace_back(5, -1), std::runtime_error);
+    EXPECT_EQ(Counted::num_alive, 2);
+    EXPECT_EQ(vector.size(), 1);
+#endif
+  }
+
+  EXPECT_EQ(Counted::num_alive, 0);
+}
+
+}  // namespace tiny_lib::static_soa_vector
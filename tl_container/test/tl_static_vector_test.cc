@@ -5,6 +5,7 @@
 #include "tl_container/tl_static_vector.h"
 
 #include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -684,6 +685,43 @@ TEST(StaticVector, erase_if) {
   EXPECT_THAT(vec, ElementsAre(1, 5, 7, 9));
 }
 
+TEST(StaticVector, TriviallyCopyable) {
+  using Vector = StaticVector<int, 10>;
+
+  Vector vec{1, 2, 3, 4, 5};
+
+  vec.insert(vec.begin() + 1, {10, 11});
+  EXPECT_THAT(vec, ElementsAre(1, 10, 11, 2, 3, 4, 5));
+
+  vec.erase(vec.begin(), vec.begin() + 2);
+  EXPECT_THAT(vec, ElementsAre(11, 2, 3, 4, 5));
+
+  const Vector vec_copy(vec);
+  EXPECT_THAT(vec_copy, ElementsAre(11, 2, 3, 4, 5));
+
+  Vector vec_move(std::move(vec));
+  EXPECT_THAT(vec_move, ElementsAre(11, 2, 3, 4, 5));
+
+  Vector other{7};
+  vec_move.swap(other);
+  EXPECT_THAT(vec_move, ElementsAre(7));
+  EXPECT_THAT(other, ElementsAre(11, 2, 3, 4, 5));
+}
+
+TEST(StaticVector, Alignment) {
+  struct alignas(32) Aligned {
+    int value;
+  };
+
+  struct {
+    char padding;
+    StaticVector<Aligned, 4> vec;
+  } holder;
+
+  holder.vec.push_back({1});
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(holder.vec.data()) % 32, 0);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Maintenance.
 
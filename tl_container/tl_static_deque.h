@@ -0,0 +1,643 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A fixed capacity double-ended queue.
+//
+// StaticDeque implements the most commonly used parts of the C++ std::deque API
+// and uses in-object storage of a static size. No allocations will be performed
+// by the deque.
+//
+// The elements are stored in a ring: the deque keeps the index of its first
+// element in the storage and the number of elements, and the logical index is
+// mapped to the storage index with a wrap-around. This makes insertion and
+// removal at both ends constant time operations which never move elements.
+// Unlike StaticRingBuffer the capacity is not required to be a power of two.
+//
+// Moving a deque copies the bytes of its elements when the
+// IsTriviallyRelocatable<T> trait of the tl_static_vector library is true, and
+// copying a deque uses memcpy when T is trivially copyable.
+//
+//
+// Exceptions
+// ==========
+//
+// The deque follows the same exception policy as the StaticVector. The errors
+// are reported via TL_STATIC_DEQUE_THROW_IF, which the application can define
+// prior to including this header.
+//
+// General notes on exceptions:
+//
+//  - If an exception is thrown for any reason, functions have effect (strong
+//    exception guarantee).
+//
+//  - If an operation would result in size() > max_size(), an std::length_error
+//    exception is throw.
+//
+//  - If at() is called with an out of bounds index, an std::out_of_range
+//    exception is throw.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "tl_static_vector.h"
+
+// Semantic version of the tl_static_deque library.
+#define TL_STATIC_DEQUE_VERSION_MAJOR 0
+#define TL_STATIC_DEQUE_VERSION_MINOR 0
+#define TL_STATIC_DEQUE_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_DEQUE_NAMESPACE
+#  define TL_STATIC_DEQUE_NAMESPACE tiny_lib::static_deque
+#endif
+
+// Namespace in which the StaticVector is defined.
+// Is to be defined when the tl_static_vector library is configured to use a
+// non-default namespace.
+#ifndef TL_STATIC_DEQUE_STATIC_VECTOR_NAMESPACE
+#  define TL_STATIC_DEQUE_STATIC_VECTOR_NAMESPACE tiny_lib::static_vector
+#endif
+
+// Helpers for TL_STATIC_DEQUE_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_DEQUE_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)         \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_DEQUE_VERSION_NAMESPACE_CONCAT(id1, id2, id3)                \
+  TL_STATIC_DEQUE_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_DEQUE_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_DEQUE_VERSION_NAMESPACE                                      \
+  TL_STATIC_DEQUE_VERSION_NAMESPACE_CONCAT(TL_STATIC_DEQUE_VERSION_MAJOR,      \
+                                           TL_STATIC_DEQUE_VERSION_MINOR,      \
+                                           TL_STATIC_DEQUE_VERSION_REVISION)
+
+// Throw an exception of the given type ExceptionType if the expression is
+// evaluated to a truthful value.
+// The default implementation throws an ExceptionType(#expression) if the
+// condition is met.
+// If the default behavior is not suitable for the application it should define
+// TL_STATIC_DEQUE_THROW_IF prior to including this header. The provided
+// implementation is not to return, otherwise an undefined behavior of memory
+// corruption will happen.
+#if !defined(TL_STATIC_DEQUE_THROW_IF)
+#  define TL_STATIC_DEQUE_THROW_IF(ExceptionType, expression)                  \
+    internal::ThrowIfOrAbort<ExceptionType>(expression, #expression)
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_DEQUE_NAMESPACE {
+inline namespace TL_STATIC_DEQUE_VERSION_NAMESPACE {
+
+namespace internal {
+
+// If the exceptions are enabled throws a new exception of the given type
+// passing the given expression_str to its constructor as a reason. If the
+// exceptions are disabled aborts the program execution.
+template <class Exception>
+[[noreturn]] inline constexpr void ThrowOrAbort(const char* expression_str) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  throw Exception(expression_str);
+#else
+  (void)expression_str;
+  __builtin_abort();
+#endif
+}
+
+// A default implementation of the TL_STATIC_DEQUE_THROW_IF().
+template <class Exception>
+inline constexpr void ThrowIfOrAbort(const bool expression_eval,
+                                     const char* expression_str) {
+  if (expression_eval) {
+    ThrowOrAbort<Exception>(expression_str);
+  }
+}
+
+template <class T>
+using IsTriviallyRelocatable =
+    TL_STATIC_DEQUE_STATIC_VECTOR_NAMESPACE::IsTriviallyRelocatable<T>;
+
+}  // namespace internal
+
+// The code follows the STL naming convention for easier interchangeability with
+// the standard deque type.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+template <class T, std::size_t N>
+class StaticDeque {
+  template <bool IsConst>
+  class Iterator;
+
+ public:
+  static_assert(N > 0);
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member types.
+
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Constants.
+
+  // In-class alias for the maximum capacity.
+  static constexpr size_type static_capacity = N;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member functions.
+
+  // Default constructor.
+  // Constructs an empty container.
+  constexpr StaticDeque() noexcept {}
+
+  // Constructs the container with count copies of elements with value value.
+  constexpr StaticDeque(const size_type count, const T& value) {
+    TL_STATIC_DEQUE_THROW_IF(std::length_error, count > max_size());
+
+    for (size_type i = 0; i < count; ++i) {
+      push_back(value);
+    }
+  }
+
+  // Constructs the container with the contents of the initializer list init.
+  constexpr StaticDeque(std::initializer_list<T> init) {
+    TL_STATIC_DEQUE_THROW_IF(std::length_error, init.size() > max_size());
+
+    for (const T& value : init) {
+      push_back(value);
+    }
+  }
+
+  // Copy constructor.
+  // Constructs the container with the copy of the contents of other.
+  constexpr StaticDeque(const StaticDeque& other) { CopyFrom(other); }
+
+  // Move constructor.
+  // Constructs the container with the contents of other using move semantics.
+  // After the move, other is guaranteed to be empty().
+  constexpr StaticDeque(StaticDeque&& other) noexcept {
+    RelocateFrom(other);
+  }
+
+  ~StaticDeque() { clear(); }
+
+  // Copy assignment operator.
+  // Replaces the contents with a copy of the contents of other.
+  constexpr auto operator=(const StaticDeque& other) -> StaticDeque& {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+    CopyFrom(other);
+
+    return *this;
+  }
+
+  // Move assignment operator.
+  // Replaces the contents with those of other using move semantics. After the
+  // move, other is guaranteed to be empty().
+  constexpr auto operator=(StaticDeque&& other) noexcept -> StaticDeque& {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+    RelocateFrom(other);
+
+    return *this;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Element access.
+
+  // Returns a reference to the element at specified location pos, with bounds
+  // checking.
+  constexpr auto at(const size_type pos) -> reference {
+    TL_STATIC_DEQUE_THROW_IF(std::out_of_range, pos >= size());
+    return operator[](pos);
+  }
+  constexpr auto at(const size_type pos) const -> const_reference {
+    TL_STATIC_DEQUE_THROW_IF(std::out_of_range, pos >= size());
+    return operator[](pos);
+  }
+
+  // Returns a reference to the element at specified location pos.
+  // No bounds checking is performed.
+  constexpr auto operator[](const size_type pos) -> reference {
+    return *GetElementPointer(pos);
+  }
+  constexpr auto operator[](const size_type pos) const -> const_reference {
+    return *GetElementPointer(pos);
+  }
+
+  // Returns a reference to the first element in the container.
+  // Calling front on an empty container causes undefined behavior.
+  constexpr auto front() -> reference { return operator[](0); }
+  constexpr auto front() const -> const_reference { return operator[](0); }
+
+  // Returns a reference to the last element in the container.
+  // Calling back on an empty container causes undefined behavior.
+  constexpr auto back() -> reference { return operator[](size_ - 1); }
+  constexpr auto back() const -> const_reference {
+    return operator[](size_ - 1);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Iterators.
+
+  constexpr auto begin() noexcept -> iterator { return {this, 0}; }
+  constexpr auto begin() const noexcept -> const_iterator { return {this, 0}; }
+  constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+
+  constexpr auto end() noexcept -> iterator { return {this, size_}; }
+  constexpr auto end() const noexcept -> const_iterator {
+    return {this, size_};
+  }
+  constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+  constexpr auto rbegin() noexcept -> reverse_iterator {
+    return reverse_iterator(end());
+  }
+  constexpr auto rbegin() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator(end());
+  }
+  constexpr auto crbegin() const noexcept -> const_reverse_iterator {
+    return rbegin();
+  }
+
+  constexpr auto rend() noexcept -> reverse_iterator {
+    return reverse_iterator(begin());
+  }
+  constexpr auto rend() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator(begin());
+  }
+  constexpr auto crend() const noexcept -> const_reverse_iterator {
+    return rend();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Capacity.
+
+  // Checks if the container has no elements.
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return size_ == 0;
+  }
+
+  // Returns the number of elements in the container.
+  constexpr auto size() const noexcept -> size_type { return size_; }
+
+  // Returns the maximum number of elements the container is able to hold.
+  constexpr auto max_size() const noexcept -> size_type { return N; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Modifiers.
+
+  // Erases all elements from the container.
+  constexpr void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_type i = 0; i < size_; ++i) {
+        GetElementPointer(i)->~T();
+      }
+    }
+
+    head_ = 0;
+    size_ = 0;
+  }
+
+  // Appends the given element value to the end of the container.
+  constexpr void push_back(const T& value) { emplace_back(value); }
+  constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  // Appends a new element to the end of the container.
+  template <class... Args>
+  constexpr auto emplace_back(Args&&... args) -> reference {
+    TL_STATIC_DEQUE_THROW_IF(std::length_error, size_ + 1 > max_size());
+
+    T* element = ::new (GetElementPointer(size_))
+        T(std::forward<Args>(args)...);
+    ++size_;
+
+    return *element;
+  }
+
+  // Prepends the given element value to the beginning of the container.
+  constexpr void push_front(const T& value) { emplace_front(value); }
+  constexpr void push_front(T&& value) { emplace_front(std::move(value)); }
+
+  // Prepends a new element to the beginning of the container.
+  template <class... Args>
+  constexpr auto emplace_front(Args&&... args) -> reference {
+    TL_STATIC_DEQUE_THROW_IF(std::length_error, size_ + 1 > max_size());
+
+    const size_type new_head = head_ == 0 ? N - 1 : head_ - 1;
+
+    T* element = ::new (GetStoragePointer(new_head))
+        T(std::forward<Args>(args)...);
+    head_ = new_head;
+    ++size_;
+
+    return *element;
+  }
+
+  // Removes the last element of the container.
+  // Calling pop_back on an empty container results in undefined behavior.
+  constexpr void pop_back() {
+    GetElementPointer(size_ - 1)->~T();
+    --size_;
+  }
+
+  // Removes the first element of the container.
+  // Calling pop_front on an empty container results in undefined behavior.
+  constexpr void pop_front() {
+    GetElementPointer(0)->~T();
+    head_ = head_ == N - 1 ? 0 : head_ + 1;
+    --size_;
+  }
+
+  // Erases the specified element from the container.
+  // The elements between the erased one and the closest end of the container
+  // are shifted by one position.
+  //
+  // Returns iterator following the removed element.
+  constexpr auto erase(const const_iterator pos) -> iterator {
+    const size_type index = pos.index_;
+
+    if (index < size_ / 2) {
+      for (size_type i = index; i > 0; --i) {
+        (*this)[i] = std::move((*this)[i - 1]);
+      }
+      pop_front();
+    } else {
+      for (size_type i = index; i + 1 < size_; ++i) {
+        (*this)[i] = std::move((*this)[i + 1]);
+      }
+      pop_back();
+    }
+
+    return {this, index};
+  }
+
+  // Exchanges the contents of the container with those of other.
+  constexpr void swap(StaticDeque& other) {
+    StaticDeque tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  // Iterator over elements of the container.
+  template <bool IsConst>
+  class Iterator {
+    using Container =
+        std::conditional_t<IsConst, const StaticDeque, StaticDeque>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const T*, T*>;
+    using reference = std::conditional_t<IsConst, const T&, T&>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(Container* container, const size_type index)
+        : container_(container), index_(index) {}
+
+    // Allow conversion from mutable to constant iterator.
+    template <bool OtherIsConst,
+              class = std::enable_if_t<IsConst && !OtherIsConst>>
+    constexpr Iterator(const Iterator<OtherIsConst>& other)
+        : container_(other.container_), index_(other.index_) {}
+
+    constexpr auto operator*() const -> reference {
+      return (*container_)[index_];
+    }
+    constexpr auto operator->() const -> pointer {
+      return &(*container_)[index_];
+    }
+    constexpr auto operator[](const difference_type n) const -> reference {
+      return (*container_)[index_ + n];
+    }
+
+    constexpr auto operator++() -> Iterator& {
+      ++index_;
+      return *this;
+    }
+    constexpr auto operator++(int) -> Iterator {
+      Iterator result = *this;
+      ++*this;
+      return result;
+    }
+    constexpr auto operator--() -> Iterator& {
+      --index_;
+      return *this;
+    }
+    constexpr auto operator--(int) -> Iterator {
+      Iterator result = *this;
+      --*this;
+      return result;
+    }
+
+    constexpr auto operator+=(const difference_type n) -> Iterator& {
+      index_ += n;
+      return *this;
+    }
+    constexpr auto operator-=(const difference_type n) -> Iterator& {
+      index_ -= n;
+      return *this;
+    }
+
+    friend constexpr auto operator+(Iterator it, const difference_type n)
+        -> Iterator {
+      return it += n;
+    }
+    friend constexpr auto operator+(const difference_type n, Iterator it)
+        -> Iterator {
+      return it += n;
+    }
+    friend constexpr auto operator-(Iterator it, const difference_type n)
+        -> Iterator {
+      return it -= n;
+    }
+    friend constexpr auto operator-(const Iterator& lhs, const Iterator& rhs)
+        -> difference_type {
+      return difference_type(lhs.index_) - difference_type(rhs.index_);
+    }
+
+    friend constexpr auto operator==(const Iterator& lhs, const Iterator& rhs)
+        -> bool {
+      return lhs.index_ == rhs.index_;
+    }
+    friend constexpr auto operator<=>(const Iterator& lhs,
+                                      const Iterator& rhs) {
+      return lhs.index_ <=> rhs.index_;
+    }
+
+   private:
+    friend class Iterator<!IsConst>;
+    friend class StaticDeque;
+
+    Container* container_{nullptr};
+    size_type index_{0};
+  };
+
+  // Get pointer to the storage of the given index, without wrapping around.
+  constexpr auto GetStoragePointer(const size_type storage_index) noexcept
+      -> T* {
+    return reinterpret_cast<T*>(data_) + storage_index;
+  }
+
+  // Get pointer to the element with the given logical index.
+  constexpr auto GetElementPointer(const size_type index) noexcept -> T* {
+    return GetStoragePointer(GetStorageIndex(index));
+  }
+  constexpr auto GetElementPointer(const size_type index) const noexcept
+      -> const T* {
+    return const_cast<StaticDeque*>(this)->GetElementPointer(index);
+  }
+
+  // Map the logical index to the index in the storage.
+  constexpr auto GetStorageIndex(const size_type index) const noexcept
+      -> size_type {
+    const size_type storage_index = head_ + index;
+    return storage_index >= N ? storage_index - N : storage_index;
+  }
+
+  // Copy elements of other into this container, which is empty.
+  constexpr void CopyFrom(const StaticDeque& other) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if (!std::is_constant_evaluated()) {
+        CopyStorage(other);
+        return;
+      }
+    }
+
+    for (const T& value : other) {
+      push_back(value);
+    }
+  }
+
+  // Move elements of other into this container, which is empty, and leave the
+  // other container empty.
+  constexpr void RelocateFrom(StaticDeque& other) noexcept {
+    if constexpr (internal::IsTriviallyRelocatable<T>::value) {
+      if (!std::is_constant_evaluated()) {
+        CopyStorage(other);
+        other.head_ = 0;
+        other.size_ = 0;
+        return;
+      }
+    }
+
+    for (T& value : other) {
+      emplace_back(std::move(value));
+    }
+    other.clear();
+  }
+
+  // Copy bytes of the elements of other, keeping their positions in the ring.
+  void CopyStorage(const StaticDeque& other) {
+    const size_type first_size = std::min(other.size_, N - other.head_);
+    const size_type second_size = other.size_ - first_size;
+
+    if (first_size) {
+      std::memcpy(static_cast<void*>(data_ + other.head_ * sizeof(T)),
+                  static_cast<const void*>(other.data_ +
+                                           other.head_ * sizeof(T)),
+                  first_size * sizeof(T));
+    }
+    if (second_size) {
+      std::memcpy(static_cast<void*>(data_),
+                  static_cast<const void*>(other.data_),
+                  second_size * sizeof(T));
+    }
+
+    head_ = other.head_;
+    size_ = other.size_;
+  }
+
+  alignas(T) uint8_t data_[sizeof(T) * N];  // NOLINT(modernize-avoid-c-arrays)
+
+  // Index in the storage of the first element.
+  size_type head_{0};
+
+  size_type size_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Non-member functions.
+
+// Checks if the contents of lhs and rhs are equal, that is, they have the same
+// number of elements and each element in lhs compares equal with the element in
+// rhs at the same position.
+template <class T, std::size_t N, std::size_t M>
+constexpr auto operator==(const StaticDeque<T, N>& lhs,
+                          const StaticDeque<T, M>& rhs) -> bool {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template <class T, std::size_t N, std::size_t M>
+constexpr auto operator!=(const StaticDeque<T, N>& lhs,
+                          const StaticDeque<T, M>& rhs) -> bool {
+  return !(lhs == rhs);
+}
+
+// Specializes the swap() algorithm for StaticDeque.
+// Swaps the contents of lhs and rhs. Equivalent to `lhs.swap(rhs)`.
+template <class T, std::size_t N>
+constexpr void swap(StaticDeque<T, N>& lhs, StaticDeque<T, N>& rhs) {
+  lhs.swap(rhs);
+}
+
+// NOLINTEND(readability-identifier-naming)
+
+}  // namespace TL_STATIC_DEQUE_VERSION_NAMESPACE
+}  // namespace TL_STATIC_DEQUE_NAMESPACE
+
+#undef TL_STATIC_DEQUE_VERSION_MAJOR
+#undef TL_STATIC_DEQUE_VERSION_MINOR
+#undef TL_STATIC_DEQUE_VERSION_REVISION
+
+#undef TL_STATIC_DEQUE_NAMESPACE
+#undef TL_STATIC_DEQUE_STATIC_VECTOR_NAMESPACE
+
+#undef TL_STATIC_DEQUE_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_DEQUE_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_DEQUE_VERSION_NAMESPACE
+
+#undef TL_STATIC_DEQUE_THROW_IF
@@ -0,0 +1,1287 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Fixed capacity sorted associative containers.
+//
+// StaticFlatMap implements an API similar to the C++23 std::flat_map, and
+// StaticFlatSet implements an API similar to the C++23 std::flat_set. Both of
+// them use in-object storage of a static size provided by the StaticVector, so
+// no allocations will be performed by the containers.
+//
+// The StaticFlatMap stores keys and mapped values in two separate arrays which
+// are kept sorted by the key. This keeps the keys densely packed in memory, so
+// that lookup only touches the memory of keys, and the memory of values is only
+// accessed once the key is found.
+//
+// Lookup
+// ======
+//
+// The lookup is performed using a branchless binary search, where the choice of
+// the half of the range is done using a conditional move rather than a branch.
+// This avoids branch mispredictions which dominate the cost of a classic binary
+// search on small arrays.
+//
+// For small capacities of arithmetic keys the lookup is done as a linear count
+// of keys which are less than the requested one. The loop has no dependencies
+// between iterations and is vectorized by the compiler.
+//
+// The default comparator of the containers is transparent: lookup functions
+// accept any type which is comparable with the key type. Additionally, when
+// both the key and the argument are convertible to std::string_view they are
+// compared as string views. This allows, for example, to look up values in a
+// map which uses StaticString as a key using CStringView or a string literal
+// without constructing a temporary key.
+//
+// Bulk insertion
+// ==============
+//
+// Inserting elements one by one into a sorted array has a quadratic complexity.
+// Constructing the containers from a range of elements, or inserting a range
+// of elements sorts the new elements once and merges them with the existing
+// ones in a single pass.
+//
+//
+// Exceptions
+// ==========
+//
+// General notes on exceptions:
+//
+//  - If an exception is thrown for any reason, functions have effect (strong
+//    exception guarantee).
+//
+//  - If an operation would result in size() > max_size(), an std::length_error
+//    exception is throw.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+//
+// Limitations
+// ===========
+//
+//  - When a range of elements is inserted, the range is required to have no
+//    more than max_size() elements, even if some of them have equivalent keys.
+//
+//  - The iterators of the StaticFlatMap are proxy iterators: dereferencing
+//    them gives a pair of references to the key and the mapped value.
+//
+//  - The key of the StaticFlatMap is to be nothrow move constructible and
+//    assignable, so that the keys and the values stay in sync when inserting
+//    an element throws.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "tl_static_vector.h"
+
+// Semantic version of the tl_static_flat_map library.
+#define TL_STATIC_FLAT_MAP_VERSION_MAJOR 0
+#define TL_STATIC_FLAT_MAP_VERSION_MINOR 0
+#define TL_STATIC_FLAT_MAP_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_FLAT_MAP_NAMESPACE
+#  define TL_STATIC_FLAT_MAP_NAMESPACE tiny_lib::static_flat_map
+#endif
+
+// Namespace in which the StaticVector is defined.
+// Is to be defined when the tl_static_vector library is configured to use a
+// non-default namespace.
+#ifndef TL_STATIC_FLAT_MAP_STATIC_VECTOR_NAMESPACE
+#  define TL_STATIC_FLAT_MAP_STATIC_VECTOR_NAMESPACE tiny_lib::static_vector
+#endif
+
+// Helpers for TL_STATIC_FLAT_MAP_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_FLAT_MAP_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)      \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_FLAT_MAP_VERSION_NAMESPACE_CONCAT(id1, id2, id3)             \
+  TL_STATIC_FLAT_MAP_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_FLAT_MAP_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_FLAT_MAP_VERSION_NAMESPACE                                   \
+  TL_STATIC_FLAT_MAP_VERSION_NAMESPACE_CONCAT(                                 \
+      TL_STATIC_FLAT_MAP_VERSION_MAJOR,                                        \
+      TL_STATIC_FLAT_MAP_VERSION_MINOR,                                        \
+      TL_STATIC_FLAT_MAP_VERSION_REVISION)
+
+// Throw an exception of the given type ExceptionType if the expression is
+// evaluated to a truthful value.
+// The default implementation throws an ExceptionType(#expression) if the
+// condition is met.
+// If the default behavior is not suitable for the application it should define
+// TL_STATIC_FLAT_MAP_THROW_IF prior to including this header. The provided
+// implementation is not to return, otherwise an undefined behavior of memory
+// corruption will happen.
+#if !defined(TL_STATIC_FLAT_MAP_THROW_IF)
+#  define TL_STATIC_FLAT_MAP_THROW_IF(ExceptionType, expression)               \
+    internal::ThrowIfOrAbort<ExceptionType>(expression, #expression)
+#endif
+
+// The maximum capacity of a container with arithmetic keys for which the
+// lookup is done using a linear scan instead of a binary search.
+#if !defined(TL_STATIC_FLAT_MAP_LINEAR_SEARCH_MAX_SIZE)
+#  define TL_STATIC_FLAT_MAP_LINEAR_SEARCH_MAX_SIZE 32
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_FLAT_MAP_NAMESPACE {
+inline namespace TL_STATIC_FLAT_MAP_VERSION_NAMESPACE {
+
+// Transparent comparator which is used by default by the containers.
+//
+// Compares arguments which are both convertible to std::string_view as string
+// views, and uses operator< for all other types.
+struct Less {
+  using is_transparent = void;
+
+  template <class T, class U>
+  constexpr auto operator()(const T& lhs, const U& rhs) const -> bool {
+    if constexpr (std::is_convertible_v<const T&, std::string_view> &&
+                  std::is_convertible_v<const U&, std::string_view>) {
+      return std::string_view(lhs) < std::string_view(rhs);
+    } else {
+      return lhs < rhs;
+    }
+  }
+};
+
+namespace internal {
+
+// If the exceptions are enabled throws a new exception of the given type
+// passing the given expression_str to its constructor as a reason. If the
+// exceptions are disabled aborts the program execution.
+template <class Exception>
+[[noreturn]] inline constexpr void ThrowOrAbort(const char* expression_str) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  throw Exception(expression_str);
+#else
+  (void)expression_str;
+  __builtin_abort();
+#endif
+}
+
+// A default implementation of the TL_STATIC_FLAT_MAP_THROW_IF().
+template <class Exception>
+inline constexpr void ThrowIfOrAbort(const bool expression_eval,
+                                     const char* expression_str) {
+  if (expression_eval) {
+    ThrowOrAbort<Exception>(expression_str);
+  }
+}
+
+// Storage of the keys and values.
+template <class T, std::size_t N>
+using StaticVector =
+    TL_STATIC_FLAT_MAP_STATIC_VECTOR_NAMESPACE::StaticVector<T, N>;
+
+// SFINAE expression which allows a lookup function to participate in the
+// overload resolution only if the comparator is transparent.
+template <class Compare, class K>
+using EnableIfTransparent = std::void_t<typename Compare::is_transparent, K>;
+
+// Check whether the lookup of the key K in the array of keys Key of the
+// capacity N using the comparator Compare is to be done using linear scan.
+template <class Key, class K, std::size_t N, class Compare>
+inline constexpr bool kUseLinearSearch =
+    std::is_arithmetic_v<Key> && std::is_same_v<Key, K> &&
+    N <= TL_STATIC_FLAT_MAP_LINEAR_SEARCH_MAX_SIZE &&
+    (std::is_same_v<Compare, Less> || std::is_same_v<Compare, std::less<>> ||
+     std::is_same_v<Compare, std::less<Key>>);
+
+// Returns index of the first key in the sorted array which does not compare
+// less than the given key.
+template <std::size_t N, class Key, class K, class Compare>
+constexpr auto LowerBound(const Key* keys,
+                          const std::size_t size,
+                          const K& key,
+                          const Compare& comp) -> std::size_t {
+  if constexpr (kUseLinearSearch<Key, K, N, Compare>) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      count += std::size_t(keys[i] < key);
+    }
+    return count;
+  } else {
+    if (size == 0) {
+      return 0;
+    }
+
+    const Key* base = keys;
+    std::size_t length = size;
+    while (length > 1) {
+      const std::size_t half = length / 2;
+      base = comp(base[half], key) ? base + half : base;
+      length -= half;
+    }
+
+    return std::size_t(base - keys) + std::size_t(comp(*base, key));
+  }
+}
+
+// Returns index of the first key in the sorted array which compares greater
+// than the given key.
+template <std::size_t N, class Key, class K, class Compare>
+constexpr auto UpperBound(const Key* keys,
+                          const std::size_t size,
+                          const K& key,
+                          const Compare& comp) -> std::size_t {
+  if constexpr (kUseLinearSearch<Key, K, N, Compare>) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      count += std::size_t(!(key < keys[i]));
+    }
+    return count;
+  } else {
+    if (size == 0) {
+      return 0;
+    }
+
+    const Key* base = keys;
+    std::size_t length = size;
+    while (length > 1) {
+      const std::size_t half = length / 2;
+      base = comp(key, base[half]) ? base : base + half;
+      length -= half;
+    }
+
+    return std::size_t(base - keys) + std::size_t(!comp(key, *base));
+  }
+}
+
+// Returns index of the key which is equivalent to the given one, or size if
+// there is no such key in the sorted array.
+template <std::size_t N, class Key, class K, class Compare>
+constexpr auto Find(const Key* keys,
+                    const std::size_t size,
+                    const K& key,
+                    const Compare& comp) -> std::size_t {
+  const std::size_t index = LowerBound<N>(keys, size, key, comp);
+  if (index == size || comp(key, keys[index])) {
+    return size;
+  }
+  return index;
+}
+
+}  // namespace internal
+
+// The code follows the STL naming convention for easier interchangeability with
+// the standard containers.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticFlatMap.
+
+template <class Key, class T, std::size_t N, class Compare = Less>
+class StaticFlatMap {
+  template <bool IsConst>
+  class Iterator;
+
+ public:
+  static_assert(N > 0);
+
+  // Inserting a key shifts the keys which follow it, and if it throws the keys
+  // get out of sync with the values.
+  static_assert(std::is_nothrow_move_constructible_v<Key> &&
+                    std::is_nothrow_move_assignable_v<Key>,
+                "Key is to be nothrow move constructible and assignable");
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member types.
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using key_compare = Compare;
+  using reference = std::pair<const key_type&, mapped_type&>;
+  using const_reference = std::pair<const key_type&, const mapped_type&>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member functions.
+
+  // Default constructor.
+  // Constructs an empty container.
+  constexpr StaticFlatMap() = default;
+
+  // Constructs an empty container with the given comparator.
+  constexpr explicit StaticFlatMap(const key_compare& comp) : comp_(comp) {}
+
+  // Constructs the container with the contents of the range [first, last).
+  // If multiple elements in the range have keys that compare equivalent, only
+  // the first of them is inserted.
+  template <class InputIt,
+            class = std::enable_if_t<std::input_iterator<InputIt>>>
+  constexpr StaticFlatMap(InputIt first,
+                          InputIt last,
+                          const key_compare& comp = key_compare())
+      : comp_(comp) {
+    insert(first, last);
+  }
+
+  // Constructs the container with the contents of the initializer list ilist.
+  // If multiple elements in the list have keys that compare equivalent, only
+  // the first of them is inserted.
+  constexpr StaticFlatMap(std::initializer_list<value_type> ilist,
+                          const key_compare& comp = key_compare())
+      : StaticFlatMap(ilist.begin(), ilist.end(), comp) {}
+
+  // Replaces the contents with those identified by initializer list ilist.
+  constexpr auto operator=(std::initializer_list<value_type> ilist)
+      -> StaticFlatMap& {
+    clear();
+    insert(ilist.begin(), ilist.end());
+    return *this;
+  }
+
+  // Element access
+  // ==============
+
+  // Returns a reference to the mapped value of the element with the specified
+  // key. If no such element exists, an exception of type std::out_of_range is
+  // thrown.
+  constexpr auto at(const key_type& key) -> mapped_type& {
+    const size_type index = FindIndex(key);
+    TL_STATIC_FLAT_MAP_THROW_IF(std::out_of_range, index == size());
+    return values_[index];
+  }
+  constexpr auto at(const key_type& key) const -> const mapped_type& {
+    const size_type index = FindIndex(key);
+    TL_STATIC_FLAT_MAP_THROW_IF(std::out_of_range, index == size());
+    return values_[index];
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto at(const K& key) -> mapped_type& {
+    const size_type index = FindIndex(key);
+    TL_STATIC_FLAT_MAP_THROW_IF(std::out_of_range, index == size());
+    return values_[index];
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto at(const K& key) const -> const mapped_type& {
+    const size_type index = FindIndex(key);
+    TL_STATIC_FLAT_MAP_THROW_IF(std::out_of_range, index == size());
+    return values_[index];
+  }
+
+  // Returns a reference to the value that is mapped to the given key,
+  // performing an insertion of a value-initialized mapped value if such key
+  // does not already exist.
+  constexpr auto operator[](const key_type& key) -> mapped_type& {
+    return try_emplace(key).first->second;
+  }
+  constexpr auto operator[](key_type&& key) -> mapped_type& {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  // Iterators
+  // =========
+
+  // Returns an iterator to the first element of the container.
+  constexpr auto begin() noexcept -> iterator { return MakeIterator(0); }
+  constexpr auto begin() const noexcept -> const_iterator {
+    return MakeIterator(0);
+  }
+  constexpr auto cbegin() const noexcept -> const_iterator {
+    return MakeIterator(0);
+  }
+
+  // Returns an iterator to the element following the last element of the
+  // container.
+  constexpr auto end() noexcept -> iterator { return MakeIterator(size()); }
+  constexpr auto end() const noexcept -> const_iterator {
+    return MakeIterator(size());
+  }
+  constexpr auto cend() const noexcept -> const_iterator {
+    return MakeIterator(size());
+  }
+
+  // Capacity
+  // ========
+
+  // Checks if the container has no elements, i.e. whether begin() == end().
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return keys_.empty();
+  }
+
+  // Returns the number of elements in the container.
+  constexpr auto size() const noexcept -> size_type { return keys_.size(); }
+
+  // Returns the maximum number of elements the container is able to hold.
+  constexpr auto max_size() const noexcept -> size_type { return N; }
+
+  // Returns the number of elements that the container has currently allocated
+  // space for.
+  constexpr auto capacity() const noexcept -> size_type { return N; }
+
+  // Modifiers
+  // =========
+
+  // Inserts element into the container, if the container doesn't already
+  // contain an element with an equivalent key.
+  //
+  // Returns a pair consisting of an iterator to the inserted element (or to the
+  // element that prevented the insertion) and a bool value set to true if and
+  // only if the insertion took place.
+  constexpr auto insert(const value_type& value) -> std::pair<iterator, bool> {
+    return try_emplace(value.first, value.second);
+  }
+  constexpr auto insert(value_type&& value) -> std::pair<iterator, bool> {
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+
+  // Inserts elements from range [first, last).
+  // If multiple elements in the range have keys that compare equivalent, only
+  // the first of them is inserted. Elements with keys which are already present
+  // in the container are not inserted.
+  //
+  // The new elements are sorted once, and then merged with the existing ones.
+  template <class InputIt,
+            class = std::enable_if_t<std::input_iterator<InputIt>>>
+  constexpr void insert(InputIt first, InputIt last) {
+    // Gather the new elements prior to modifying the container, so that the
+    // container is left unchanged if the range does not fit.
+    internal::StaticVector<value_type, N> elements;
+    for (; first != last; ++first) {
+      TL_STATIC_FLAT_MAP_THROW_IF(std::length_error,
+                                  elements.size() == max_size());
+      elements.emplace_back(*first);
+    }
+
+    const auto value_comp = [&](const value_type& lhs,
+                                const value_type& rhs) -> bool {
+      return comp_(lhs.first, rhs.first);
+    };
+    std::stable_sort(elements.begin(), elements.end(), value_comp);
+
+    MergeSortedElements(elements);
+  }
+
+  // Inserts elements from initializer list ilist.
+  constexpr void insert(std::initializer_list<value_type> ilist) {
+    insert(ilist.begin(), ilist.end());
+  }
+
+  // Inserts a new element into the container constructed in-place with the
+  // given args, if there is no element with the key in the container.
+  template <class... Args>
+  constexpr auto emplace(Args&&... args) -> std::pair<iterator, bool> {
+    value_type value(std::forward<Args>(args)...);
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+
+  // If a key equivalent to key already exists in the container, does nothing.
+  // Otherwise, inserts a new element into the container with key key and value
+  // constructed with args.
+  template <class... Args>
+  constexpr auto try_emplace(const key_type& key, Args&&... args)
+      -> std::pair<iterator, bool> {
+    return TryEmplaceImpl(key, std::forward<Args>(args)...);
+  }
+  template <class... Args>
+  constexpr auto try_emplace(key_type&& key, Args&&... args)
+      -> std::pair<iterator, bool> {
+    return TryEmplaceImpl(std::move(key), std::forward<Args>(args)...);
+  }
+
+  // If a key equivalent to key already exists in the container, assigns obj to
+  // the mapped value. If the key does not exist, inserts the new value.
+  template <class M>
+  constexpr auto insert_or_assign(const key_type& key, M&& obj)
+      -> std::pair<iterator, bool> {
+    auto result = TryEmplaceImpl(key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+  template <class M>
+  constexpr auto insert_or_assign(key_type&& key, M&& obj)
+      -> std::pair<iterator, bool> {
+    auto result = TryEmplaceImpl(std::move(key), std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+
+  // Removes the element at pos.
+  // Returns iterator following the removed element.
+  constexpr auto erase(const const_iterator pos) -> iterator {
+    const size_type index = pos - cbegin();
+    keys_.erase(keys_.begin() + index);
+    values_.erase(values_.begin() + index);
+    return MakeIterator(index);
+  }
+  constexpr auto erase(const iterator pos) -> iterator {
+    return erase(const_iterator(pos));
+  }
+
+  // Removes the element (if one exists) with the key equivalent to key.
+  // Returns the number of elements removed (0 or 1).
+  constexpr auto erase(const key_type& key) -> size_type {
+    const size_type index = FindIndex(key);
+    if (index == size()) {
+      return 0;
+    }
+    erase(MakeIterator(index));
+    return 1;
+  }
+
+  // Erases all elements from the container. After this call, size() returns
+  // zero.
+  constexpr void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+
+  // Exchanges the contents of the container with those of other.
+  constexpr void swap(StaticFlatMap& other) {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Lookup
+  // ======
+
+  // Returns the number of elements with key that compares equivalent to the
+  // specified argument (0 or 1).
+  constexpr auto count(const key_type& key) const -> size_type {
+    return contains(key);
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto count(const K& key) const -> size_type {
+    return contains(key);
+  }
+
+  // Finds an element with key equivalent to key.
+  // If no such element is found, past-the-end iterator is returned.
+  constexpr auto find(const key_type& key) -> iterator {
+    return MakeIterator(FindIndex(key));
+  }
+  constexpr auto find(const key_type& key) const -> const_iterator {
+    return MakeIterator(FindIndex(key));
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto find(const K& key) -> iterator {
+    return MakeIterator(FindIndex(key));
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto find(const K& key) const -> const_iterator {
+    return MakeIterator(FindIndex(key));
+  }
+
+  // Checks if there is an element with key equivalent to key in the container.
+  constexpr auto contains(const key_type& key) const -> bool {
+    return FindIndex(key) != size();
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto contains(const K& key) const -> bool {
+    return FindIndex(key) != size();
+  }
+
+  // Returns an iterator pointing to the first element that is not less than
+  // key.
+  constexpr auto lower_bound(const key_type& key) -> iterator {
+    return MakeIterator(LowerBoundIndex(key));
+  }
+  constexpr auto lower_bound(const key_type& key) const -> const_iterator {
+    return MakeIterator(LowerBoundIndex(key));
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto lower_bound(const K& key) -> iterator {
+    return MakeIterator(LowerBoundIndex(key));
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto lower_bound(const K& key) const -> const_iterator {
+    return MakeIterator(LowerBoundIndex(key));
+  }
+
+  // Returns an iterator pointing to the first element that is greater than
+  // key.
+  constexpr auto upper_bound(const key_type& key) -> iterator {
+    return MakeIterator(UpperBoundIndex(key));
+  }
+  constexpr auto upper_bound(const key_type& key) const -> const_iterator {
+    return MakeIterator(UpperBoundIndex(key));
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto upper_bound(const K& key) -> iterator {
+    return MakeIterator(UpperBoundIndex(key));
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto upper_bound(const K& key) const -> const_iterator {
+    return MakeIterator(UpperBoundIndex(key));
+  }
+
+  // Observers
+  // =========
+
+  // Returns the function object that compares the keys.
+  constexpr auto key_comp() const -> key_compare { return comp_; }
+
+  // Returns a span of the sorted keys of the container.
+  constexpr auto keys() const noexcept -> std::span<const key_type> {
+    return {keys_.data(), keys_.size()};
+  }
+
+  // Returns a span of the mapped values of the container, in the order of their
+  // keys.
+  constexpr auto values() noexcept -> std::span<mapped_type> {
+    return {values_.data(), values_.size()};
+  }
+  constexpr auto values() const noexcept -> std::span<const mapped_type> {
+    return {values_.data(), values_.size()};
+  }
+
+ private:
+  // Iterator over elements of the map.
+  //
+  // Points to a key and a corresponding mapped value, and dereferences to a
+  // pair of references to them.
+  template <bool IsConst>
+  class Iterator {
+    using MappedPointer =
+        std::conditional_t<IsConst, const mapped_type*, mapped_type*>;
+
+    // Helper which allows to use operator-> on the proxy iterator.
+    template <class Reference>
+    class ArrowProxy {
+     public:
+      constexpr explicit ArrowProxy(Reference reference)
+          : reference_(reference) {}
+      constexpr auto operator->() -> Reference* { return &reference_; }
+
+     private:
+      Reference reference_;
+    };
+
+   public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::pair<key_type, mapped_type>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<IsConst,
+                                         StaticFlatMap::const_reference,
+                                         StaticFlatMap::reference>;
+    using pointer = ArrowProxy<reference>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(const key_type* key, const MappedPointer value)
+        : key_(key), value_(value) {}
+
+    // Allow conversion from mutable to constant iterator.
+    template <bool OtherIsConst,
+              class = std::enable_if_t<IsConst && !OtherIsConst>>
+    constexpr Iterator(const Iterator<OtherIsConst>& other)
+        : key_(other.key_), value_(other.value_) {}
+
+    constexpr auto operator*() const -> reference { return {*key_, *value_}; }
+    constexpr auto operator->() const -> pointer { return pointer(**this); }
+    constexpr auto operator[](const difference_type n) const -> reference {
+      return {key_[n], value_[n]};
+    }
+
+    constexpr auto operator++() -> Iterator& {
+      ++key_;
+      ++value_;
+      return *this;
+    }
+    constexpr auto operator++(int) -> Iterator {
+      Iterator result = *this;
+      ++*this;
+      return result;
+    }
+    constexpr auto operator--() -> Iterator& {
+      --key_;
+      --value_;
+      return *this;
+    }
+    constexpr auto operator--(int) -> Iterator {
+      Iterator result = *this;
+      --*this;
+      return result;
+    }
+
+    constexpr auto operator+=(const difference_type n) -> Iterator& {
+      key_ += n;
+      value_ += n;
+      return *this;
+    }
+    constexpr auto operator-=(const difference_type n) -> Iterator& {
+      key_ -= n;
+      value_ -= n;
+      return *this;
+    }
+
+    friend constexpr auto operator+(Iterator it, const difference_type n)
+        -> Iterator {
+      return it += n;
+    }
+    friend constexpr auto operator+(const difference_type n, Iterator it)
+        -> Iterator {
+      return it += n;
+    }
+    friend constexpr auto operator-(Iterator it, const difference_type n)
+        -> Iterator {
+      return it -= n;
+    }
+    friend constexpr auto operator-(const Iterator& lhs, const Iterator& rhs)
+        -> difference_type {
+      return lhs.key_ - rhs.key_;
+    }
+
+    friend constexpr auto operator==(const Iterator& lhs, const Iterator& rhs)
+        -> bool {
+      return lhs.key_ == rhs.key_;
+    }
+    friend constexpr auto operator<=>(const Iterator& lhs,
+                                      const Iterator& rhs) {
+      return lhs.key_ <=> rhs.key_;
+    }
+
+   private:
+    friend class Iterator<!IsConst>;
+
+    const key_type* key_{nullptr};
+    MappedPointer value_{nullptr};
+  };
+
+  constexpr auto MakeIterator(const size_type index) noexcept -> iterator {
+    return {keys_.data() + index, values_.data() + index};
+  }
+  constexpr auto MakeIterator(const size_type index) const noexcept
+      -> const_iterator {
+    return {keys_.data() + index, values_.data() + index};
+  }
+
+  template <class K>
+  constexpr auto LowerBoundIndex(const K& key) const -> size_type {
+    return internal::LowerBound<N>(keys_.data(), keys_.size(), key, comp_);
+  }
+  template <class K>
+  constexpr auto UpperBoundIndex(const K& key) const -> size_type {
+    return internal::UpperBound<N>(keys_.data(), keys_.size(), key, comp_);
+  }
+  template <class K>
+  constexpr auto FindIndex(const K& key) const -> size_type {
+    return internal::Find<N>(keys_.data(), keys_.size(), key, comp_);
+  }
+
+  template <class KeyType, class... Args>
+  constexpr auto TryEmplaceImpl(KeyType&& key, Args&&... args)
+      -> std::pair<iterator, bool> {
+    const size_type index = LowerBoundIndex(key);
+    if (index != size() && !comp_(key, keys_[index])) {
+      return {MakeIterator(index), false};
+    }
+
+    TL_STATIC_FLAT_MAP_THROW_IF(std::length_error, size() == max_size());
+
+    // Construct the key and the value before modifying the container: if either
+    // of them throws the container stays unchanged. Inserting the key does not
+    // throw as the key is nothrow movable, so once the value is inserted the
+    // keys and the values stay in sync.
+    key_type new_key(std::forward<KeyType>(key));
+    mapped_type new_value(std::forward<Args>(args)...);
+    values_.emplace(values_.begin() + index, std::move(new_value));
+    keys_.emplace(keys_.begin() + index, std::move(new_key));
+
+    return {MakeIterator(index), true};
+  }
+
+  // Merge elements which are sorted by key into the container.
+  //
+  // Elements with keys which are already present in the container are ignored,
+  // and only the first element out of those with equivalent keys is inserted.
+  constexpr void MergeSortedElements(
+      internal::StaticVector<value_type, N>& elements) {
+    if (elements.empty()) {
+      return;
+    }
+
+    const size_type num_elements = elements.size();
+    const size_type num_existing = size();
+
+    // Check the merged elements fit prior to modifying the container.
+    size_type num_new_keys = 0;
+    for (size_type j = 0; j < num_elements; ++j) {
+      if ((j == 0 || comp_(elements[j - 1].first, elements[j].first)) &&
+          FindIndex(elements[j].first) == num_existing) {
+        ++num_new_keys;
+      }
+    }
+    TL_STATIC_FLAT_MAP_THROW_IF(std::length_error,
+                                num_existing + num_new_keys > max_size());
+
+    internal::StaticVector<key_type, N> new_keys;
+    internal::StaticVector<mapped_type, N> new_values;
+
+    size_type i = 0;
+    size_type j = 0;
+    while (i < num_existing || j < num_elements) {
+      if (j == num_elements ||
+          (i < num_existing && !comp_(elements[j].first, keys_[i]))) {
+        // Skip new elements which are equivalent to the existing one.
+        while (j < num_elements && !comp_(keys_[i], elements[j].first)) {
+          ++j;
+        }
+        new_keys.emplace_back(std::move(keys_[i]));
+        new_values.emplace_back(std::move(values_[i]));
+        ++i;
+        continue;
+      }
+
+      new_keys.emplace_back(std::move(elements[j].first));
+      new_values.emplace_back(std::move(elements[j].second));
+
+      // Skip the following new elements with the equivalent key.
+      const key_type& key = new_keys.back();
+      ++j;
+      while (j < num_elements && !comp_(key, elements[j].first)) {
+        ++j;
+      }
+    }
+
+    keys_ = std::move(new_keys);
+    values_ = std::move(new_values);
+  }
+
+  internal::StaticVector<key_type, N> keys_;
+  internal::StaticVector<mapped_type, N> values_;
+
+  [[no_unique_address]] key_compare comp_;
+};
+
+// Checks if the contents of lhs and rhs are equal, that is, they have the same
+// number of elements and each element in lhs compares equal with the element in
+// rhs at the same position.
+template <class Key, class T, std::size_t N, class Compare>
+constexpr auto operator==(const StaticFlatMap<Key, T, N, Compare>& lhs,
+                          const StaticFlatMap<Key, T, N, Compare>& rhs)
+    -> bool {
+  return std::ranges::equal(lhs.keys(), rhs.keys()) &&
+         std::ranges::equal(lhs.values(), rhs.values());
+}
+
+// Specializes the swap() algorithm for StaticFlatMap.
+// Swaps the contents of lhs and rhs. Equivalent to `lhs.swap(rhs)`.
+template <class Key, class T, std::size_t N, class Compare>
+constexpr void swap(StaticFlatMap<Key, T, N, Compare>& lhs,
+                    StaticFlatMap<Key, T, N, Compare>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+// Erases all elements that satisfy the predicate pred from the container.
+// The predicate is called with a const_reference to the elements.
+// Returns the number of erased elements.
+template <class Key, class T, std::size_t N, class Compare, class Pred>
+constexpr auto erase_if(StaticFlatMap<Key, T, N, Compare>& c, Pred pred) ->
+    typename StaticFlatMap<Key, T, N, Compare>::size_type {
+  const auto old_size = c.size();
+  for (auto it = c.cbegin(); it != c.cend();) {
+    if (pred(*it)) {
+      it = c.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return old_size - c.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticFlatSet.
+
+template <class Key, std::size_t N, class Compare = Less>
+class StaticFlatSet {
+ public:
+  static_assert(N > 0);
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member types.
+
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = const value_type*;
+  using const_iterator = const value_type*;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member functions.
+
+  // Default constructor.
+  // Constructs an empty container.
+  constexpr StaticFlatSet() = default;
+
+  // Constructs an empty container with the given comparator.
+  constexpr explicit StaticFlatSet(const key_compare& comp) : comp_(comp) {}
+
+  // Constructs the container with the contents of the range [first, last).
+  // If multiple elements in the range compare equivalent, only the first of
+  // them is inserted.
+  template <class InputIt,
+            class = std::enable_if_t<std::input_iterator<InputIt>>>
+  constexpr StaticFlatSet(InputIt first,
+                          InputIt last,
+                          const key_compare& comp = key_compare())
+      : comp_(comp) {
+    insert(first, last);
+  }
+
+  // Constructs the container with the contents of the initializer list ilist.
+  constexpr StaticFlatSet(std::initializer_list<value_type> ilist,
+                          const key_compare& comp = key_compare())
+      : StaticFlatSet(ilist.begin(), ilist.end(), comp) {}
+
+  // Replaces the contents with those identified by initializer list ilist.
+  constexpr auto operator=(std::initializer_list<value_type> ilist)
+      -> StaticFlatSet& {
+    clear();
+    insert(ilist.begin(), ilist.end());
+    return *this;
+  }
+
+  // Iterators
+  // =========
+
+  // Returns an iterator to the first element of the container.
+  constexpr auto begin() const noexcept -> const_iterator {
+    return keys_.begin();
+  }
+  constexpr auto cbegin() const noexcept -> const_iterator {
+    return keys_.begin();
+  }
+
+  // Returns an iterator to the element following the last element of the
+  // container.
+  constexpr auto end() const noexcept -> const_iterator { return keys_.end(); }
+  constexpr auto cend() const noexcept -> const_iterator {
+    return keys_.end();
+  }
+
+  // Capacity
+  // ========
+
+  // Checks if the container has no elements, i.e. whether begin() == end().
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return keys_.empty();
+  }
+
+  // Returns the number of elements in the container.
+  constexpr auto size() const noexcept -> size_type { return keys_.size(); }
+
+  // Returns the maximum number of elements the container is able to hold.
+  constexpr auto max_size() const noexcept -> size_type { return N; }
+
+  // Returns the number of elements that the container has currently allocated
+  // space for.
+  constexpr auto capacity() const noexcept -> size_type { return N; }
+
+  // Modifiers
+  // =========
+
+  // Inserts value into the container, if the container doesn't already contain
+  // an element with an equivalent value.
+  //
+  // Returns a pair consisting of an iterator to the inserted element (or to the
+  // element that prevented the insertion) and a bool value set to true if and
+  // only if the insertion took place.
+  constexpr auto insert(const value_type& value) -> std::pair<iterator, bool> {
+    return InsertImpl(value);
+  }
+  constexpr auto insert(value_type&& value) -> std::pair<iterator, bool> {
+    return InsertImpl(std::move(value));
+  }
+
+  // Inserts elements from range [first, last).
+  // If multiple elements in the range compare equivalent, only the first of
+  // them is inserted. Elements which are already present in the container are
+  // not inserted.
+  //
+  // The new elements are sorted once, and then merged with the existing ones.
+  template <class InputIt,
+            class = std::enable_if_t<std::input_iterator<InputIt>>>
+  constexpr void insert(InputIt first, InputIt last) {
+    // Gather the new elements prior to modifying the container, so that the
+    // container is left unchanged if the range does not fit.
+    internal::StaticVector<value_type, N> elements;
+    for (; first != last; ++first) {
+      TL_STATIC_FLAT_MAP_THROW_IF(std::length_error,
+                                  elements.size() == max_size());
+      elements.emplace_back(*first);
+    }
+
+    std::stable_sort(elements.begin(), elements.end(), comp_);
+
+    MergeSortedElements(elements);
+  }
+
+  // Inserts elements from initializer list ilist.
+  constexpr void insert(std::initializer_list<value_type> ilist) {
+    insert(ilist.begin(), ilist.end());
+  }
+
+  // Inserts a new element into the container constructed in-place with the
+  // given args, if there is no element with the equivalent value in the
+  // container.
+  template <class... Args>
+  constexpr auto emplace(Args&&... args) -> std::pair<iterator, bool> {
+    return InsertImpl(value_type(std::forward<Args>(args)...));
+  }
+
+  // Removes the element at pos.
+  // Returns iterator following the removed element.
+  constexpr auto erase(const const_iterator pos) -> iterator {
+    return keys_.erase(pos);
+  }
+
+  // Removes the element (if one exists) equivalent to key.
+  // Returns the number of elements removed (0 or 1).
+  constexpr auto erase(const key_type& key) -> size_type {
+    const size_type index = FindIndex(key);
+    if (index == size()) {
+      return 0;
+    }
+    keys_.erase(keys_.begin() + index);
+    return 1;
+  }
+
+  // Erases all elements from the container. After this call, size() returns
+  // zero.
+  constexpr void clear() noexcept { keys_.clear(); }
+
+  // Exchanges the contents of the container with those of other.
+  constexpr void swap(StaticFlatSet& other) {
+    keys_.swap(other.keys_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Lookup
+  // ======
+
+  // Returns the number of elements with key that compares equivalent to the
+  // specified argument (0 or 1).
+  constexpr auto count(const key_type& key) const -> size_type {
+    return contains(key);
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto count(const K& key) const -> size_type {
+    return contains(key);
+  }
+
+  // Finds an element with key equivalent to key.
+  // If no such element is found, past-the-end iterator is returned.
+  constexpr auto find(const key_type& key) const -> const_iterator {
+    return begin() + FindIndex(key);
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto find(const K& key) const -> const_iterator {
+    return begin() + FindIndex(key);
+  }
+
+  // Checks if there is an element with key equivalent to key in the container.
+  constexpr auto contains(const key_type& key) const -> bool {
+    return FindIndex(key) != size();
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto contains(const K& key) const -> bool {
+    return FindIndex(key) != size();
+  }
+
+  // Returns an iterator pointing to the first element that is not less than
+  // key.
+  constexpr auto lower_bound(const key_type& key) const -> const_iterator {
+    return begin() + LowerBoundIndex(key);
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto lower_bound(const K& key) const -> const_iterator {
+    return begin() + LowerBoundIndex(key);
+  }
+
+  // Returns an iterator pointing to the first element that is greater than
+  // key.
+  constexpr auto upper_bound(const key_type& key) const -> const_iterator {
+    return begin() + UpperBoundIndex(key);
+  }
+  template <class K, class = internal::EnableIfTransparent<Compare, K>>
+  constexpr auto upper_bound(const K& key) const -> const_iterator {
+    return begin() + UpperBoundIndex(key);
+  }
+
+  // Observers
+  // =========
+
+  // Returns the function object that compares the keys.
+  constexpr auto key_comp() const -> key_compare { return comp_; }
+  constexpr auto value_comp() const -> value_compare { return comp_; }
+
+ private:
+  template <class K>
+  constexpr auto LowerBoundIndex(const K& key) const -> size_type {
+    return internal::LowerBound<N>(keys_.data(), keys_.size(), key, comp_);
+  }
+  template <class K>
+  constexpr auto UpperBoundIndex(const K& key) const -> size_type {
+    return internal::UpperBound<N>(keys_.data(), keys_.size(), key, comp_);
+  }
+  template <class K>
+  constexpr auto FindIndex(const K& key) const -> size_type {
+    return internal::Find<N>(keys_.data(), keys_.size(), key, comp_);
+  }
+
+  template <class ValueType>
+  constexpr auto InsertImpl(ValueType&& value) -> std::pair<iterator, bool> {
+    const size_type index = LowerBoundIndex(value);
+    if (index != size() && !comp_(value, keys_[index])) {
+      return {begin() + index, false};
+    }
+
+    TL_STATIC_FLAT_MAP_THROW_IF(std::length_error, size() == max_size());
+
+    keys_.emplace(keys_.begin() + index, std::forward<ValueType>(value));
+
+    return {begin() + index, true};
+  }
+
+  // Merge sorted elements into the container.
+  //
+  // Elements which are already present in the container are ignored, and only
+  // the first element out of the equivalent ones is inserted.
+  constexpr void MergeSortedElements(
+      internal::StaticVector<value_type, N>& elements) {
+    if (elements.empty()) {
+      return;
+    }
+
+    const size_type num_elements = elements.size();
+    const size_type num_existing = size();
+
+    // Check the merged elements fit prior to modifying the container.
+    size_type num_new_keys = 0;
+    for (size_type j = 0; j < num_elements; ++j) {
+      if ((j == 0 || comp_(elements[j - 1], elements[j])) &&
+          FindIndex(elements[j]) == num_existing) {
+        ++num_new_keys;
+      }
+    }
+    TL_STATIC_FLAT_MAP_THROW_IF(std::length_error,
+                                num_existing + num_new_keys > max_size());
+
+    internal::StaticVector<key_type, N> new_keys;
+
+    size_type i = 0;
+    size_type j = 0;
+    while (i < num_existing || j < num_elements) {
+      if (j == num_elements ||
+          (i < num_existing && !comp_(elements[j], keys_[i]))) {
+        // Skip new elements which are equivalent to the existing one.
+        while (j < num_elements && !comp_(keys_[i], elements[j])) {
+          ++j;
+        }
+        new_keys.emplace_back(std::move(keys_[i]));
+        ++i;
+        continue;
+      }
+
+      new_keys.emplace_back(std::move(elements[j]));
+
+      // Skip the following new elements with the equivalent key.
+      const key_type& key = new_keys.back();
+      ++j;
+      while (j < num_elements && !comp_(key, elements[j])) {
+        ++j;
+      }
+    }
+
+    keys_ = std::move(new_keys);
+  }
+
+  internal::StaticVector<key_type, N> keys_;
+
+  [[no_unique_address]] key_compare comp_;
+};
+
+// Checks if the contents of lhs and rhs are equal, that is, they have the same
+// number of elements and each element in lhs compares equal with the element in
+// rhs at the same position.
+template <class Key, std::size_t N, class Compare>
+constexpr auto operator==(const StaticFlatSet<Key, N, Compare>& lhs,
+                          const StaticFlatSet<Key, N, Compare>& rhs) -> bool {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+// Specializes the swap() algorithm for StaticFlatSet.
+// Swaps the contents of lhs and rhs. Equivalent to `lhs.swap(rhs)`.
+template <class Key, std::size_t N, class Compare>
+constexpr void swap(StaticFlatSet<Key, N, Compare>& lhs,
+                    StaticFlatSet<Key, N, Compare>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+// Erases all elements that satisfy the predicate pred from the container.
+// Returns the number of erased elements.
+template <class Key, std::size_t N, class Compare, class Pred>
+constexpr auto erase_if(StaticFlatSet<Key, N, Compare>& c, Pred pred) ->
+    typename StaticFlatSet<Key, N, Compare>::size_type {
+  const auto old_size = c.size();
+  for (auto it = c.begin(); it != c.end();) {
+    if (pred(*it)) {
+      it = c.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return old_size - c.size();
+}
+
+// NOLINTEND(readability-identifier-naming)
+
+}  // namespace TL_STATIC_FLAT_MAP_VERSION_NAMESPACE
+}  // namespace TL_STATIC_FLAT_MAP_NAMESPACE
+
+#undef TL_STATIC_FLAT_MAP_VERSION_MAJOR
+#undef TL_STATIC_FLAT_MAP_VERSION_MINOR
+#undef TL_STATIC_FLAT_MAP_VERSION_REVISION
+
+#undef TL_STATIC_FLAT_MAP_NAMESPACE
+#undef TL_STATIC_FLAT_MAP_STATIC_VECTOR_NAMESPACE
+
+#undef TL_STATIC_FLAT_MAP_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_FLAT_MAP_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_FLAT_MAP_VERSION_NAMESPACE
+
+#undef TL_STATIC_FLAT_MAP_THROW_IF
+
+#undef TL_STATIC_FLAT_MAP_LINEAR_SEARCH_MAX_SIZE
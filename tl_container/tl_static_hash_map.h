@@ -0,0 +1,1058 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A fixed capacity hash map with open addressing.
+//
+// StaticHashMap implements an API similar to the std::unordered_map, but uses
+// in-object storage of a static size and never allocates.
+//
+// The capacity N denotes the number of slots in the table and is required to
+// be a power of two. To keep the probe sequences short the table is not allowed
+// to be filled above 7/8 of its slots, so max_size() is less than N.
+//
+// Implementation
+// ==============
+//
+// The table follows the design of the Swiss tables. Every slot has a control
+// byte which is either empty, or holds 7 bits of the hash of the key stored in
+// the slot (H2). The rest of the hash bits (H1) define the home slot of the
+// key.
+//
+// The lookup loads a group of control bytes starting at the home slot, and
+// compares all of them against the H2 of the requested key at once. Only the
+// slots which have matching control byte have their keys compared. The search
+// stops at the first group which has an empty slot.
+//
+// When SSE2 or NEON are available a group has 16 slots and is processed using
+// vector instructions. Otherwise a group of 8 slots is processed by a portable
+// scalar code. The control bytes of the first group are cloned past the end of
+// the table, so that a group can be loaded starting at any slot.
+//
+// The probing is linear, which allows to erase elements without leaving a
+// tombstone: the elements which follow the erased one in its probe sequence are
+// shifted back (backward-shift deletion). This keeps the lookup performance
+// stable regardless of the history of insertions and erasures.
+//
+// Keys and mapped values are stored in separate arrays, so that probing only
+// touches memory of keys.
+//
+// Hashing
+// =======
+//
+// The default hasher provides a fast hash for integral keys, and for keys which
+// are convertible to std::string_view (such as StaticString and CStringView).
+// Other types are hashed using std::hash followed by a bit mixing.
+//
+// The default hasher and key equality comparator are transparent: lookup
+// functions accept any type which is hashed and compared consistently with the
+// key type. String-like types are compared as string views.
+//
+//
+// Exceptions
+// ==========
+//
+// General notes on exceptions:
+//
+//  - If an exception is thrown for any reason, functions have effect (strong
+//    exception guarantee).
+//
+//  - If an operation would result in size() > max_size(), an std::length_error
+//    exception is throw.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+//
+// Limitations
+// ===========
+//
+//  - Erasing an element might move other elements, which invalidates all
+//    iterators and references. Because of this erase(pos) does not return an
+//    iterator.
+//
+//  - The iterators are proxy iterators: dereferencing them gives a pair of
+//    references to the key and the mapped value.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "tl_build_config/tl_build_config.h"
+
+// Semantic version of the tl_static_hash_map library.
+#define TL_STATIC_HASH_MAP_VERSION_MAJOR 0
+#define TL_STATIC_HASH_MAP_VERSION_MINOR 0
+#define TL_STATIC_HASH_MAP_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_HASH_MAP_NAMESPACE
+#  define TL_STATIC_HASH_MAP_NAMESPACE tiny_lib::static_hash_map
+#endif
+
+// Helpers for TL_STATIC_HASH_MAP_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_HASH_MAP_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)      \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_HASH_MAP_VERSION_NAMESPACE_CONCAT(id1, id2, id3)             \
+  TL_STATIC_HASH_MAP_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_HASH_MAP_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_HASH_MAP_VERSION_NAMESPACE                                   \
+  TL_STATIC_HASH_MAP_VERSION_NAMESPACE_CONCAT(                                 \
+      TL_STATIC_HASH_MAP_VERSION_MAJOR,                                        \
+      TL_STATIC_HASH_MAP_VERSION_MINOR,                                        \
+      TL_STATIC_HASH_MAP_VERSION_REVISION)
+
+// Throw an exception of the given type ExceptionType if the expression is
+// evaluated to a truthful value.
+// The default implementation throws an ExceptionType(#expression) if the
+// condition is met.
+// If the default behavior is not suitable for the application it should define
+// TL_STATIC_HASH_MAP_THROW_IF prior to including this header. The provided
+// implementation is not to return, otherwise an undefined behavior of memory
+// corruption will happen.
+#if !defined(TL_STATIC_HASH_MAP_THROW_IF)
+#  define TL_STATIC_HASH_MAP_THROW_IF(ExceptionType, expression)               \
+    internal::ThrowIfOrAbort<ExceptionType>(expression, #expression)
+#endif
+
+// Instruction sets used for the group probing described above. Can be defined
+// to 0 by the application to use the portable groups of 8 slots.
+#if !defined(TL_STATIC_HASH_MAP_USE_SSE2)
+#  define TL_STATIC_HASH_MAP_USE_SSE2 ISA_CPU_X86_SSE2
+#endif
+#if !defined(TL_STATIC_HASH_MAP_USE_NEON)
+#  define TL_STATIC_HASH_MAP_USE_NEON (ISA_CPU_ARM_NEON && ARCH_CPU_LITTLE_ENDIAN)
+#endif
+
+#if TL_STATIC_HASH_MAP_USE_SSE2
+#  include <emmintrin.h>
+#elif TL_STATIC_HASH_MAP_USE_NEON
+#  include <arm_neon.h>
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_HASH_MAP_NAMESPACE {
+inline namespace TL_STATIC_HASH_MAP_VERSION_NAMESPACE {
+
+namespace internal {
+
+// If the exceptions are enabled throws a new exception of the given type
+// passing the given expression_str to its constructor as a reason. If the
+// exceptions are disabled aborts the program execution.
+template <class Exception>
+[[noreturn]] inline constexpr void ThrowOrAbort(const char* expression_str) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  throw Exception(expression_str);
+#else
+  (void)expression_str;
+  __builtin_abort();
+#endif
+}
+
+// A default implementation of the TL_STATIC_HASH_MAP_THROW_IF().
+template <class Exception>
+inline constexpr void ThrowIfOrAbort(const bool expression_eval,
+                                     const char* expression_str) {
+  if (expression_eval) {
+    ThrowOrAbort<Exception>(expression_str);
+  }
+}
+
+// Finalization mix of the MurmurHash3, which makes every bit of the input to
+// affect every bit of the result.
+inline constexpr auto MixBits(uint64_t x) -> uint64_t {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+// Hash of a sequence of bytes which processes 8 bytes at a time.
+inline auto HashBytes(const std::string_view bytes) -> uint64_t {
+  constexpr uint64_t kMultiplier = 0x9e3779b97f4a7c15ULL;
+
+  const char* ptr = bytes.data();
+  std::size_t length = bytes.size();
+
+  uint64_t hash = uint64_t(length) * kMultiplier;
+
+  while (length >= 8) {
+    uint64_t word;
+    std::memcpy(&word, ptr, 8);
+    hash = (hash ^ word) * kMultiplier;
+    hash ^= hash >> 32;
+    ptr += 8;
+    length -= 8;
+  }
+
+  if (length) {
+    uint64_t word = 0;
+    std::memcpy(&word, ptr, length);
+    hash = (hash ^ word) * kMultiplier;
+  }
+
+  return MixBits(hash);
+}
+
+template <class T>
+inline constexpr bool kIsStringLike =
+    std::is_convertible_v<const T&, std::string_view>;
+
+}  // namespace internal
+
+// Transparent hasher which is used by default by the StaticHashMap.
+struct Hash {
+  using is_transparent = void;
+
+  template <class T>
+  auto operator()(const T& value) const noexcept -> std::size_t {
+    if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+      return std::size_t(internal::MixBits(uint64_t(value)));
+    } else if constexpr (internal::kIsStringLike<T>) {
+      return std::size_t(internal::HashBytes(std::string_view(value)));
+    } else {
+      return std::size_t(internal::MixBits(std::hash<T>{}(value)));
+    }
+  }
+};
+
+// Transparent key equality comparator which is used by default by the
+// StaticHashMap.
+//
+// Compares arguments which are both convertible to std::string_view as string
+// views, and uses operator== for all other types.
+struct EqualTo {
+  using is_transparent = void;
+
+  template <class T, class U>
+  constexpr auto operator()(const T& lhs, const U& rhs) const -> bool {
+    if constexpr (internal::kIsStringLike<T> && internal::kIsStringLike<U>) {
+      return std::string_view(lhs) == std::string_view(rhs);
+    } else {
+      return lhs == rhs;
+    }
+  }
+};
+
+namespace internal {
+
+// Control byte of a slot.
+//
+// The empty slot has the most significant bit set, a full slot stores 7 bits of
+// the hash of its key.
+using ControlByte = int8_t;
+inline constexpr ControlByte kEmpty = -128;
+
+// Mask of slots within a group which satisfy a condition.
+//
+// Every slot is represented with (1 << Shift) bits of the mask, of which only
+// the lowest one is set when the condition is satisfied.
+template <int Shift>
+class BitMask {
+ public:
+  constexpr explicit BitMask(const uint64_t mask) : mask_(mask) {}
+
+  constexpr explicit operator bool() const { return mask_ != 0; }
+
+  // Index of the lowest slot in the mask.
+  constexpr auto LowestIndex() const -> std::size_t {
+    return std::size_t(std::countr_zero(mask_)) >> Shift;
+  }
+
+  // Remove the lowest slot from the mask.
+  constexpr void ClearLowest() { mask_ &= mask_ - 1; }
+
+ private:
+  uint64_t mask_;
+};
+
+#if TL_STATIC_HASH_MAP_USE_SSE2
+
+// A group of control bytes processed using SSE2 instructions.
+class Group {
+ public:
+  static constexpr std::size_t kWidth = 16;
+
+  explicit Group(const ControlByte* ctrl)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+  // Slots which have control byte equal to the given hash bits.
+  auto Match(const ControlByte h2) const -> BitMask<0> {
+    return BitMask<0>(uint32_t(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_))));
+  }
+
+  // Slots which are empty.
+  auto MatchEmpty() const -> BitMask<0> {
+    return BitMask<0>(uint32_t(_mm_movemask_epi8(ctrl_)));
+  }
+
+ private:
+  __m128i ctrl_;
+};
+
+#elif TL_STATIC_HASH_MAP_USE_NEON
+
+// A group of control bytes processed using NEON instructions.
+//
+// NEON does not have an equivalent of the movemask, so the comparison result
+// is narrowed to 4 bits per slot.
+class Group {
+ public:
+  static constexpr std::size_t kWidth = 16;
+
+  explicit Group(const ControlByte* ctrl) : ctrl_(vld1q_s8(ctrl)) {}
+
+  // Slots which have control byte equal to the given hash bits.
+  auto Match(const ControlByte h2) const -> BitMask<2> {
+    return ToBitMask(vceqq_s8(ctrl_, vdupq_n_s8(h2)));
+  }
+
+  // Slots which are empty.
+  auto MatchEmpty() const -> BitMask<2> {
+    return ToBitMask(vcltzq_s8(ctrl_));
+  }
+
+ private:
+  static auto ToBitMask(const uint8x16_t eq) -> BitMask<2> {
+    const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+    return BitMask<2>(vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) &
+                      0x8888888888888888ULL);
+  }
+
+  int8x16_t ctrl_;
+};
+
+#else
+
+// A group of control bytes processed using portable scalar code.
+class Group {
+ public:
+  static constexpr std::size_t kWidth = 8;
+
+  explicit Group(const ControlByte* ctrl) : ctrl_(ctrl) {}
+
+  // Slots which have control byte equal to the given hash bits.
+  auto Match(const ControlByte h2) const -> BitMask<0> {
+    uint64_t mask = 0;
+    for (std::size_t i = 0; i < kWidth; ++i) {
+      mask |= uint64_t(ctrl_[i] == h2) << i;
+    }
+    return BitMask<0>(mask);
+  }
+
+  // Slots which are empty.
+  auto MatchEmpty() const -> BitMask<0> { return Match(kEmpty); }
+
+ private:
+  const ControlByte* ctrl_;
+};
+
+#endif
+
+}  // namespace internal
+
+// The code follows the STL naming convention for easier interchangeability with
+// the standard containers.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+template <class Key,
+          class T,
+          std::size_t N,
+          class HashType = Hash,
+          class KeyEqual = EqualTo>
+class StaticHashMap {
+  template <bool IsConst>
+  class Iterator;
+
+ public:
+  static_assert(N >= 2 && (N & (N - 1)) == 0,
+                "Capacity of the hash map must be a power of two");
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member types.
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = HashType;
+  using key_equal = KeyEqual;
+  using reference = std::pair<const key_type&, mapped_type&>;
+  using const_reference = std::pair<const key_type&, const mapped_type&>;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member functions.
+
+  // Default constructor.
+  // Constructs an empty container.
+  StaticHashMap() { ResetControl(); }
+
+  // Constructs an empty container with the given hasher and key equality
+  // comparator.
+  explicit StaticHashMap(const hasher& hash,
+                         const key_equal& equal = key_equal())
+      : hash_(hash), key_equal_(equal) {
+    ResetControl();
+  }
+
+  // Constructs the container with the contents of the initializer list ilist.
+  // If multiple elements in the list have keys that compare equivalent, only
+  // the first of them is inserted.
+  StaticHashMap(std::initializer_list<value_type> ilist) : StaticHashMap() {
+    insert(ilist);
+  }
+
+  // Copy constructor.
+  // Constructs the container with the copy of the contents of other.
+  StaticHashMap(const StaticHashMap& other)
+      : hash_(other.hash_), key_equal_(other.key_equal_) {
+    CopyFrom(other);
+  }
+
+  // Move constructor.
+  // Constructs the container with the contents of other using move semantics.
+  // After the move, other is guaranteed to be empty().
+  StaticHashMap(StaticHashMap&& other) noexcept
+      : hash_(std::move(other.hash_)), key_equal_(std::move(other.key_equal_)) {
+    MoveFrom(other);
+  }
+
+  ~StaticHashMap() { clear(); }
+
+  // Copy assignment operator.
+  // Replaces the contents with a copy of the contents of other.
+  auto operator=(const StaticHashMap& other) -> StaticHashMap& {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+    hash_ = other.hash_;
+    key_equal_ = other.key_equal_;
+    CopyFrom(other);
+
+    return *this;
+  }
+
+  // Move assignment operator.
+  // Replaces the contents with those of other using move semantics. After the
+  // move, other is guaranteed to be empty().
+  auto operator=(StaticHashMap&& other) noexcept -> StaticHashMap& {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+    hash_ = std::move(other.hash_);
+    key_equal_ = std::move(other.key_equal_);
+    MoveFrom(other);
+
+    return *this;
+  }
+
+  // Element access
+  // ==============
+
+  // Returns a reference to the mapped value of the element with the specified
+  // key. If no such element exists, an exception of type std::out_of_range is
+  // thrown.
+  template <class K = key_type>
+  auto at(const K& key) -> mapped_type& {
+    const size_type slot = FindSlot(key);
+    TL_STATIC_HASH_MAP_THROW_IF(std::out_of_range, slot == N);
+    return *GetValuePointer(slot);
+  }
+  template <class K = key_type>
+  auto at(const K& key) const -> const mapped_type& {
+    const size_type slot = FindSlot(key);
+    TL_STATIC_HASH_MAP_THROW_IF(std::out_of_range, slot == N);
+    return *GetValuePointer(slot);
+  }
+
+  // Returns a reference to the value that is mapped to the given key,
+  // performing an insertion of a value-initialized mapped value if such key
+  // does not already exist.
+  auto operator[](const key_type& key) -> mapped_type& {
+    return try_emplace(key).first->second;
+  }
+  auto operator[](key_type&& key) -> mapped_type& {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  // Iterators
+  // =========
+
+  // Returns an iterator to the first element of the container.
+  auto begin() noexcept -> iterator { return {this, NextFullSlot(0)}; }
+  auto begin() const noexcept -> const_iterator {
+    return {this, NextFullSlot(0)};
+  }
+  auto cbegin() const noexcept -> const_iterator {
+    return {this, NextFullSlot(0)};
+  }
+
+  // Returns an iterator to the element following the last element of the
+  // container.
+  auto end() noexcept -> iterator { return {this, N}; }
+  auto end() const noexcept -> const_iterator { return {this, N}; }
+  auto cend() const noexcept -> const_iterator { return {this, N}; }
+
+  // Capacity
+  // ========
+
+  // Checks if the container has no elements, i.e. whether begin() == end().
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+  // Returns the number of elements in the container.
+  auto size() const noexcept -> size_type { return size_; }
+
+  // Returns the maximum number of elements the container is able to hold.
+  constexpr auto max_size() const noexcept -> size_type { return kMaxSize; }
+
+  // Returns the number of slots in the table.
+  constexpr auto bucket_count() const noexcept -> size_type { return N; }
+
+  // Modifiers
+  // =========
+
+  // Erases all elements from the container. After this call, size() returns
+  // zero.
+  void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<key_type> ||
+                  !std::is_trivially_destructible_v<mapped_type>) {
+      for (size_type slot = 0; slot < N; ++slot) {
+        if (ctrl_[slot] != internal::kEmpty) {
+          DestroySlot(slot);
+        }
+      }
+    }
+
+    ResetControl();
+    size_ = 0;
+  }
+
+  // Inserts element into the container, if the container doesn't already
+  // contain an element with an equivalent key.
+  //
+  // Returns a pair consisting of an iterator to the inserted element (or to the
+  // element that prevented the insertion) and a bool value set to true if and
+  // only if the insertion took place.
+  auto insert(const value_type& value) -> std::pair<iterator, bool> {
+    return try_emplace(value.first, value.second);
+  }
+  auto insert(value_type&& value) -> std::pair<iterator, bool> {
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+
+  // Inserts elements from range [first, last).
+  // If multiple elements in the range have keys that compare equivalent, only
+  // the first of them is inserted.
+  template <class InputIt,
+            class = std::enable_if_t<std::input_iterator<InputIt>>>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  // Inserts elements from initializer list ilist.
+  void insert(std::initializer_list<value_type> ilist) {
+    insert(ilist.begin(), ilist.end());
+  }
+
+  // Inserts a new element into the container constructed in-place with the
+  // given args, if there is no element with the key in the container.
+  template <class... Args>
+  auto emplace(Args&&... args) -> std::pair<iterator, bool> {
+    value_type value(std::forward<Args>(args)...);
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+
+  // If a key equivalent to key already exists in the container, does nothing.
+  // Otherwise, inserts a new element into the container with key key and value
+  // constructed with args.
+  template <class... Args>
+  auto try_emplace(const key_type& key, Args&&... args)
+      -> std::pair<iterator, bool> {
+    return TryEmplaceImpl(key, std::forward<Args>(args)...);
+  }
+  template <class... Args>
+  auto try_emplace(key_type&& key, Args&&... args)
+      -> std::pair<iterator, bool> {
+    return TryEmplaceImpl(std::move(key), std::forward<Args>(args)...);
+  }
+
+  // If a key equivalent to key already exists in the container, assigns obj to
+  // the mapped value. If the key does not exist, inserts the new value.
+  template <class M>
+  auto insert_or_assign(const key_type& key, M&& obj)
+      -> std::pair<iterator, bool> {
+    auto result = TryEmplaceImpl(key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+  template <class M>
+  auto insert_or_assign(key_type&& key, M&& obj) -> std::pair<iterator, bool> {
+    auto result = TryEmplaceImpl(std::move(key), std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+
+  // Removes the element at pos.
+  // Invalidates all iterators and references to the elements.
+  void erase(const const_iterator pos) { EraseSlot(pos.slot_); }
+  void erase(const iterator pos) { EraseSlot(pos.slot_); }
+
+  // Removes the element (if one exists) with the key equivalent to key.
+  // Returns the number of elements removed (0 or 1).
+  template <class K = key_type>
+  auto erase(const K& key) -> size_type {
+    const size_type slot = FindSlot(key);
+    if (slot == N) {
+      return 0;
+    }
+    EraseSlot(slot);
+    return 1;
+  }
+
+  // Erases all elements that satisfy the predicate pred from the container.
+  // The predicate is called with a const_reference to the elements, and might
+  // be called more than once for the same element.
+  // Returns the number of erased elements.
+  template <class Pred>
+  friend auto erase_if(StaticHashMap& c, Pred pred) -> size_type {
+    const size_type old_size = c.size();
+
+    size_type slot = 0;
+    while (slot < N) {
+      if (c.ctrl_[slot] != internal::kEmpty &&
+          pred(const_reference(*c.GetKeyPointer(slot),
+                               *c.GetValuePointer(slot)))) {
+        // The erasure might move the following element into the erased slot,
+        // so the slot is to be checked again.
+        c.EraseSlot(slot);
+        continue;
+      }
+      ++slot;
+    }
+
+    return old_size - c.size();
+  }
+
+  // Exchanges the contents of the container with those of other.
+  void swap(StaticHashMap& other) {
+    StaticHashMap tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  // Lookup
+  // ======
+
+  // Returns the number of elements with key that compares equivalent to the
+  // specified argument (0 or 1).
+  template <class K = key_type>
+  auto count(const K& key) const -> size_type {
+    return contains(key);
+  }
+
+  // Finds an element with key equivalent to key.
+  // If no such element is found, past-the-end iterator is returned.
+  template <class K = key_type>
+  auto find(const K& key) -> iterator {
+    return {this, FindSlot(key)};
+  }
+  template <class K = key_type>
+  auto find(const K& key) const -> const_iterator {
+    return {this, FindSlot(key)};
+  }
+
+  // Checks if there is an element with key equivalent to key in the container.
+  template <class K = key_type>
+  auto contains(const K& key) const -> bool {
+    return FindSlot(key) != N;
+  }
+
+  // Observers
+  // =========
+
+  // Returns the function that hashes the keys.
+  auto hash_function() const -> hasher { return hash_; }
+
+  // Returns the function that compares keys for equality.
+  auto key_eq() const -> key_equal { return key_equal_; }
+
+ private:
+  // Maximum number of elements which keeps at least 1/8 of the slots empty.
+  static constexpr size_type kMaxSize = N - (N / 8 > 0 ? N / 8 : 1);
+
+  static constexpr size_type kSlotMask = N - 1;
+  static constexpr size_type kGroupWidth = internal::Group::kWidth;
+
+  // Iterator over elements of the map.
+  template <bool IsConst>
+  class Iterator {
+    using Container =
+        std::conditional_t<IsConst, const StaticHashMap, StaticHashMap>;
+
+    // Helper which allows to use operator-> on the proxy iterator.
+    template <class Reference>
+    class ArrowProxy {
+     public:
+      explicit ArrowProxy(Reference reference) : reference_(reference) {}
+      auto operator->() -> Reference* { return &reference_; }
+
+     private:
+      Reference reference_;
+    };
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<key_type, mapped_type>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<IsConst,
+                                         StaticHashMap::const_reference,
+                                         StaticHashMap::reference>;
+    using pointer = ArrowProxy<reference>;
+
+    Iterator() = default;
+    Iterator(Container* container, const size_type slot)
+        : container_(container), slot_(slot) {}
+
+    // Allow conversion from mutable to constant iterator.
+    template <bool OtherIsConst,
+              class = std::enable_if_t<IsConst && !OtherIsConst>>
+    Iterator(const Iterator<OtherIsConst>& other)
+        : container_(other.container_), slot_(other.slot_) {}
+
+    auto operator*() const -> reference {
+      return {*container_->GetKeyPointer(slot_),
+              *container_->GetValuePointer(slot_)};
+    }
+    auto operator->() const -> pointer { return pointer(**this); }
+
+    auto operator++() -> Iterator& {
+      slot_ = container_->NextFullSlot(slot_ + 1);
+      return *this;
+    }
+    auto operator++(int) -> Iterator {
+      Iterator result = *this;
+      ++*this;
+      return result;
+    }
+
+    friend auto operator==(const Iterator& lhs, const Iterator& rhs) -> bool {
+      return lhs.slot_ == rhs.slot_;
+    }
+
+   private:
+    friend class StaticHashMap;
+    friend class Iterator<!IsConst>;
+
+    Container* container_{nullptr};
+    size_type slot_{N};
+  };
+
+  // Split of the hash into the home slot and the control byte.
+  static auto H1(const size_type hash) -> size_type { return hash >> 7; }
+  static auto H2(const size_type hash) -> internal::ControlByte {
+    return internal::ControlByte(hash & 0x7f);
+  }
+
+  auto GetKeyPointer(const size_type slot) noexcept -> key_type* {
+    return reinterpret_cast<key_type*>(keys_) + slot;
+  }
+  auto GetKeyPointer(const size_type slot) const noexcept -> const key_type* {
+    return reinterpret_cast<const key_type*>(keys_) + slot;
+  }
+  auto GetValuePointer(const size_type slot) noexcept -> mapped_type* {
+    return reinterpret_cast<mapped_type*>(values_) + slot;
+  }
+  auto GetValuePointer(const size_type slot) const noexcept
+      -> const mapped_type* {
+    return reinterpret_cast<const mapped_type*>(values_) + slot;
+  }
+
+  // Mark all slots as empty.
+  void ResetControl() noexcept {
+    std::memset(ctrl_, internal::kEmpty, sizeof(ctrl_));
+  }
+
+  // Set control byte of the slot, keeping the cloned bytes past the end of the
+  // table up to date.
+  //
+  // When the table is smaller than a group the cloned bytes repeat the table
+  // multiple times.
+  void SetControl(const size_type slot, const internal::ControlByte value) {
+    ctrl_[slot] = value;
+    for (size_type i = slot + N; i < N + kGroupWidth; i += N) {
+      ctrl_[i] = value;
+    }
+  }
+
+  // Index of the first full slot starting from the given one, or N if there
+  // are no more full slots.
+  auto NextFullSlot(size_type slot) const -> size_type {
+    while (slot < N && ctrl_[slot] == internal::kEmpty) {
+      ++slot;
+    }
+    return slot;
+  }
+
+  // Find slot which contains the key, or N if there is no such key.
+  template <class K>
+  auto FindSlot(const K& key) const -> size_type {
+    const size_type hash = hash_(key);
+    const internal::ControlByte h2 = H2(hash);
+
+    size_type pos = H1(hash) & kSlotMask;
+    while (true) {
+      const internal::Group group(ctrl_ + pos);
+
+      for (auto match = group.Match(h2); match; match.ClearLowest()) {
+        const size_type slot = (pos + match.LowestIndex()) & kSlotMask;
+        if (key_equal_(*GetKeyPointer(slot), key)) {
+          return slot;
+        }
+      }
+
+      if (group.MatchEmpty()) {
+        return N;
+      }
+
+      pos = (pos + kGroupWidth) & kSlotMask;
+    }
+  }
+
+  // Find slot which contains the key, or an empty slot where the key is to be
+  // inserted.
+  // The returned boolean is true if the key was found.
+  template <class K>
+  auto FindOrPrepareInsert(const K& key, const size_type hash) const
+      -> std::pair<size_type, bool> {
+    const internal::ControlByte h2 = H2(hash);
+
+    size_type pos = H1(hash) & kSlotMask;
+    while (true) {
+      const internal::Group group(ctrl_ + pos);
+
+      for (auto match = group.Match(h2); match; match.ClearLowest()) {
+        const size_type slot = (pos + match.LowestIndex()) & kSlotMask;
+        if (key_equal_(*GetKeyPointer(slot), key)) {
+          return {slot, true};
+        }
+      }
+
+      if (const auto empty = group.MatchEmpty()) {
+        return {(pos + empty.LowestIndex()) & kSlotMask, false};
+      }
+
+      pos = (pos + kGroupWidth) & kSlotMask;
+    }
+  }
+
+  template <class KeyType, class... Args>
+  auto TryEmplaceImpl(KeyType&& key, Args&&... args)
+      -> std::pair<iterator, bool> {
+    const size_type hash = hash_(key);
+    const auto [slot, found] = FindOrPrepareInsert(key, hash);
+    if (found) {
+      return {iterator(this, slot), false};
+    }
+
+    TL_STATIC_HASH_MAP_THROW_IF(std::length_error, size_ == kMaxSize);
+
+    // Construct the value first: if it throws the container stays unchanged.
+    new (GetValuePointer(slot)) mapped_type(std::forward<Args>(args)...);
+    if constexpr (std::is_nothrow_constructible_v<key_type, KeyType&&>) {
+      new (GetKeyPointer(slot)) key_type(std::forward<KeyType>(key));
+    } else {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+      try {
+        new (GetKeyPointer(slot)) key_type(std::forward<KeyType>(key));
+      } catch (...) {
+        GetValuePointer(slot)->~mapped_type();
+        throw;
+      }
+#else
+      new (GetKeyPointer(slot)) key_type(std::forward<KeyType>(key));
+#endif
+    }
+
+    SetControl(slot, H2(hash));
+    ++size_;
+
+    return {iterator(this, slot), true};
+  }
+
+  void DestroySlot(const size_type slot) {
+    GetKeyPointer(slot)->~key_type();
+    GetValuePointer(slot)->~mapped_type();
+  }
+
+  // Move element from one slot to another empty slot.
+  void MoveSlot(const size_type from, const size_type to) {
+    new (GetKeyPointer(to)) key_type(std::move(*GetKeyPointer(from)));
+    new (GetValuePointer(to)) mapped_type(std::move(*GetValuePointer(from)));
+    DestroySlot(from);
+    SetControl(to, ctrl_[from]);
+  }
+
+  // Erase element at the given full slot using backward-shift deletion.
+  //
+  // The elements which follow the erased one are moved back to fill in the
+  // hole, as long as the hole is not before their home slot. This keeps the
+  // invariant that there are no empty slots between the home slot of an
+  // element and its actual slot.
+  void EraseSlot(size_type hole) {
+    DestroySlot(hole);
+
+    size_type slot = hole;
+    while (true) {
+      slot = (slot + 1) & kSlotMask;
+      if (ctrl_[slot] == internal::kEmpty) {
+        break;
+      }
+
+      const size_type home = H1(hash_(*GetKeyPointer(slot))) & kSlotMask;
+
+      // Check whether the hole is within the cyclic range [home, slot].
+      if (((slot - home) & kSlotMask) >= ((slot - hole) & kSlotMask)) {
+        MoveSlot(slot, hole);
+        hole = slot;
+      }
+    }
+
+    SetControl(hole, internal::kEmpty);
+    --size_;
+  }
+
+  // Copy elements of other into the same slots of this empty map.
+  void CopyFrom(const StaticHashMap& other) {
+    ResetControl();
+    size_ = 0;
+    for (size_type slot = 0; slot < N; ++slot) {
+      if (other.ctrl_[slot] == internal::kEmpty) {
+        continue;
+      }
+      new (GetKeyPointer(slot)) key_type(*other.GetKeyPointer(slot));
+      new (GetValuePointer(slot)) mapped_type(*other.GetValuePointer(slot));
+      SetControl(slot, other.ctrl_[slot]);
+      ++size_;
+    }
+  }
+
+  // Move elements of other into the same slots of this empty map, and clear the
+  // other map.
+  void MoveFrom(StaticHashMap& other) {
+    ResetControl();
+    size_ = 0;
+    for (size_type slot = 0; slot < N; ++slot) {
+      if (other.ctrl_[slot] == internal::kEmpty) {
+        continue;
+      }
+      new (GetKeyPointer(slot)) key_type(std::move(*other.GetKeyPointer(slot)));
+      new (GetValuePointer(slot))
+          mapped_type(std::move(*other.GetValuePointer(slot)));
+      SetControl(slot, other.ctrl_[slot]);
+      ++size_;
+    }
+    other.clear();
+  }
+
+  // NOLINTBEGIN(modernize-avoid-c-arrays)
+  internal::ControlByte ctrl_[N + kGroupWidth];
+  alignas(key_type) uint8_t keys_[sizeof(key_type) * N];
+  alignas(mapped_type) uint8_t values_[sizeof(mapped_type) * N];
+  // NOLINTEND(modernize-avoid-c-arrays)
+
+  size_type size_{0};
+
+  [[no_unique_address]] hasher hash_;
+  [[no_unique_address]] key_equal key_equal_;
+};
+
+// Checks if the contents of lhs and rhs are equal, that is, they have the same
+// number of elements and each element in lhs has an element with the same key
+// and equal mapped value in rhs.
+template <class Key, class T, std::size_t N, class HashType, class KeyEqual>
+auto operator==(const StaticHashMap<Key, T, N, HashType, KeyEqual>& lhs,
+                const StaticHashMap<Key, T, N, HashType, KeyEqual>& rhs)
+    -> bool {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+
+  for (const auto& [key, value] : lhs) {
+    const auto it = rhs.find(key);
+    if (it == rhs.end() || !(it->second == value)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Specializes the swap() algorithm for StaticHashMap.
+// Swaps the contents of lhs and rhs. Equivalent to `lhs.swap(rhs)`.
+template <class Key, class T, std::size_t N, class HashType, class KeyEqual>
+void swap(StaticHashMap<Key, T, N, HashType, KeyEqual>& lhs,
+          StaticHashMap<Key, T, N, HashType, KeyEqual>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+// NOLINTEND(readability-identifier-naming)
+
+}  // namespace TL_STATIC_HASH_MAP_VERSION_NAMESPACE
+}  // namespace TL_STATIC_HASH_MAP_NAMESPACE
+
+#undef TL_STATIC_HASH_MAP_VERSION_MAJOR
+#undef TL_STATIC_HASH_MAP_VERSION_MINOR
+#undef TL_STATIC_HASH_MAP_VERSION_REVISION
+
+#undef TL_STATIC_HASH_MAP_NAMESPACE
+
+#undef TL_STATIC_HASH_MAP_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_HASH_MAP_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_HASH_MAP_VERSION_NAMESPACE
+
+#undef TL_STATIC_HASH_MAP_THROW_IF
+
+#undef TL_STATIC_HASH_MAP_USE_SSE2
+#undef TL_STATIC_HASH_MAP_USE_NEON
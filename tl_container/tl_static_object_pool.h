@@ -0,0 +1,609 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A fixed capacity pool of objects with O(1) creation and destruction.
+//
+// StaticObjectPool keeps storage for N objects of type T in-object, and never
+// allocates. Objects are created in any free slot of the pool, and destroyed
+// without moving other objects, so pointers and references to objects stay
+// valid until the objects themselves are destroyed.
+//
+//   StaticObjectPool<Session, 64> pool;
+//
+//   const Handle handle = pool.Create(arguments...);
+//   if (Session* session = pool.Get(handle)) {
+//     ...
+//   }
+//   pool.Destroy(handle);
+//
+// Free slots form an intrusive singly-linked list: the storage of a free slot
+// holds the index of the next free slot. Both Create() and Destroy() only touch
+// the head of the list.
+//
+// Handles
+// =======
+//
+// Objects are referred to by a Handle, which holds an index of the slot and a
+// generation of the slot at the time the object was created. The generation of
+// a slot changes every time its object is destroyed, which allows to detect
+// use of a handle to an object which was destroyed, even if the slot was reused
+// for another object since then.
+//
+// The generation is 32 bit and wraps around after 2^32 destructions of objects
+// in the same slot.
+//
+// Iteration
+// =========
+//
+// The pool keeps a dense array of indices of the alive objects, which allows to
+// iterate over the objects without visiting the free slots. Destroying an
+// object moves the last index of the dense array in place of the destroyed
+// one, so the iteration order is not the order of creation.
+//
+// Thread safety
+// =============
+//
+// StaticObjectPool is not thread-safe.
+//
+// ConcurrentStaticObjectPool allows Create() and Destroy() to be called from
+// multiple threads concurrently. The free list is a lock-free stack with the
+// head tagged by a counter to avoid the ABA problem. The concurrent pool does
+// not support iteration over the alive objects.
+//
+//
+// Exceptions
+// ==========
+//
+// General notes on exceptions:
+//
+//  - If an exception is thrown for any reason, functions have effect (strong
+//    exception guarantee).
+//
+//  - If an object is created in a pool which has no free slots, an
+//    std::length_error exception is throw.
+//
+//  - If an object is destroyed using a handle which does not refer to an alive
+//    object, an std::invalid_argument exception is throw.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Semantic version of the tl_static_object_pool library.
+#define TL_STATIC_OBJECT_POOL_VERSION_MAJOR 0
+#define TL_STATIC_OBJECT_POOL_VERSION_MINOR 0
+#define TL_STATIC_OBJECT_POOL_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_OBJECT_POOL_NAMESPACE
+#  define TL_STATIC_OBJECT_POOL_NAMESPACE tiny_lib::static_object_pool
+#endif
+
+// Helpers for TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)   \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE_CONCAT(id1, id2, id3)          \
+  TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE                                \
+  TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE_CONCAT(                              \
+      TL_STATIC_OBJECT_POOL_VERSION_MAJOR,                                     \
+      TL_STATIC_OBJECT_POOL_VERSION_MINOR,                                     \
+      TL_STATIC_OBJECT_POOL_VERSION_REVISION)
+
+// Throw an exception of the given type ExceptionType if the expression is
+// evaluated to a truthful value.
+// The default implementation throws an ExceptionType(#expression) if the
+// condition is met.
+// If the default behavior is not suitable for the application it should define
+// TL_STATIC_OBJECT_POOL_THROW_IF prior to including this header. The provided
+// implementation is not to return, otherwise an undefined behavior of memory
+// corruption will happen.
+#if !defined(TL_STATIC_OBJECT_POOL_THROW_IF)
+#  define TL_STATIC_OBJECT_POOL_THROW_IF(ExceptionType, expression)            \
+    internal::ThrowIfOrAbort<ExceptionType>(expression, #expression)
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_OBJECT_POOL_NAMESPACE {
+inline namespace TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE {
+
+namespace internal {
+
+// If the exceptions are enabled throws a new exception of the given type
+// passing the given expression_str to its constructor as a reason. If the
+// exceptions are disabled aborts the program execution.
+template <class Exception>
+[[noreturn]] inline constexpr void ThrowOrAbort(const char* expression_str) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  throw Exception(expression_str);
+#else
+  (void)expression_str;
+  __builtin_abort();
+#endif
+}
+
+// A default implementation of the TL_STATIC_OBJECT_POOL_THROW_IF().
+template <class Exception>
+inline constexpr void ThrowIfOrAbort(const bool expression_eval,
+                                     const char* expression_str) {
+  if (expression_eval) {
+    ThrowOrAbort<Exception>(expression_str);
+  }
+}
+
+// Index which denotes the end of the free list.
+inline constexpr uint32_t kInvalidIndex = ~uint32_t(0);
+
+}  // namespace internal
+
+// Reference to an object in a pool.
+//
+// A default constructed handle does not refer to any object.
+struct Handle {
+  uint32_t index{internal::kInvalidIndex};
+  uint32_t generation{0};
+
+  friend constexpr auto operator==(const Handle& lhs, const Handle& rhs)
+      -> bool = default;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticObjectPool.
+
+template <class T, std::size_t N>
+class StaticObjectPool {
+  template <bool IsConst>
+  class Iterator;
+
+ public:
+  static_assert(N > 0 && N < internal::kInvalidIndex);
+
+  // NOLINTBEGIN(readability-identifier-naming)
+  using value_type = T;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+  // NOLINTEND(readability-identifier-naming)
+
+  StaticObjectPool() { InitializeFreeList(); }
+
+  // The objects are referred by their handles which contain slot indices, so
+  // copying or moving the pool is not possible.
+  StaticObjectPool(const StaticObjectPool& other) = delete;
+  StaticObjectPool(StaticObjectPool&& other) noexcept = delete;
+  auto operator=(const StaticObjectPool& other) -> StaticObjectPool& = delete;
+  auto operator=(StaticObjectPool&& other) -> StaticObjectPool& = delete;
+
+  ~StaticObjectPool() { Clear(); }
+
+  // Create a new object in a free slot of the pool, passing the given
+  // arguments to its constructor.
+  //
+  // If there are no free slots an exception of type std::length_error is
+  // thrown.
+  template <class... Args>
+  auto Create(Args&&... args) -> Handle {
+    TL_STATIC_OBJECT_POOL_THROW_IF(std::length_error,
+                                   free_head_ == internal::kInvalidIndex);
+
+    const uint32_t index = free_head_;
+    Slot& slot = slots_[index];
+    const uint32_t next_free = slot.next_free;
+
+    new (slot.storage) T(std::forward<Args>(args)...);
+
+    free_head_ = next_free;
+    alive_[index] = true;
+
+    dense_index_[index] = num_alive_;
+    dense_[num_alive_] = index;
+    ++num_alive_;
+
+    return {index, generations_[index]};
+  }
+
+  // Destroy the object referred by the handle, making its slot available for
+  // new objects.
+  //
+  // If the handle does not refer to an alive object an exception of type
+  // std::invalid_argument is thrown.
+  void Destroy(const Handle handle) {
+    TL_STATIC_OBJECT_POOL_THROW_IF(std::invalid_argument, !IsAlive(handle));
+
+    const uint32_t index = handle.index;
+
+    GetObjectPointer(index)->~T();
+
+    alive_[index] = false;
+    ++generations_[index];
+
+    // Move the last dense index in place of the destroyed one.
+    const uint32_t dense_index = dense_index_[index];
+    const uint32_t last_index = dense_[num_alive_ - 1];
+    dense_[dense_index] = last_index;
+    dense_index_[last_index] = dense_index;
+    --num_alive_;
+
+    slots_[index].next_free = free_head_;
+    free_head_ = index;
+  }
+
+  // Get the object referred by the handle.
+  // Returns nullptr if the handle does not refer to an alive object.
+  auto Get(const Handle handle) -> T* {
+    return IsAlive(handle) ? GetObjectPointer(handle.index) : nullptr;
+  }
+  auto Get(const Handle handle) const -> const T* {
+    return IsAlive(handle) ? GetObjectPointer(handle.index) : nullptr;
+  }
+
+  // Check whether the handle refers to an alive object.
+  auto IsAlive(const Handle handle) const -> bool {
+    return handle.index < N && alive_[handle.index] &&
+           generations_[handle.index] == handle.generation;
+  }
+
+  // Get handle of an alive object of this pool.
+  auto GetHandle(const T& object) const -> Handle {
+    const auto* slot = reinterpret_cast<const Slot*>(&object);
+    const auto index = uint32_t(slot - slots_);
+    return {index, generations_[index]};
+  }
+
+  // Destroy all objects of the pool.
+  // Handles to the objects become invalid.
+  void Clear() {
+    for (uint32_t i = 0; i < num_alive_; ++i) {
+      const uint32_t index = dense_[i];
+      GetObjectPointer(index)->~T();
+      alive_[index] = false;
+      ++generations_[index];
+    }
+    num_alive_ = 0;
+
+    InitializeFreeList();
+  }
+
+  // Number of alive objects in the pool.
+  auto Size() const -> std::size_t { return num_alive_; }
+
+  // Maximum number of objects the pool is able to hold.
+  constexpr auto Capacity() const -> std::size_t { return N; }
+
+  auto IsEmpty() const -> bool { return num_alive_ == 0; }
+  auto IsFull() const -> bool { return num_alive_ == N; }
+
+  // Iteration over the alive objects.
+  //
+  // Creating or destroying objects invalidates the iterators.
+  //
+  // NOLINTBEGIN(readability-identifier-naming)
+  auto begin() -> iterator { return {this, 0}; }
+  auto begin() const -> const_iterator { return {this, 0}; }
+  auto end() -> iterator { return {this, num_alive_}; }
+  auto end() const -> const_iterator { return {this, num_alive_}; }
+  // NOLINTEND(readability-identifier-naming)
+
+ private:
+  // Storage of an object, which holds an index of the next free slot when the
+  // slot is not used by an object.
+  union Slot {
+    uint32_t next_free;
+    alignas(T) uint8_t storage[sizeof(T)];  // NOLINT(modernize-avoid-c-arrays)
+  };
+
+  // Iterator over alive objects of the pool.
+  template <bool IsConst>
+  class Iterator {
+    using Pool =
+        std::conditional_t<IsConst, const StaticObjectPool, StaticObjectPool>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const T*, T*>;
+    using reference = std::conditional_t<IsConst, const T&, T&>;
+
+    Iterator() = default;
+    Iterator(Pool* pool, const uint32_t dense_index)
+        : pool_(pool), dense_index_(dense_index) {}
+
+    auto operator*() const -> reference {
+      return *pool_->GetObjectPointer(pool_->dense_[dense_index_]);
+    }
+    auto operator->() const -> pointer {
+      return pool_->GetObjectPointer(pool_->dense_[dense_index_]);
+    }
+
+    auto operator++() -> Iterator& {
+      ++dense_index_;
+      return *this;
+    }
+    auto operator++(int) -> Iterator {
+      Iterator result = *this;
+      ++dense_index_;
+      return result;
+    }
+
+    friend auto operator==(const Iterator& lhs, const Iterator& rhs) -> bool {
+      return lhs.dense_index_ == rhs.dense_index_;
+    }
+
+   private:
+    Pool* pool_{nullptr};
+    uint32_t dense_index_{0};
+  };
+
+  auto GetObjectPointer(const uint32_t index) -> T* {
+    return std::launder(reinterpret_cast<T*>(slots_[index].storage));
+  }
+  auto GetObjectPointer(const uint32_t index) const -> const T* {
+    return std::launder(reinterpret_cast<const T*>(slots_[index].storage));
+  }
+
+  // Link all slots into the free list, in the order of their indices.
+  void InitializeFreeList() {
+    for (uint32_t i = 0; i < N; ++i) {
+      slots_[i].next_free = (i + 1 < N) ? i + 1 : internal::kInvalidIndex;
+    }
+    free_head_ = 0;
+  }
+
+  // NOLINTBEGIN(modernize-avoid-c-arrays)
+  Slot slots_[N];
+
+  // Generation of every slot, which is incremented when the object in the slot
+  // is destroyed.
+  uint32_t generations_[N]{};
+
+  // Per-slot flag denoting the slot has an alive object.
+  bool alive_[N]{};
+
+  // Indices of slots with alive objects, packed into the first num_alive_
+  // elements, and the position of every alive slot in this array.
+  uint32_t dense_[N];
+  uint32_t dense_index_[N];
+  // NOLINTEND(modernize-avoid-c-arrays)
+
+  uint32_t num_alive_{0};
+  uint32_t free_head_{internal::kInvalidIndex};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ConcurrentStaticObjectPool.
+
+// Object pool which allows to create and destroy objects from multiple threads.
+//
+// The indices of the free list are stored separately from the object storage:
+// a thread which attempts to pop a slot from the free list might read its
+// next index while another thread already popped the slot and is constructing
+// an object in it.
+//
+// Access to an object via Get() is not synchronized with its destruction: it is
+// up to the application to ensure an object is not destroyed while it is being
+// accessed.
+template <class T, std::size_t N>
+class ConcurrentStaticObjectPool {
+ public:
+  static_assert(N > 0 && N < internal::kInvalidIndex);
+
+  ConcurrentStaticObjectPool() {
+    for (uint32_t i = 0; i < N; ++i) {
+      next_free_[i].store((i + 1 < N) ? i + 1 : internal::kInvalidIndex,
+                          std::memory_order_relaxed);
+    }
+    free_head_.store(PackHead(0, 0), std::memory_order_relaxed);
+  }
+
+  ConcurrentStaticObjectPool(const ConcurrentStaticObjectPool& other) = delete;
+  ConcurrentStaticObjectPool(ConcurrentStaticObjectPool&& other) noexcept =
+      delete;
+  auto operator=(const ConcurrentStaticObjectPool& other)
+      -> ConcurrentStaticObjectPool& = delete;
+  auto operator=(ConcurrentStaticObjectPool&& other)
+      -> ConcurrentStaticObjectPool& = delete;
+
+  // Destroys the alive objects.
+  // It is up to the caller to ensure no other thread accesses the pool.
+  ~ConcurrentStaticObjectPool() {
+    for (uint32_t i = 0; i < N; ++i) {
+      if (IsGenerationAlive(generations_[i].load(std::memory_order_relaxed))) {
+        GetObjectPointer(i)->~T();
+      }
+    }
+  }
+
+  // Create a new object in a free slot of the pool, passing the given
+  // arguments to its constructor.
+  //
+  // If there are no free slots an exception of type std::length_error is
+  // thrown.
+  template <class... Args>
+  auto Create(Args&&... args) -> Handle {
+    const uint32_t index = PopFreeIndex();
+    TL_STATIC_OBJECT_POOL_THROW_IF(std::length_error,
+                                   index == internal::kInvalidIndex);
+
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+    try {
+      new (storage_[index]) T(std::forward<Args>(args)...);
+    } catch (...) {
+      PushFreeIndex(index);
+      throw;
+    }
+#else
+    new (storage_[index]) T(std::forward<Args>(args)...);
+#endif
+
+    // Mark the slot as alive. The slot is owned by this thread, so there is no
+    // contention on the generation.
+    const uint32_t generation =
+        generations_[index].fetch_add(1, std::memory_order_release) + 1;
+
+    num_alive_.fetch_add(1, std::memory_order_relaxed);
+
+    return {index, generation};
+  }
+
+  // Destroy the object referred by the handle, making its slot available for
+  // new objects.
+  //
+  // If the handle does not refer to an alive object an exception of type
+  // std::invalid_argument is thrown. When multiple threads attempt to destroy
+  // the same object only one of them succeeds.
+  void Destroy(const Handle handle) {
+    TL_STATIC_OBJECT_POOL_THROW_IF(std::invalid_argument, handle.index >= N);
+
+    // Mark the slot as dead, which guarantees only one thread destroys the
+    // object.
+    uint32_t expected = handle.generation;
+    const bool is_destroyed =
+        IsGenerationAlive(expected) &&
+        generations_[handle.index].compare_exchange_strong(
+            expected, expected + 1, std::memory_order_acq_rel);
+    TL_STATIC_OBJECT_POOL_THROW_IF(std::invalid_argument, !is_destroyed);
+
+    GetObjectPointer(handle.index)->~T();
+
+    num_alive_.fetch_sub(1, std::memory_order_relaxed);
+
+    PushFreeIndex(handle.index);
+  }
+
+  // Get the object referred by the handle.
+  // Returns nullptr if the handle does not refer to an alive object.
+  auto Get(const Handle handle) -> T* {
+    return IsAlive(handle) ? GetObjectPointer(handle.index) : nullptr;
+  }
+  auto Get(const Handle handle) const -> const T* {
+    return IsAlive(handle) ? GetObjectPointer(handle.index) : nullptr;
+  }
+
+  // Check whether the handle refers to an alive object.
+  auto IsAlive(const Handle handle) const -> bool {
+    return handle.index < N && IsGenerationAlive(handle.generation) &&
+           generations_[handle.index].load(std::memory_order_acquire) ==
+               handle.generation;
+  }
+
+  // Number of alive objects in the pool.
+  // The value is approximate when objects are created or destroyed
+  // concurrently.
+  auto Size() const -> std::size_t {
+    return num_alive_.load(std::memory_order_relaxed);
+  }
+
+  // Maximum number of objects the pool is able to hold.
+  constexpr auto Capacity() const -> std::size_t { return N; }
+
+ private:
+  // The generation of a slot is incremented both when an object is created and
+  // destroyed in the slot, so that odd generations denote alive objects.
+  static auto IsGenerationAlive(const uint32_t generation) -> bool {
+    return generation & 1;
+  }
+
+  // The head of the free list packs the index of the first free slot in its
+  // lower 32 bits, and a tag which is incremented on every modification in its
+  // upper 32 bits.
+  static auto PackHead(const uint32_t index, const uint32_t tag) -> uint64_t {
+    return (uint64_t(tag) << 32) | index;
+  }
+  static auto HeadIndex(const uint64_t head) -> uint32_t {
+    return uint32_t(head);
+  }
+  static auto HeadTag(const uint64_t head) -> uint32_t {
+    return uint32_t(head >> 32);
+  }
+
+  // Pop index of a free slot from the free list.
+  // Returns kInvalidIndex if there are no free slots.
+  auto PopFreeIndex() -> uint32_t {
+    uint64_t head = free_head_.load(std::memory_order_acquire);
+    while (true) {
+      const uint32_t index = HeadIndex(head);
+      if (index == internal::kInvalidIndex) {
+        return index;
+      }
+
+      const uint32_t next = next_free_[index].load(std::memory_order_relaxed);
+      if (free_head_.compare_exchange_weak(head,
+                                           PackHead(next, HeadTag(head) + 1),
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_acquire)) {
+        return index;
+      }
+    }
+  }
+
+  // Push index of a slot to the free list.
+  void PushFreeIndex(const uint32_t index) {
+    uint64_t head = free_head_.load(std::memory_order_relaxed);
+    while (true) {
+      next_free_[index].store(HeadIndex(head), std::memory_order_relaxed);
+      if (free_head_.compare_exchange_weak(head,
+                                           PackHead(index, HeadTag(head) + 1),
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+        return;
+      }
+    }
+  }
+
+  auto GetObjectPointer(const uint32_t index) -> T* {
+    return std::launder(reinterpret_cast<T*>(storage_[index]));
+  }
+  auto GetObjectPointer(const uint32_t index) const -> const T* {
+    return std::launder(reinterpret_cast<const T*>(storage_[index]));
+  }
+
+  // NOLINTBEGIN(modernize-avoid-c-arrays)
+  alignas(T) uint8_t storage_[N][sizeof(T)];
+  std::atomic<uint32_t> generations_[N]{};
+  std::atomic<uint32_t> next_free_[N];
+  // NOLINTEND(modernize-avoid-c-arrays)
+
+  std::atomic<uint64_t> free_head_;
+  std::atomic<uint32_t> num_alive_{0};
+};
+
+}  // namespace TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE
+}  // namespace TL_STATIC_OBJECT_POOL_NAMESPACE
+
+#undef TL_STATIC_OBJECT_POOL_VERSION_MAJOR
+#undef TL_STATIC_OBJECT_POOL_VERSION_MINOR
+#undef TL_STATIC_OBJECT_POOL_VERSION_REVISION
+
+#undef TL_STATIC_OBJECT_POOL_NAMESPACE
+
+#undef TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_OBJECT_POOL_VERSION_NAMESPACE
+
+#undef TL_STATIC_OBJECT_POOL_THROW_IF
@@ -0,0 +1,331 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A fixed capacity priority queue.
+//
+// StaticPriorityQueue implements C++ std::priority_queue API and uses in-object
+// storage of a static size provided by the StaticVector, so no allocations will
+// be performed by the queue.
+//
+// The queue is organized as an implicit 4-ary heap: children of the element at
+// index i are stored at indices [4 * i + 1, 4 * i + 4]. Compared to a binary
+// heap the tree is half as deep, so push() does half the number of moves, and
+// pop() visits half the number of levels. All children of an element are
+// adjacent in memory and typically share a cache line, so comparing them is
+// cheap.
+//
+// Similar to std::priority_queue, with the default comparator the top() of the
+// queue is its largest element.
+//
+//
+// Exceptions
+// ==========
+//
+// The storage of the queue is a StaticVector, which reports errors using
+// TL_STATIC_VECTOR_THROW_IF. It is possible to customize the error handling of
+// the queue by defining this macro prior to including this header.
+//
+// General notes on exceptions:
+//
+//  - If an operation would result in size() > max_size(), an std::length_error
+//    exception is throw.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "tl_static_vector.h"
+
+// Semantic version of the tl_static_priority_queue library.
+#define TL_STATIC_PRIORITY_QUEUE_VERSION_MAJOR 0
+#define TL_STATIC_PRIORITY_QUEUE_VERSION_MINOR 0
+#define TL_STATIC_PRIORITY_QUEUE_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_PRIORITY_QUEUE_NAMESPACE
+#  define TL_STATIC_PRIORITY_QUEUE_NAMESPACE tiny_lib::static_priority_queue
+#endif
+
+// Namespace in which the StaticVector is defined.
+// Is to be defined when the tl_static_vector library is configured to use a
+// non-default namespace.
+#ifndef TL_STATIC_PRIORITY_QUEUE_STATIC_VECTOR_NAMESPACE
+#  define TL_STATIC_PRIORITY_QUEUE_STATIC_VECTOR_NAMESPACE                     \
+    tiny_lib::static_vector
+#endif
+
+// Helpers for TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE_CONCAT_HELPER(              \
+    id1, id2, id3)                                                             \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE_CONCAT(id1, id2, id3)       \
+  TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE                             \
+  TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE_CONCAT(                           \
+      TL_STATIC_PRIORITY_QUEUE_VERSION_MAJOR,                                  \
+      TL_STATIC_PRIORITY_QUEUE_VERSION_MINOR,                                  \
+      TL_STATIC_PRIORITY_QUEUE_VERSION_REVISION)
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_PRIORITY_QUEUE_NAMESPACE {
+inline namespace TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE {
+
+namespace internal {
+
+// Storage of the heap.
+template <class T, std::size_t N>
+using StaticVector =
+    TL_STATIC_PRIORITY_QUEUE_STATIC_VECTOR_NAMESPACE::StaticVector<T, N>;
+
+// The number of children of every node of the heap.
+inline constexpr std::size_t kArity = 4;
+
+}  // namespace internal
+
+// The code follows the STL naming convention for easier interchangeability with
+// the standard priority queue type.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+template <class T, std::size_t N, class Compare = std::less<T>>
+class StaticPriorityQueue {
+ public:
+  static_assert(N > 0);
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member types.
+
+  using container_type = internal::StaticVector<T, N>;
+  using value_compare = Compare;
+  using value_type = T;
+  using size_type = typename container_type::size_type;
+  using reference = typename container_type::reference;
+  using const_reference = typename container_type::const_reference;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member functions.
+
+  // Default constructor.
+  // Constructs an empty queue.
+  constexpr StaticPriorityQueue() = default;
+
+  // Constructs an empty queue which uses the given comparator.
+  constexpr explicit StaticPriorityQueue(const Compare& compare)
+      : compare_(compare) {}
+
+  // Constructs the queue with the contents of the range [first, last).
+  // The heap is built in linear time.
+  template <class InputIt,
+            class = std::enable_if_t<std::input_iterator<InputIt>>>
+  constexpr StaticPriorityQueue(InputIt first,
+                                InputIt last,
+                                const Compare& compare = Compare())
+      : compare_(compare), c_(first, last) {
+    MakeHeap();
+  }
+
+  // Constructs the queue with the contents of the initializer list init.
+  constexpr StaticPriorityQueue(std::initializer_list<T> init,
+                                const Compare& compare = Compare())
+      : StaticPriorityQueue(init.begin(), init.end(), compare) {}
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Element access.
+
+  // Returns reference to the top element in the priority queue.
+  // Calling top on an empty queue causes undefined behavior.
+  constexpr auto top() const -> const_reference { return c_.front(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Capacity.
+
+  // Checks if the underlying container has no elements.
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return c_.empty();
+  }
+
+  // Returns the number of elements in the underlying container.
+  constexpr auto size() const noexcept -> size_type { return c_.size(); }
+
+  // Returns the maximum number of elements the queue is able to hold.
+  constexpr auto max_size() const noexcept -> size_type { return N; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Modifiers.
+
+  // Pushes the given element value to the priority queue.
+  constexpr void push(const value_type& value) {
+    c_.push_back(value);
+    SiftUp(c_.size() - 1);
+  }
+  constexpr void push(value_type&& value) {
+    c_.push_back(std::move(value));
+    SiftUp(c_.size() - 1);
+  }
+
+  // Pushes a new element to the priority queue. The element is constructed
+  // in-place.
+  template <class... Args>
+  constexpr void emplace(Args&&... args) {
+    c_.emplace_back(std::forward<Args>(args)...);
+    SiftUp(c_.size() - 1);
+  }
+
+  // Removes the top element from the priority queue.
+  // Calling pop on an empty queue causes undefined behavior.
+  constexpr void pop() {
+    if (c_.size() > 1) {
+      c_.front() = std::move(c_.back());
+      c_.pop_back();
+      SiftDown(0);
+    } else {
+      c_.pop_back();
+    }
+  }
+
+  // Erases all elements from the queue.
+  constexpr void clear() noexcept { c_.clear(); }
+
+  // Exchanges the contents of the queue with those of other.
+  constexpr void swap(StaticPriorityQueue& other) {
+    using std::swap;
+    swap(compare_, other.compare_);
+    c_.swap(other.c_);
+  }
+
+ private:
+  // Restore the heap property for all elements of the container.
+  constexpr void MakeHeap() {
+    const size_type size = c_.size();
+    if (size < 2) {
+      return;
+    }
+
+    for (size_type i = (size - 2) / internal::kArity + 1; i-- > 0;) {
+      SiftDown(i);
+    }
+  }
+
+  // Move the element at the given index towards the root until its parent is
+  // not less than the element.
+  //
+  // The element is moved out of the heap, and the parents are moved down into
+  // the hole, so every level costs one move rather than a swap.
+  constexpr void SiftUp(size_type index) {
+    if (index == 0) {
+      return;
+    }
+
+    size_type parent = (index - 1) / internal::kArity;
+    if (!compare_(c_[parent], c_[index])) {
+      return;
+    }
+
+    T value = std::move(c_[index]);
+    do {
+      c_[index] = std::move(c_[parent]);
+      index = parent;
+      if (index == 0) {
+        break;
+      }
+      parent = (index - 1) / internal::kArity;
+    } while (compare_(c_[parent], value));
+
+    c_[index] = std::move(value);
+  }
+
+  // Move the element at the given index towards the leaves until none of its
+  // children are greater than the element.
+  constexpr void SiftDown(size_type index) {
+    const size_type size = c_.size();
+
+    size_type child = GetLargestChild(index, size);
+    if (child == size || !compare_(c_[index], c_[child])) {
+      return;
+    }
+
+    T value = std::move(c_[index]);
+    do {
+      c_[index] = std::move(c_[child]);
+      index = child;
+      child = GetLargestChild(index, size);
+    } while (child != size && compare_(value, c_[child]));
+
+    c_[index] = std::move(value);
+  }
+
+  // Get index of the largest child of the element at the given index.
+  // Returns size if the element has no children.
+  constexpr auto GetLargestChild(const size_type index,
+                                 const size_type size) const -> size_type {
+    const size_type first_child = index * internal::kArity + 1;
+    if (first_child >= size) {
+      return size;
+    }
+
+    const size_type last_child =
+        size - first_child > internal::kArity ? first_child + internal::kArity
+                                              : size;
+
+    size_type largest = first_child;
+    for (size_type i = first_child + 1; i < last_child; ++i) {
+      if (compare_(c_[largest], c_[i])) {
+        largest = i;
+      }
+    }
+    return largest;
+  }
+
+  [[no_unique_address]] Compare compare_{};
+  container_type c_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Non-member functions.
+
+// Specializes the swap() algorithm for StaticPriorityQueue.
+// Swaps the contents of lhs and rhs. Equivalent to `lhs.swap(rhs)`.
+template <class T, std::size_t N, class Compare>
+constexpr void swap(StaticPriorityQueue<T, N, Compare>& lhs,
+                    StaticPriorityQueue<T, N, Compare>& rhs) {
+  lhs.swap(rhs);
+}
+
+// NOLINTEND(readability-identifier-naming)
+
+}  // namespace TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE
+}  // namespace TL_STATIC_PRIORITY_QUEUE_NAMESPACE
+
+#undef TL_STATIC_PRIORITY_QUEUE_VERSION_MAJOR
+#undef TL_STATIC_PRIORITY_QUEUE_VERSION_MINOR
+#undef TL_STATIC_PRIORITY_QUEUE_VERSION_REVISION
+
+#undef TL_STATIC_PRIORITY_QUEUE_NAMESPACE
+#undef TL_STATIC_PRIORITY_QUEUE_STATIC_VECTOR_NAMESPACE
+
+#undef TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_PRIORITY_QUEUE_VERSION_NAMESPACE
@@ -0,0 +1,890 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A fixed capacity first-in-first-out ring buffer.
+//
+// There are two flavors of the ring buffer provided by this library:
+//
+//  - StaticRingBuffer is a single-threaded container which follows the naming
+//    conventions of the STL containers. It is similar to a std::deque which
+//    only supports push to the back and pop from the front, but it uses
+//    in-object storage of a static size.
+//
+//  - StaticSPSCRingBuffer is a lock-free queue which supports one producer
+//    thread and one consumer thread accessing the buffer concurrently.
+//
+// No allocations will be performed by either of the ring buffers, which makes
+// them usable on microcontrollers.
+//
+// The capacity N of the ring buffers is required to be a power of two. This
+// allows to use cheap bit masking for wrapping indices around the storage, and
+// allows to use the entire storage without reserving an extra element to tell
+// full and empty states apart.
+//
+// Bulk transfers
+// ==============
+//
+// The stored elements occupy at most two contiguous regions of the storage.
+// Both ring buffers provide write() and read() functions which transfer a span
+// of elements in and out of the buffer using at most two copies of contiguous
+// memory. For trivially copyable types this boils down to at most two memcpy()
+// per transfer.
+//
+// The StaticRingBuffer additionally provides access to the contiguous regions
+// via array_one() and array_two(), allowing to process stored elements in-place
+// without copying them out of the buffer.
+//
+//
+// Exceptions
+// ==========
+//
+// General notes on exceptions:
+//
+//  - If an exception is thrown for any reason, functions have effect (strong
+//    exception guarantee).
+//
+//  - If an operation would result in size() > max_size(), an std::length_error
+//    exception is throw.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+// The StaticSPSCRingBuffer does not throw exceptions on its own: operations on
+// it report whether they succeeded via the return value.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Semantic version of the tl_static_ring_buffer library.
+#define TL_STATIC_RING_BUFFER_VERSION_MAJOR 0
+#define TL_STATIC_RING_BUFFER_VERSION_MINOR 0
+#define TL_STATIC_RING_BUFFER_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_RING_BUFFER_NAMESPACE
+#  define TL_STATIC_RING_BUFFER_NAMESPACE tiny_lib::static_ring_buffer
+#endif
+
+// Helpers for TL_STATIC_RING_BUFFER_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_RING_BUFFER_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)   \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_RING_BUFFER_VERSION_NAMESPACE_CONCAT(id1, id2, id3)          \
+  TL_STATIC_RING_BUFFER_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_RING_BUFFER_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_RING_BUFFER_VERSION_NAMESPACE                                \
+  TL_STATIC_RING_BUFFER_VERSION_NAMESPACE_CONCAT(                              \
+      TL_STATIC_RING_BUFFER_VERSION_MAJOR,                                     \
+      TL_STATIC_RING_BUFFER_VERSION_MINOR,                                     \
+      TL_STATIC_RING_BUFFER_VERSION_REVISION)
+
+// Throw an exception of the given type ExceptionType if the expression is
+// evaluated to a truthful value.
+// The default implementation throws an ExceptionType(#expression) if the
+// condition is met.
+// If the default behavior is not suitable for the application it should define
+// TL_STATIC_RING_BUFFER_THROW_IF prior to including this header. The provided
+// implementation is not to return, otherwise an undefined behavior of memory
+// corruption will happen.
+#if !defined(TL_STATIC_RING_BUFFER_THROW_IF)
+#  define TL_STATIC_RING_BUFFER_THROW_IF(ExceptionType, expression)            \
+    internal::ThrowIfOrAbort<ExceptionType>(expression, #expression)
+#endif
+
+// The size of the cache line in bytes.
+//
+// Used by the StaticSPSCRingBuffer to keep the indices modified by the producer
+// and the consumer on separate cache lines, avoiding false sharing.
+//
+// The std::hardware_destructive_interference_size is not used as its value is
+// not guaranteed to be stable across compiler flags, which makes it unsuitable
+// for use in headers.
+#if !defined(TL_STATIC_RING_BUFFER_CACHE_LINE_SIZE)
+#  define TL_STATIC_RING_BUFFER_CACHE_LINE_SIZE 64
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_RING_BUFFER_NAMESPACE {
+inline namespace TL_STATIC_RING_BUFFER_VERSION_NAMESPACE {
+
+namespace internal {
+
+// If the exceptions are enabled throws a new exception of the given type
+// passing the given expression_str to its constructor as a reason. If the
+// exceptions are disabled aborts the program execution.
+template <class Exception>
+[[noreturn]] inline constexpr void ThrowOrAbort(const char* expression_str) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  throw Exception(expression_str);
+#else
+  (void)expression_str;
+  __builtin_abort();
+#endif
+}
+
+// A default implementation of the TL_STATIC_RING_BUFFER_THROW_IF().
+template <class Exception>
+inline constexpr void ThrowIfOrAbort(const bool expression_eval,
+                                     const char* expression_str) {
+  if (expression_eval) {
+    ThrowOrAbort<Exception>(expression_str);
+  }
+}
+
+// Check whether the value is a power of two.
+inline constexpr auto IsPowerOfTwo(const std::size_t value) -> bool {
+  return value != 0 && (value & (value - 1)) == 0;
+}
+
+// Copy count elements from the source to the destination memory which holds no
+// alive objects. The first count_one elements are copied to dst_one, and the
+// rest of them are copied to dst_two.
+//
+// Trivially copyable types are copied as a plain memory, other types are copy
+// constructed in the destination. If the copy constructor throws, the elements
+// which were already constructed are destroyed before the exception is
+// propagated.
+template <class T>
+inline void CopyToUninitialized(const T* src,
+                                const std::size_t count,
+                                const std::size_t count_one,
+                                T* dst_one,
+                                T* dst_two) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::copy_n(src, count_one, dst_one);
+    std::copy_n(src + count_one, count - count_one, dst_two);
+  } else {
+    // The std::uninitialized_copy_n() destroys its own partially constructed
+    // range.
+    std::uninitialized_copy_n(src, count_one, dst_one);
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+    try {
+      std::uninitialized_copy_n(src + count_one, count - count_one, dst_two);
+    } catch (...) {
+      std::destroy_n(dst_one, count_one);
+      throw;
+    }
+#else
+    std::uninitialized_copy_n(src + count_one, count - count_one, dst_two);
+#endif
+  }
+}
+
+// Move count elements from the source to the destination which holds alive
+// objects, and destroy the source elements. The first count_one elements are
+// moved from src_one, and the rest of them are moved from src_two.
+//
+// Trivially copyable types are copied as a plain memory, other types are move
+// assigned. The source elements are only destroyed after all of them have been
+// moved, so if the move assignment throws all source elements are still alive.
+template <class T>
+inline void MoveAndDestroy(T* src_one,
+                           T* src_two,
+                           const std::size_t count,
+                           const std::size_t count_one,
+                           T* dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::copy_n(src_one, count_one, dst);
+    std::copy_n(src_two, count - count_one, dst + count_one);
+  } else {
+    std::move(src_one, src_one + count_one, dst);
+    std::move(src_two, src_two + (count - count_one), dst + count_one);
+    std::destroy_n(src_one, count_one);
+    std::destroy_n(src_two, count - count_one);
+  }
+}
+
+}  // namespace internal
+
+// The code follows the STL naming convention for easier interchangeability with
+// the standard containers.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticRingBuffer.
+
+template <class T, std::size_t N>
+class StaticRingBuffer {
+  template <bool IsConst>
+  class Iterator;
+
+ public:
+  static_assert(internal::IsPowerOfTwo(N),
+                "Capacity of the ring buffer must be a power of two");
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member types.
+
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Constants.
+
+  // In-class alias for the maximum capacity.
+  static constexpr size_type static_capacity = N;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member functions.
+
+  // Default constructor.
+  // Constructs an empty container.
+  constexpr StaticRingBuffer() noexcept = default;
+
+  // Copy constructor.
+  // Constructs the container with the copy of the contents of other.
+  constexpr StaticRingBuffer(const StaticRingBuffer& other) {
+    for (const T& value : other) {
+      emplace_back(value);
+    }
+  }
+
+  // Move constructor.
+  // Constructs the container with the contents of other using move semantics.
+  // After the move, other is guaranteed to be empty().
+  constexpr StaticRingBuffer(StaticRingBuffer&& other) noexcept {
+    for (T& value : other) {
+      emplace_back(std::move(value));
+    }
+    other.clear();
+  }
+
+  ~StaticRingBuffer() { clear(); }
+
+  // Copy assignment operator.
+  // Replaces the contents with a copy of the contents of other.
+  constexpr auto operator=(const StaticRingBuffer& other) -> StaticRingBuffer& {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+    for (const T& value : other) {
+      emplace_back(value);
+    }
+
+    return *this;
+  }
+
+  // Move assignment operator.
+  // Replaces the contents with those of other using move semantics. After the
+  // move, other is guaranteed to be empty().
+  constexpr auto operator=(StaticRingBuffer&& other) noexcept
+      -> StaticRingBuffer& {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+    for (T& value : other) {
+      emplace_back(std::move(value));
+    }
+    other.clear();
+
+    return *this;
+  }
+
+  // Element access
+  // ==============
+
+  // Returns a reference to the element at specified location pos, counting from
+  // the front of the buffer, with bounds checking.
+  // If pos is not within the range of the container, an exception of type
+  // std::out_of_range is thrown.
+  constexpr auto at(const size_type pos) -> reference {
+    TL_STATIC_RING_BUFFER_THROW_IF(std::out_of_range, pos >= size());
+    return operator[](pos);
+  }
+  constexpr auto at(const size_type pos) const -> const_reference {
+    TL_STATIC_RING_BUFFER_THROW_IF(std::out_of_range, pos >= size());
+    return operator[](pos);
+  }
+
+  // Returns a reference to the element at specified location pos, counting from
+  // the front of the buffer.
+  // No bounds checking is performed.
+  constexpr auto operator[](const size_type pos) -> reference {
+    return *GetElementPointer(head_ + pos);
+  }
+  constexpr auto operator[](const size_type pos) const -> const_reference {
+    return *GetElementPointer(head_ + pos);
+  }
+
+  // Returns a reference to the first element in the container: the element
+  // which will be removed by the next pop_front().
+  // Calling front on an empty container is undefined.
+  constexpr auto front() -> reference { return operator[](0); }
+  constexpr auto front() const -> const_reference { return operator[](0); }
+
+  // Returns a reference to the last element in the container: the element
+  // which was most recently pushed.
+  // Calling back on an empty container is undefined.
+  constexpr auto back() -> reference { return operator[](size() - 1); }
+  constexpr auto back() const -> const_reference {
+    return operator[](size() - 1);
+  }
+
+  // Returns the first contiguous region of the stored elements.
+  // It starts with the front() element.
+  //
+  // When the buffer is empty an empty span is returned.
+  constexpr auto array_one() noexcept -> std::span<T> {
+    return {GetElementPointer(head_), FirstRegionSize()};
+  }
+  constexpr auto array_one() const noexcept -> std::span<const T> {
+    return {GetElementPointer(head_), FirstRegionSize()};
+  }
+
+  // Returns the second contiguous region of the stored elements.
+  // It is only non-empty when the stored elements wrap around the end of the
+  // storage, and in this case it ends with the back() element.
+  constexpr auto array_two() noexcept -> std::span<T> {
+    return {data(), size() - FirstRegionSize()};
+  }
+  constexpr auto array_two() const noexcept -> std::span<const T> {
+    return {data(), size() - FirstRegionSize()};
+  }
+
+  // Iterators
+  // =========
+
+  // Returns an iterator to the first element of the buffer.
+  constexpr auto begin() noexcept -> iterator { return {this, 0}; }
+  constexpr auto begin() const noexcept -> const_iterator { return {this, 0}; }
+  constexpr auto cbegin() const noexcept -> const_iterator {
+    return {this, 0};
+  }
+
+  // Returns an iterator to the element following the last element of the
+  // buffer.
+  constexpr auto end() noexcept -> iterator { return {this, size()}; }
+  constexpr auto end() const noexcept -> const_iterator {
+    return {this, size()};
+  }
+  constexpr auto cend() const noexcept -> const_iterator {
+    return {this, size()};
+  }
+
+  // Capacity
+  // ========
+
+  // Checks if the buffer has no elements, i.e. whether size() == 0.
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return size() == 0;
+  }
+
+  // Checks if the buffer has no space for new elements, i.e. whether
+  // size() == max_size().
+  constexpr auto full() const noexcept -> bool { return size() == max_size(); }
+
+  // Returns the number of elements in the container.
+  constexpr auto size() const noexcept -> size_type { return tail_ - head_; }
+
+  // Returns the maximum number of elements the container is able to hold.
+  constexpr auto max_size() const noexcept -> size_type { return N; }
+
+  // Returns the number of elements that the container has currently allocated
+  // space for.
+  constexpr auto capacity() const noexcept -> size_type { return max_size(); }
+
+  // Modifiers
+  // =========
+
+  // Erases all elements from the container. After this call, size() returns
+  // zero.
+  constexpr void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_type i = head_; i != tail_; ++i) {
+        GetElementPointer(i)->~T();
+      }
+    }
+
+    head_ = 0;
+    tail_ = 0;
+  }
+
+  // Appends the given element value to the end of the container.
+  // If the buffer is full an exception of type std::length_error is thrown.
+  constexpr void push_back(const T& value) { emplace_back(value); }
+  constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  // Appends a new element to the end of the container.
+  // If the buffer is full an exception of type std::length_error is thrown.
+  template <class... Args>
+  constexpr auto emplace_back(Args&&... args) -> reference {
+    TL_STATIC_RING_BUFFER_THROW_IF(std::length_error, full());
+
+    T* ptr = GetElementPointer(tail_);
+    new (ptr) T(std::forward<Args>(args)...);
+    ++tail_;
+
+    return *ptr;
+  }
+
+  // Removes the first element of the container.
+  // Calling pop_front on an empty container results in undefined behavior.
+  constexpr void pop_front() {
+    GetElementPointer(head_)->~T();
+    ++head_;
+  }
+
+  // Copies as many elements from the given span as there is space available in
+  // the buffer, appending them to the end of the buffer.
+  //
+  // Returns the number of elements which were actually copied.
+  auto write(const std::span<const T> values) -> size_type {
+    const size_type count = std::min(values.size(), max_size() - size());
+
+    const size_type tail_index = tail_ & kIndexMask;
+    const size_type count_one = std::min(count, N - tail_index);
+
+    internal::CopyToUninitialized(
+        values.data(), count, count_one, data() + tail_index, data());
+
+    tail_ += count;
+
+    return count;
+  }
+
+  // Moves as many elements from the front of the buffer into the given span as
+  // fits into it, removing them from the buffer.
+  //
+  // Returns the number of elements which were actually read.
+  auto read(const std::span<T> values) -> size_type {
+    const size_type count = std::min(values.size(), size());
+
+    const std::span<T> one = array_one();
+    const size_type count_one = std::min(count, one.size());
+
+    internal::MoveAndDestroy(
+        one.data(), data(), count, count_one, values.data());
+
+    head_ += count;
+
+    return count;
+  }
+
+  // Exchanges the contents of the container with those of other.
+  constexpr void swap(StaticRingBuffer& other) {
+    StaticRingBuffer tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  // Mask which converts free-running position to an index in the storage.
+  static constexpr size_type kIndexMask = N - 1;
+
+  // Iterator over elements of the ring buffer.
+  //
+  // Stores the logical position within the buffer, counting from the front.
+  template <bool IsConst>
+  class Iterator {
+    using Container = std::conditional_t<IsConst,
+                                         const StaticRingBuffer,
+                                         StaticRingBuffer>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const T*, T*>;
+    using reference = std::conditional_t<IsConst, const T&, T&>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(Container* container, const size_type pos)
+        : container_(container), pos_(pos) {}
+
+    // Allow conversion from mutable to constant iterator.
+    template <bool OtherIsConst,
+              class = std::enable_if_t<IsConst && !OtherIsConst>>
+    constexpr Iterator(const Iterator<OtherIsConst>& other)
+        : container_(other.container_), pos_(other.pos_) {}
+
+    constexpr auto operator*() const -> reference {
+      return (*container_)[pos_];
+    }
+    constexpr auto operator->() const -> pointer {
+      return &(*container_)[pos_];
+    }
+    constexpr auto operator[](const difference_type n) const -> reference {
+      return (*container_)[pos_ + n];
+    }
+
+    constexpr auto operator++() -> Iterator& {
+      ++pos_;
+      return *this;
+    }
+    constexpr auto operator++(int) -> Iterator {
+      Iterator result = *this;
+      ++pos_;
+      return result;
+    }
+    constexpr auto operator--() -> Iterator& {
+      --pos_;
+      return *this;
+    }
+    constexpr auto operator--(int) -> Iterator {
+      Iterator result = *this;
+      --pos_;
+      return result;
+    }
+
+    constexpr auto operator+=(const difference_type n) -> Iterator& {
+      pos_ += n;
+      return *this;
+    }
+    constexpr auto operator-=(const difference_type n) -> Iterator& {
+      pos_ -= n;
+      return *this;
+    }
+
+    friend constexpr auto operator+(Iterator it, const difference_type n)
+        -> Iterator {
+      return it += n;
+    }
+    friend constexpr auto operator+(const difference_type n, Iterator it)
+        -> Iterator {
+      return it += n;
+    }
+    friend constexpr auto operator-(Iterator it, const difference_type n)
+        -> Iterator {
+      return it -= n;
+    }
+    friend constexpr auto operator-(const Iterator& lhs, const Iterator& rhs)
+        -> difference_type {
+      return difference_type(lhs.pos_) - difference_type(rhs.pos_);
+    }
+
+    friend constexpr auto operator==(const Iterator& lhs, const Iterator& rhs)
+        -> bool {
+      return lhs.pos_ == rhs.pos_;
+    }
+    friend constexpr auto operator<=>(const Iterator& lhs,
+                                      const Iterator& rhs) {
+      return lhs.pos_ <=> rhs.pos_;
+    }
+
+   private:
+    friend class Iterator<!IsConst>;
+
+    Container* container_{nullptr};
+    size_type pos_{0};
+  };
+
+  constexpr auto data() noexcept -> T* { return reinterpret_cast<T*>(data_); }
+  constexpr auto data() const noexcept -> const T* {
+    return reinterpret_cast<const T*>(data_);
+  }
+
+  // Get pointer to an element memory at the given free-running position.
+  constexpr auto GetElementPointer(const size_type position) noexcept -> T* {
+    return &data()[position & kIndexMask];
+  }
+  constexpr auto GetElementPointer(const size_type position) const noexcept
+      -> const T* {
+    return &data()[position & kIndexMask];
+  }
+
+  // Number of elements in the first contiguous region of the stored elements.
+  constexpr auto FirstRegionSize() const noexcept -> size_type {
+    return std::min(size(), N - (head_ & kIndexMask));
+  }
+
+  alignas(T) uint8_t data_[sizeof(T) * N];  // NOLINT(modernize-avoid-c-arrays)
+
+  // Free-running positions of the front and past-the-back elements.
+  // The unsigned overflow is well-defined, and since N is a power of two the
+  // distance between the positions stays correct after an overflow.
+  size_type head_{0};
+  size_type tail_{0};
+};
+
+// Specializes the swap() algorithm for StaticRingBuffer.
+// Swaps the contents of lhs and rhs. Equivalent to `lhs.swap(rhs)`.
+template <class T, std::size_t N>
+constexpr void swap(StaticRingBuffer<T, N>& lhs,
+                    StaticRingBuffer<T, N>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticSPSCRingBuffer.
+
+// Lock-free ring buffer for a single producer and a single consumer.
+//
+// The producer thread is allowed to call try_push(), try_emplace(), and
+// write().
+// The consumer thread is allowed to call try_pop(), and read().
+// The size(), empty(), and capacity() could be called from any thread, but the
+// returned value is only an approximation when the buffer is accessed
+// concurrently.
+//
+// The positions written by the producer and the consumer are stored in separate
+// cache lines. Each side additionally keeps a cached copy of the position of
+// the other side, so that the shared cache line is only accessed when the
+// buffer seems to be full (for the producer) or empty (for the consumer).
+template <class T, std::size_t N>
+class StaticSPSCRingBuffer {
+ public:
+  static_assert(internal::IsPowerOfTwo(N),
+                "Capacity of the ring buffer must be a power of two");
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member types.
+
+  using value_type = T;
+  using size_type = std::size_t;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Constants.
+
+  // In-class alias for the maximum capacity.
+  static constexpr size_type static_capacity = N;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member functions.
+
+  StaticSPSCRingBuffer() = default;
+
+  // Copying and moving is not possible as the buffer might be accessed from
+  // multiple threads.
+  StaticSPSCRingBuffer(const StaticSPSCRingBuffer& other) = delete;
+  StaticSPSCRingBuffer(StaticSPSCRingBuffer&& other) noexcept = delete;
+  auto operator=(const StaticSPSCRingBuffer& other)
+      -> StaticSPSCRingBuffer& = delete;
+  auto operator=(StaticSPSCRingBuffer&& other)
+      -> StaticSPSCRingBuffer& = delete;
+
+  // Destroys the elements which are still in the buffer.
+  // It is up to the caller to ensure that neither of the producer and consumer
+  // accesses the buffer at this point.
+  ~StaticSPSCRingBuffer() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      const size_type tail = tail_.load(std::memory_order_relaxed);
+      for (size_type i = head_.load(std::memory_order_relaxed); i != tail;
+           ++i) {
+        GetElementPointer(i)->~T();
+      }
+    }
+  }
+
+  // Producer
+  // ========
+
+  // Appends the given element value to the end of the buffer.
+  // Returns false if the buffer is full.
+  auto try_push(const T& value) -> bool { return try_emplace(value); }
+  auto try_push(T&& value) -> bool { return try_emplace(std::move(value)); }
+
+  // Appends a new element to the end of the buffer, constructing it in-place.
+  // Returns false if the buffer is full, in which case the arguments are not
+  // used.
+  template <class... Args>
+  auto try_emplace(Args&&... args) -> bool {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+
+    if (tail - producer_.cached_head == N) {
+      producer_.cached_head = head_.load(std::memory_order_acquire);
+      if (tail - producer_.cached_head == N) {
+        return false;
+      }
+    }
+
+    new (GetElementPointer(tail)) T(std::forward<Args>(args)...);
+
+    tail_.store(tail + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  // Copies as many elements from the given span as there is space available in
+  // the buffer, appending them to the end of the buffer.
+  //
+  // Returns the number of elements which were actually copied.
+  auto write(const std::span<const T> values) -> size_type {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+
+    if (N - (tail - producer_.cached_head) < values.size()) {
+      producer_.cached_head = head_.load(std::memory_order_acquire);
+    }
+
+    const size_type count =
+        std::min(values.size(), N - (tail - producer_.cached_head));
+    if (count == 0) {
+      return 0;
+    }
+
+    const size_type tail_index = tail & kIndexMask;
+    const size_type count_one = std::min(count, N - tail_index);
+
+    internal::CopyToUninitialized(
+        values.data(), count, count_one, data() + tail_index, data());
+
+    tail_.store(tail + count, std::memory_order_release);
+
+    return count;
+  }
+
+  // Consumer
+  // ========
+
+  // Moves the first element of the buffer into the value and removes it from
+  // the buffer.
+  // Returns false if the buffer is empty, in which case the value is not
+  // modified.
+  auto try_pop(T& value) -> bool {
+    const size_type head = head_.load(std::memory_order_relaxed);
+
+    if (head == consumer_.cached_tail) {
+      consumer_.cached_tail = tail_.load(std::memory_order_acquire);
+      if (head == consumer_.cached_tail) {
+        return false;
+      }
+    }
+
+    T* element = GetElementPointer(head);
+    value = std::move(*element);
+    element->~T();
+
+    head_.store(head + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  // Moves as many elements from the front of the buffer into the given span as
+  // fits into it, removing them from the buffer.
+  //
+  // Returns the number of elements which were actually read.
+  auto read(const std::span<T> values) -> size_type {
+    const size_type head = head_.load(std::memory_order_relaxed);
+
+    if (consumer_.cached_tail - head < values.size()) {
+      consumer_.cached_tail = tail_.load(std::memory_order_acquire);
+    }
+
+    const size_type count =
+        std::min(values.size(), consumer_.cached_tail - head);
+    if (count == 0) {
+      return 0;
+    }
+
+    const size_type head_index = head & kIndexMask;
+    const size_type count_one = std::min(count, N - head_index);
+
+    internal::MoveAndDestroy(
+        data() + head_index, data(), count, count_one, values.data());
+
+    head_.store(head + count, std::memory_order_release);
+
+    return count;
+  }
+
+  // Capacity
+  // ========
+
+  // Checks if the buffer has no elements.
+  [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+  // Returns the number of elements in the buffer.
+  auto size() const noexcept -> size_type {
+    // Load the head first so that the tail is never behind it.
+    const size_type head = head_.load(std::memory_order_acquire);
+    const size_type tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  // Returns the maximum number of elements the buffer is able to hold.
+  constexpr auto capacity() const noexcept -> size_type { return N; }
+
+ private:
+  // Mask which converts free-running position to an index in the storage.
+  static constexpr size_type kIndexMask = N - 1;
+
+  static constexpr size_type kCacheLineSize =
+      TL_STATIC_RING_BUFFER_CACHE_LINE_SIZE;
+
+  auto data() noexcept -> T* { return reinterpret_cast<T*>(data_); }
+
+  // Get pointer to an element memory at the given free-running position.
+  auto GetElementPointer(const size_type position) noexcept -> T* {
+    return &data()[position & kIndexMask];
+  }
+
+  // Position of the next element to be read.
+  // Written by the consumer, read by the producer.
+  alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+
+  // State which is only accessed by the consumer.
+  // Lives in the same cache line as the head_.
+  struct {
+    // The most recently observed tail_.
+    size_type cached_tail{0};
+  } consumer_;
+
+  // Position past the last written element.
+  // Written by the producer, read by the consumer.
+  alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+
+  // State which is only accessed by the producer.
+  // Lives in the same cache line as the tail_.
+  struct {
+    // The most recently observed head_.
+    size_type cached_head{0};
+  } producer_;
+
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  alignas(kCacheLineSize) alignas(T) uint8_t data_[sizeof(T) * N];
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+}  // namespace TL_STATIC_RING_BUFFER_VERSION_NAMESPACE
+}  // namespace TL_STATIC_RING_BUFFER_NAMESPACE
+
+#undef TL_STATIC_RING_BUFFER_VERSION_MAJOR
+#undef TL_STATIC_RING_BUFFER_VERSION_MINOR
+#undef TL_STATIC_RING_BUFFER_VERSION_REVISION
+
+#undef TL_STATIC_RING_BUFFER_NAMESPACE
+
+#undef TL_STATIC_RING_BUFFER_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_RING_BUFFER_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_RING_BUFFER_VERSION_NAMESPACE
+
+#undef TL_STATIC_RING_BUFFER_THROW_IF
+
+#undef TL_STATIC_RING_BUFFER_CACHE_LINE_SIZE
@@ -0,0 +1,739 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A fixed capacity dynamically sized vector with structure-of-arrays layout.
+//
+// StaticSoAVector<N, Fields...> stores up to N elements, each of which consists
+// of the given fields. Unlike StaticVector<std::tuple<Fields...>, N>, every
+// field is stored in its own contiguous column:
+//
+//   StaticVector<Particle, N>:             x y z m | x y z m | x y z m | ...
+//   StaticSoAVector<N, float, float, ...>: x x x ... | y y y ... | z z z ...
+//
+// This allows loops which only access some of the fields to load densely
+// packed values, without wasting memory bandwidth and cache lines on the fields
+// which are not used, and makes such loops friendly to vectorization:
+//
+//   StaticSoAVector<1024, float, float> particles;  // Position, velocity.
+//   particles.push_back({0.0f, 1.0f});
+//
+//   const std::span<float> position = particles.column<0>();
+//   const std::span<const float> velocity = particles.column<1>();
+//   for (size_t i = 0; i < position.size(); ++i) {
+//     position[i] += velocity[i] * dt;
+//   }
+//
+// Every column starts at an address aligned to at least
+// TL_STATIC_SOA_VECTOR_COLUMN_ALIGNMENT bytes (64 by default, which matches the
+// cache line size and the widest vector registers of the common platforms).
+//
+// The element-wise access (operator[], iterators) returns a tuple of references
+// to the fields of an element, which allows to use structured bindings:
+//
+//   for (auto [position, velocity] : particles) {
+//     position += velocity * dt;
+//   }
+//
+// The erase() uses swap-and-pop: the erased element is replaced with the last
+// element of the container. This makes erase a constant time operation, but it
+// does not preserve the order of elements.
+//
+//
+// Exceptions
+// ==========
+//
+// General notes on exceptions:
+//
+//  - If an exception is thrown for any reason, functions have effect (strong
+//    exception guarantee).
+//
+//  - If an operation would result in size() > max_size(), an std::length_error
+//    exception is throw.
+//
+//  - If at() is called with an out of bounds index, an std::out_of_range
+//    exception is throw.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Semantic version of the tl_static_soa_vector library.
+#define TL_STATIC_SOA_VECTOR_VERSION_MAJOR 0
+#define TL_STATIC_SOA_VECTOR_VERSION_MINOR 0
+#define TL_STATIC_SOA_VECTOR_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_SOA_VECTOR_NAMESPACE
+#  define TL_STATIC_SOA_VECTOR_NAMESPACE tiny_lib::static_soa_vector
+#endif
+
+// Helpers for TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)    \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE_CONCAT(id1, id2, id3)           \
+  TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE                                 \
+  TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE_CONCAT(                               \
+      TL_STATIC_SOA_VECTOR_VERSION_MAJOR,                                      \
+      TL_STATIC_SOA_VECTOR_VERSION_MINOR,                                      \
+      TL_STATIC_SOA_VECTOR_VERSION_REVISION)
+
+// Throw an exception of the given type ExceptionType if the expression is
+// evaluated to a truthful value.
+// The default implementation throws an ExceptionType(#expression) if the
+// condition is met.
+// If the default behavior is not suitable for the application it should define
+// TL_STATIC_SOA_VECTOR_THROW_IF prior to including this header. The provided
+// implementation is not to return, otherwise an undefined behavior of memory
+// corruption will happen.
+#if !defined(TL_STATIC_SOA_VECTOR_THROW_IF)
+#  define TL_STATIC_SOA_VECTOR_THROW_IF(ExceptionType, expression)             \
+    internal::ThrowIfOrAbort<ExceptionType>(expression, #expression)
+#endif
+
+// The minimum alignment of the columns, in bytes.
+#if !defined(TL_STATIC_SOA_VECTOR_COLUMN_ALIGNMENT)
+#  define TL_STATIC_SOA_VECTOR_COLUMN_ALIGNMENT 64
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_SOA_VECTOR_NAMESPACE {
+inline namespace TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE {
+
+namespace internal {
+
+// If the exceptions are enabled throws a new exception of the given type
+// passing the given expression_str to its constructor as a reason. If the
+// exceptions are disabled aborts the program execution.
+template <class Exception>
+[[noreturn]] inline constexpr void ThrowOrAbort(const char* expression_str) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  throw Exception(expression_str);
+#else
+  (void)expression_str;
+  __builtin_abort();
+#endif
+}
+
+// A default implementation of the TL_STATIC_SOA_VECTOR_THROW_IF().
+template <class Exception>
+inline constexpr void ThrowIfOrAbort(const bool expression_eval,
+                                     const char* expression_str) {
+  if (expression_eval) {
+    ThrowOrAbort<Exception>(expression_str);
+  }
+}
+
+// Uninitialized storage of a column of N values of type T.
+template <class T, std::size_t N>
+struct alignas(std::max(alignof(T),
+                        std::size_t(TL_STATIC_SOA_VECTOR_COLUMN_ALIGNMENT)))
+    ColumnStorage {
+  uint8_t data[sizeof(T) * N];  // NOLINT(modernize-avoid-c-arrays)
+};
+
+}  // namespace internal
+
+// The code follows the STL naming convention for easier interchangeability with
+// the standard vector type.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+template <std::size_t N, class... Fields>
+class StaticSoAVector {
+  template <bool IsConst>
+  class Iterator;
+
+ public:
+  static_assert(N > 0);
+  static_assert(sizeof...(Fields) > 0);
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member types.
+
+  using value_type = std::tuple<Fields...>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::tuple<Fields&...>;
+  using const_reference = std::tuple<const Fields&...>;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  // Type of the field with the given index.
+  template <std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Constants.
+
+  // In-class alias for the maximum capacity.
+  static constexpr size_type static_capacity = N;
+
+  // The number of fields of an element.
+  static constexpr size_type num_fields = sizeof...(Fields);
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Member functions.
+
+  // Default constructor.
+  // Constructs an empty container.
+  constexpr StaticSoAVector() noexcept = default;
+
+  // Copy constructor.
+  // Constructs the container with the copy of the contents of other.
+  constexpr StaticSoAVector(const StaticSoAVector& other) {
+    for (const const_reference element : other) {
+      EmplaceBackFromTuple(element, kFieldIndices);
+    }
+  }
+
+  // Move constructor.
+  // Constructs the container with the contents of other using move semantics.
+  // After the move, other is guaranteed to be empty().
+  constexpr StaticSoAVector(StaticSoAVector&& other) noexcept {
+    for (size_type i = 0; i < other.size_; ++i) {
+      ConstructElementFrom(i, std::move(other), i, kFieldIndices);
+    }
+    size_ = other.size_;
+
+    other.clear();
+  }
+
+  // Constructs the container with the contents of the initializer list init.
+  constexpr StaticSoAVector(std::initializer_list<value_type> init) {
+    TL_STATIC_SOA_VECTOR_THROW_IF(std::length_error, init.size() > max_size());
+
+    for (const value_type& value : init) {
+      push_back(value);
+    }
+  }
+
+  ~StaticSoAVector() { clear(); }
+
+  // Copy assignment operator.
+  // Replaces the contents with a copy of the contents of other.
+  constexpr auto operator=(const StaticSoAVector& other) -> StaticSoAVector& {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+    for (const const_reference element : other) {
+      EmplaceBackFromTuple(element, kFieldIndices);
+    }
+
+    return *this;
+  }
+
+  // Move assignment operator.
+  // Replaces the contents with those of other using move semantics. After the
+  // move, other is guaranteed to be empty().
+  constexpr auto operator=(StaticSoAVector&& other) noexcept
+      -> StaticSoAVector& {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+
+    for (size_type i = 0; i < other.size_; ++i) {
+      ConstructElementFrom(i, std::move(other), i, kFieldIndices);
+    }
+    size_ = other.size_;
+
+    other.clear();
+
+    return *this;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Element access.
+
+  // Returns references to the fields of the element at specified location pos,
+  // with bounds checking.
+  constexpr auto at(const size_type pos) -> reference {
+    TL_STATIC_SOA_VECTOR_THROW_IF(std::out_of_range, pos >= size());
+    return operator[](pos);
+  }
+  constexpr auto at(const size_type pos) const -> const_reference {
+    TL_STATIC_SOA_VECTOR_THROW_IF(std::out_of_range, pos >= size());
+    return operator[](pos);
+  }
+
+  // Returns references to the fields of the element at specified location pos.
+  // No bounds checking is performed.
+  constexpr auto operator[](const size_type pos) -> reference {
+    return GetElement(pos, kFieldIndices);
+  }
+  constexpr auto operator[](const size_type pos) const -> const_reference {
+    return GetElement(pos, kFieldIndices);
+  }
+
+  // Returns references to the fields of the first element in the container.
+  // Calling front on an empty container causes undefined behavior.
+  constexpr auto front() -> reference { return operator[](0); }
+  constexpr auto front() const -> const_reference { return operator[](0); }
+
+  // Returns references to the fields of the last element in the container.
+  // Calling back on an empty container causes undefined behavior.
+  constexpr auto back() -> reference { return operator[](size() - 1); }
+  constexpr auto back() const -> const_reference {
+    return operator[](size() - 1);
+  }
+
+  // Returns a span over the values of the field I of all elements.
+  //
+  // The span starts at an address aligned to at least the column alignment and
+  // is invalidated by any operation which changes the size of the container.
+  template <std::size_t I>
+  constexpr auto column() noexcept -> std::span<field_type<I>> {
+    return {GetColumnData<I>(), size_};
+  }
+  template <std::size_t I>
+  constexpr auto column() const noexcept -> std::span<const field_type<I>> {
+    return {GetColumnData<I>(), size_};
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Iterators.
+
+  constexpr auto begin() noexcept -> iterator { return {this, 0}; }
+  constexpr auto begin() const noexcept -> const_iterator { return {this, 0}; }
+  constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+
+  constexpr auto end() noexcept -> iterator { return {this, size_}; }
+  constexpr auto end() const noexcept -> const_iterator {
+    return {this, size_};
+  }
+  constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Capacity.
+
+  // Checks if the container has no elements.
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+    return size_ == 0;
+  }
+
+  // Returns the number of elements in the container.
+  constexpr auto size() const noexcept -> size_type { return size_; }
+
+  // Returns the maximum number of elements the container is able to hold.
+  constexpr auto max_size() const noexcept -> size_type { return N; }
+
+  // Returns the number of elements that the container has currently allocated
+  // space for.
+  constexpr auto capacity() const noexcept -> size_type { return max_size(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Modifiers.
+
+  // Erases all elements from the container.
+  constexpr void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i) {
+      DestroyFields(i, num_fields);
+    }
+    size_ = 0;
+  }
+
+  // Appends the given element value to the end of the container.
+  constexpr void push_back(const value_type& value) {
+    EmplaceBackFromTuple(value, kFieldIndices);
+  }
+  constexpr void push_back(value_type&& value) {
+    EmplaceBackFromTuple(std::move(value), kFieldIndices);
+  }
+
+  // Appends a new element to the end of the container.
+  // Every field is constructed from the corresponding argument.
+  template <class... Args>
+  constexpr auto emplace_back(Args&&... args) -> reference {
+    static_assert(sizeof...(Args) == num_fields,
+                  "Expected one constructor argument per field");
+
+    TL_STATIC_SOA_VECTOR_THROW_IF(std::length_error, size() + 1 > max_size());
+
+    ConstructElement(size_, kFieldIndices, std::forward<Args>(args)...);
+    ++size_;
+
+    return back();
+  }
+
+  // Removes the last element of the container.
+  // Calling pop_back on an empty container results in undefined behavior.
+  constexpr void pop_back() {
+    DestroyFields(size_ - 1, num_fields);
+    --size_;
+  }
+
+  // Removes the element at pos by replacing it with the last element of the
+  // container (swap-and-pop). The order of elements is not preserved.
+  //
+  // Returns iterator to the element which took place of the erased element, or
+  // end() if the erased element was the last one.
+  constexpr auto erase(const const_iterator pos) -> iterator {
+    const size_type index = pos.index_;
+    const size_type last_index = size_ - 1;
+
+    if (index != last_index) {
+      MoveAssignElement(index, last_index, kFieldIndices);
+    }
+    pop_back();
+
+    return {this, index};
+  }
+
+  // Resizes the container to contain count elements.
+  // If the current size is greater than count, the container is reduced to its
+  // first count elements.
+  // If the current size is less than count, value-initialized elements are
+  // appended.
+  constexpr void resize(const size_type count) {
+    TL_STATIC_SOA_VECTOR_THROW_IF(std::length_error, count > max_size());
+
+    while (size_ > count) {
+      pop_back();
+    }
+    while (size_ < count) {
+      emplace_back(Fields()...);
+    }
+  }
+
+  // Exchanges the contents of the container with those of other.
+  //
+  // Due to the nature of the storage performs per-element swap.
+  constexpr void swap(StaticSoAVector& other) {
+    StaticSoAVector* shorter = this;
+    StaticSoAVector* longer = &other;
+    if (shorter->size_ > longer->size_) {
+      std::swap(shorter, longer);
+    }
+
+    for (size_type i = 0; i < shorter->size_; ++i) {
+      SwapElements(*shorter, *longer, i, kFieldIndices);
+    }
+
+    for (size_type i = shorter->size_; i < longer->size_; ++i) {
+      shorter->ConstructElementFrom(i, std::move(*longer), i, kFieldIndices);
+      longer->DestroyFields(i, num_fields);
+    }
+
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  static constexpr auto kFieldIndices = std::index_sequence_for<Fields...>();
+
+  // Iterator over elements of the container.
+  //
+  // Refers to an element by its index, and dereferences to a tuple of
+  // references to the fields of the element.
+  template <bool IsConst>
+  class Iterator {
+    using Container = std::
+        conditional_t<IsConst, const StaticSoAVector, StaticSoAVector>;
+
+   public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = StaticSoAVector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<IsConst,
+                                         StaticSoAVector::const_reference,
+                                         StaticSoAVector::reference>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(Container* container, const size_type index)
+        : container_(container), index_(index) {}
+
+    // Allow conversion from mutable to constant iterator.
+    template <bool OtherIsConst,
+              class = std::enable_if_t<IsConst && !OtherIsConst>>
+    constexpr Iterator(const Iterator<OtherIsConst>& other)
+        : container_(other.container_), index_(other.index_) {}
+
+    constexpr auto operator*() const -> reference {
+      return (*container_)[index_];
+    }
+    constexpr auto operator[](const difference_type n) const -> reference {
+      return (*container_)[index_ + n];
+    }
+
+    constexpr auto operator++() -> Iterator& {
+      ++index_;
+      return *this;
+    }
+    constexpr auto operator++(int) -> Iterator {
+      Iterator result = *this;
+      ++*this;
+      return result;
+    }
+    constexpr auto operator--() -> Iterator& {
+      --index_;
+      return *this;
+    }
+    constexpr auto operator--(int) -> Iterator {
+      Iterator result = *this;
+      --*this;
+      return result;
+    }
+
+    constexpr auto operator+=(const difference_type n) -> Iterator& {
+      index_ += n;
+      return *this;
+    }
+    constexpr auto operator-=(const difference_type n) -> Iterator& {
+      index_ -= n;
+      return *this;
+    }
+
+    friend constexpr auto operator+(Iterator it, const difference_type n)
+        -> Iterator {
+      return it += n;
+    }
+    friend constexpr auto operator+(const difference_type n, Iterator it)
+        -> Iterator {
+      return it += n;
+    }
+    friend constexpr auto operator-(Iterator it, const difference_type n)
+        -> Iterator {
+      return it -= n;
+    }
+    friend constexpr auto operator-(const Iterator& lhs, const Iterator& rhs)
+        -> difference_type {
+      return difference_type(lhs.index_) - difference_type(rhs.index_);
+    }
+
+    friend constexpr auto operator==(const Iterator& lhs, const Iterator& rhs)
+        -> bool {
+      return lhs.index_ == rhs.index_;
+    }
+    friend constexpr auto operator<=>(const Iterator& lhs,
+                                      const Iterator& rhs) {
+      return lhs.index_ <=> rhs.index_;
+    }
+
+   private:
+    friend class Iterator<!IsConst>;
+    friend class StaticSoAVector;
+
+    Container* container_{nullptr};
+    size_type index_{0};
+  };
+
+  // Destroys the first count fields of the element at the given index when it
+  // goes out of scope, unless dismissed.
+  //
+  // Used to roll back a partially constructed element if the constructor of one
+  // of its fields throws.
+  class ConstructionGuard {
+   public:
+    constexpr ConstructionGuard(StaticSoAVector* container,
+                                const size_type index)
+        : container_(container), index_(index) {}
+
+    ConstructionGuard(const ConstructionGuard& other) = delete;
+    ConstructionGuard(ConstructionGuard&& other) = delete;
+
+    constexpr ~ConstructionGuard() {
+      if (num_constructed_ != num_fields) {
+        container_->DestroyFields(index_, num_constructed_);
+      }
+    }
+
+    auto operator=(const ConstructionGuard& other)
+        -> ConstructionGuard& = delete;
+    auto operator=(ConstructionGuard&& other) -> ConstructionGuard& = delete;
+
+    constexpr void MarkConstructed() { ++num_constructed_; }
+
+   private:
+    StaticSoAVector* container_;
+    size_type index_;
+    size_type num_constructed_{0};
+  };
+
+  template <std::size_t I>
+  constexpr auto GetColumnData() noexcept -> field_type<I>* {
+    return reinterpret_cast<field_type<I>*>(std::get<I>(columns_).data);
+  }
+  template <std::size_t I>
+  constexpr auto GetColumnData() const noexcept -> const field_type<I>* {
+    return reinterpret_cast<const field_type<I>*>(std::get<I>(columns_).data);
+  }
+
+  template <std::size_t... Is>
+  constexpr auto GetElement(const size_type index, std::index_sequence<Is...>)
+      -> reference {
+    return reference(GetColumnData<Is>()[index]...);
+  }
+  template <std::size_t... Is>
+  constexpr auto GetElement(const size_type index,
+                            std::index_sequence<Is...>) const
+      -> const_reference {
+    return const_reference(GetColumnData<Is>()[index]...);
+  }
+
+  // Construct fields of the element at the given index from the corresponding
+  // arguments. If construction of any field throws, the already constructed
+  // fields are destroyed.
+  template <std::size_t... Is, class... Args>
+  constexpr void ConstructElement(const size_type index,
+                                  std::index_sequence<Is...>,
+                                  Args&&... args) {
+    ConstructionGuard guard(this, index);
+    ((::new (GetColumnData<Is>() + index)
+          field_type<Is>(std::forward<Args>(args)),
+      guard.MarkConstructed()),
+     ...);
+  }
+
+  // Construct the element at the given index by moving fields of the element
+  // of other at the other_index.
+  template <std::size_t... Is>
+  constexpr void ConstructElementFrom(const size_type index,
+                                      StaticSoAVector&& other,
+                                      const size_type other_index,
+                                      std::index_sequence<Is...> indices) {
+    ConstructElement(
+        index, indices, std::move(other.GetColumnData<Is>()[other_index])...);
+  }
+
+  template <class Tuple, std::size_t... Is>
+  constexpr void EmplaceBackFromTuple(Tuple&& tuple,
+                                      std::index_sequence<Is...>) {
+    emplace_back(std::get<Is>(std::forward<Tuple>(tuple))...);
+  }
+
+  template <std::size_t... Is>
+  constexpr void MoveAssignElement(const size_type dst_index,
+                                   const size_type src_index,
+                                   std::index_sequence<Is...>) {
+    ((GetColumnData<Is>()[dst_index] =
+          std::move(GetColumnData<Is>()[src_index])),
+     ...);
+  }
+
+  template <std::size_t... Is>
+  static constexpr void SwapElements(StaticSoAVector& lhs,
+                                     StaticSoAVector& rhs,
+                                     const size_type index,
+                                     std::index_sequence<Is...>) {
+    using std::swap;
+    (swap(lhs.GetColumnData<Is>()[index], rhs.GetColumnData<Is>()[index]),
+     ...);
+  }
+
+  // Destroy the first count fields of the element at the given index.
+  constexpr void DestroyFields(const size_type index, const size_type count) {
+    DestroyFields(index, count, kFieldIndices);
+  }
+  template <std::size_t... Is>
+  constexpr void DestroyFields(const size_type index,
+                               const size_type count,
+                               std::index_sequence<Is...>) {
+    ((Is < count ? std::destroy_at(GetColumnData<Is>() + index) : void()),
+     ...);
+  }
+
+  std::tuple<internal::ColumnStorage<Fields, N>...> columns_;
+  size_type size_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Non-member functions.
+
+// Checks if the contents of lhs and rhs are equal, that is, they have the same
+// number of elements and each element in lhs compares equal with the element in
+// rhs at the same position.
+template <std::size_t N, std::size_t M, class... Fields>
+constexpr auto operator==(const StaticSoAVector<N, Fields...>& lhs,
+                          const StaticSoAVector<M, Fields...>& rhs) -> bool {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+template <std::size_t N, std::size_t M, class... Fields>
+constexpr auto operator!=(const StaticSoAVector<N, Fields...>& lhs,
+                          const StaticSoAVector<M, Fields...>& rhs) -> bool {
+  return !(lhs == rhs);
+}
+
+// Specializes the swap() algorithm for StaticSoAVector.
+// Swaps the contents of lhs and rhs. Equivalent to `lhs.swap(rhs)`.
+template <std::size_t N, class... Fields>
+constexpr void swap(StaticSoAVector<N, Fields...>& lhs,
+                    StaticSoAVector<N, Fields...>& rhs) {
+  lhs.swap(rhs);
+}
+
+// Erases all elements that satisfy the predicate pred from the container.
+// The predicate is called with a tuple of const references to the fields of an
+// element. The order of the remaining elements is not preserved.
+// Returns the number of erased elements.
+template <std::size_t N, class... Fields, class Pred>
+constexpr auto erase_if(StaticSoAVector<N, Fields...>& c, Pred pred) ->
+    typename StaticSoAVector<N, Fields...>::size_type {
+  using Container = StaticSoAVector<N, Fields...>;
+  using ConstReference = typename Container::const_reference;
+
+  const typename Container::size_type old_size = c.size();
+
+  for (typename Container::size_type i = 0; i < c.size();) {
+    if (pred(ConstReference(c[i]))) {
+      c.erase(c.begin() + i);
+    } else {
+      ++i;
+    }
+  }
+
+  return old_size - c.size();
+}
+
+// NOLINTEND(readability-identifier-naming)
+
+}  // namespace TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE
+}  // namespace TL_STATIC_SOA_VECTOR_NAMESPACE
+
+#undef TL_STATIC_SOA_VECTOR_VERSION_MAJOR
+#undef TL_STATIC_SOA_VECTOR_VERSION_MINOR
+#undef TL_STATIC_SOA_VECTOR_VERSION_REVISION
+
+#undef TL_STATIC_SOA_VECTOR_NAMESPACE
+
+#undef TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_SOA_VECTOR_VERSION_NAMESPACE
+
+#undef TL_STATIC_SOA_VECTOR_THROW_IF
+
+#undef TL_STATIC_SOA_VECTOR_COLUMN_ALIGNMENT
@@ -7,6 +7,16 @@
 // StaticVector implements C++ std::vector API and used in-object storage of a
 // static size. No allocations will happen be performed by the static vector.
 //
+// Trivially relocatable types
+// ===========================
+//
+// Elements which are moved to a new location within the storage (insert, erase,
+// move construction and assignment, swap) are relocated with a single memmove
+// for types for which IsTriviallyRelocatable<T> is true. By default this is
+// the case for trivially copyable types, and the trait can be specialized for
+// other types which can be relocated by copying their bytes. Copying of
+// trivially copyable types is done with memcpy.
+//
 //
 // Exceptions
 // ==========
@@ -26,6 +36,9 @@
 // Version history
 // ===============
 //
+//   0.0.2-alpha    (18 Oct 2026)    Relocate trivially relocatable elements
+//                                   with memmove, align the storage to the
+//                                   alignment of T.
 //   0.0.1-alpha    (28 Dec 2023)    First public release.
 
 #pragma once
@@ -33,15 +46,17 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 // Semantic version of the tl_static_vector library.
 #define TL_STATIC_VECTOR_VERSION_MAJOR 0
 #define TL_STATIC_VECTOR_VERSION_MINOR 0
-#define TL_STATIC_VECTOR_VERSION_REVISION 1
+#define TL_STATIC_VECTOR_VERSION_REVISION 2
 
 // Namespace of the module.
 // The outer name spaces which surrounds the ABI-version namespace.
@@ -129,6 +144,14 @@ using EnableIfLegacyInputIterator = std::enable_if_t<std::input_iterator<T>>;
 
 }  // namespace internal
 
+// Trait which denotes that moving an object of type T to a new location and
+// destroying the original is equivalent to copying its bytes.
+//
+// Can be specialized for types which are not trivially copyable but are known
+// to be trivially relocatable.
+template <class T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
 // The code follows the STL naming convention for easier interchangeability with
 // the standard vector type.
 //
@@ -205,9 +228,7 @@ class StaticVector {
     const size_type count = other.size();
     reserve(count);
 
-    for (size_type i = 0; i < count; ++i) {
-      new (GetElementPointer(i)) T(*other.GetElementPointer(i));
-    }
+    CopyConstructElements(data(), other.data(), count);
 
     size_ = count;
   }
@@ -220,9 +241,7 @@ class StaticVector {
 
     const size_type count = other.size();
 
-    for (size_type i = 0; i < count; ++i) {
-      new (GetElementPointer(i)) T(std::move(*other.GetElementPointer(i)));
-    }
+    RelocateElements(data(), other.data(), count);
 
     size_ = count;
 
@@ -260,9 +279,7 @@ class StaticVector {
 
     const size_t count = other.size();
 
-    for (size_type i = 0; i < count; ++i) {
-      new (GetElementPointer(i)) T(std::move(*other.GetElementPointer(i)));
-    }
+    RelocateElements(data(), other.data(), count);
 
     size_ = count;
 
@@ -569,13 +586,8 @@ class StaticVector {
     if (last != end()) {
       const size_type num_relocate = size() - start_index - count;
 
-      T* dst = &mem[start_index];
-      T* src = &mem[start_index + count];
-
-      for (size_type i = 0; i < num_relocate; ++i, ++dst, ++src) {
-        new (dst) T(std::move(*src));
-        DestroyElement(src);
-      }
+      RelocateElements(
+          &mem[start_index], &mem[start_index + count], num_relocate);
     }
 
     size_ -= count;
@@ -674,15 +686,11 @@ class StaticVector {
     }
 
     if (own_size > other_size) {
-      for (size_type i = min_size; i < own_size; ++i) {
-        new (&other_mem[i]) T(std::move(own_mem[i]));
-        DestroyElement(&own_mem[i]);
-      }
+      RelocateElements(
+          &other_mem[min_size], &own_mem[min_size], own_size - min_size);
     } else {
-      for (size_type i = min_size; i < other_size; ++i) {
-        new (&own_mem[i]) T(std::move(other_mem[i]));
-        DestroyElement(&other_mem[i]);
-      }
+      RelocateElements(
+          &own_mem[min_size], &other_mem[min_size], other_size - min_size);
     }
 
     std::swap(size_, other.size_);
@@ -752,22 +760,78 @@ class StaticVector {
 
     size_ += count;
 
-    iterator dst_it = std::prev(end());
-    iterator src_it = std::prev(dst_it, count);
+    RelocateElements(data() + index + count, data() + index, num_relocate);
 
-    for (size_type i = 0; i < num_relocate; ++i) {
-      new (&(*dst_it)) T(std::move(*src_it));
+    return data() + index;
+  }
 
-      DestroyElement(&(*src_it));
+  // Copy-construct count elements from src into the uninitialized memory at
+  // dst. The ranges are not to overlap.
+  constexpr void CopyConstructElements(T* dst,
+                                       const T* src,
+                                       const size_type count) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if (!std::is_constant_evaluated()) {
+        if (count) {
+          std::memcpy(dst, src, count * sizeof(T));
+        }
+        return;
+      }
+    }
+
+    for (size_type i = 0; i < count; ++i) {
+      new (dst + i) T(src[i]);
+    }
+  }
 
-      dst_it = std::prev(dst_it);
-      src_it = std::prev(src_it);
+  // Relocate count elements from src to the uninitialized memory at dst:
+  // construct elements at dst from the elements at src, and destroy the
+  // elements at src. The ranges are allowed to overlap.
+  //
+  // Memory of the elements at src which is not covered by dst is left in an
+  // uninitialized state.
+  constexpr void RelocateElements(T* dst, T* src, const size_type count) {
+    if (dst == src || count == 0) {
+      return;
     }
 
-    return data() + index;
+    if constexpr (IsTriviallyRelocatable<T>::value) {
+      if (!std::is_constant_evaluated()) {
+        std::memmove(static_cast<void*>(dst),
+                     static_cast<const void*>(src),
+                     count * sizeof(T));
+
+        // Mark the part of the source which is not overwritten as
+        // uninitialized.
+        if (dst < src) {
+          const size_type num_vacated = std::min<size_type>(src - dst, count);
+          for (size_type i = 0; i < num_vacated; ++i) {
+            MarkMemoryUninitialized(src + count - num_vacated + i);
+          }
+        } else {
+          const size_type num_vacated = std::min<size_type>(dst - src, count);
+          for (size_type i = 0; i < num_vacated; ++i) {
+            MarkMemoryUninitialized(src + i);
+          }
+        }
+        return;
+      }
+    }
+
+    if (dst < src) {
+      for (size_type i = 0; i < count; ++i) {
+        new (dst + i) T(std::move(src[i]));
+        DestroyElement(src + i);
+      }
+    } else {
+      for (size_type i = count; i-- > 0;) {
+        new (dst + i) T(std::move(src[i]));
+        DestroyElement(src + i);
+      }
+    }
   }
 
-  uint8_t data_[sizeof(T) * N];  // NOLINT(modernize-avoid-c-arrays)
+  alignas(T) uint8_t data_[sizeof(T) * N];  // NOLINT(modernize-avoid-c-arrays)
   size_type size_{0};
 };
 
@@ -4,10 +4,57 @@
 
 #include "tl_functional/tl_callback.h"
 
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "tiny_lib/unittest/test.h"
 
 namespace tiny_lib::callback {
 
+namespace {
+
+// Executor which queues the tasks until they are explicitly run.
+class QueueExecutor : public Executor {
+ public:
+  void Execute(std::function<void()> task) override {
+    std::unique_lock lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+
+  // Run all queued tasks.
+  // Returns the number of tasks which were run.
+  auto RunAll() -> int {
+    int num_tasks = 0;
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock lock(mutex_);
+        if (tasks_.empty()) {
+          break;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+      ++num_tasks;
+    }
+    return num_tasks;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::deque<std::function<void()>> tasks_;
+};
+
+}  // namespace
+
 TEST(Callback, DefaultIDConstructor) {
   using MyCallback = Callback<void(int)>;
   MyCallback my_callback;
@@ -85,4 +132,231 @@ TEST(Callback, RemoveAllListeners) {
   EXPECT_EQ(counter, 17);
 }
 
+TEST(Callback, PostWithoutExecutor) {
+  using MyCallback = Callback<void(int)>;
+  MyCallback my_callback;
+
+  int counter = 0;
+  my_callback.AddListener([&counter](int x) { counter += x; });
+
+  // Listeners without executor are invoked from the Post().
+  my_callback.Post(17);
+  EXPECT_EQ(counter, 17);
+}
+
+TEST(Callback, PostExecutorAffinity) {
+  using MyCallback = Callback<void(const std::string&)>;
+  MyCallback my_callback;
+
+  QueueExecutor default_executor;
+  QueueExecutor ui_executor;
+
+  std::vector<std::string> default_calls;
+  std::vector<std::string> ui_calls;
+
+  my_callback.SetExecutor(&default_executor);
+  my_callback.AddListener(
+      [&](const std::string& str) { default_calls.push_back(str); });
+  my_callback.AddListener(
+      [&](const std::string& str) { ui_calls.push_back(str); }, &ui_executor);
+
+  // The argument is copied into the event.
+  {
+    std::string str = "event";
+    my_callback.Post(str);
+    str = "modified";
+  }
+  EXPECT_TRUE(default_calls.empty());
+  EXPECT_TRUE(ui_calls.empty());
+
+  EXPECT_EQ(ui_executor.RunAll(), 1);
+  EXPECT_TRUE(default_calls.empty());
+  EXPECT_EQ(ui_calls, std::vector<std::string>({"event"}));
+
+  EXPECT_EQ(default_executor.RunAll(), 1);
+  EXPECT_EQ(default_calls, std::vector<std::string>({"event"}));
+
+  my_callback.WaitForPostedEvents();
+}
+
+TEST(Callback, TryPostBackpressure) {
+  using MyCallback = Callback<void(int)>;
+  MyCallback my_callback;
+
+  QueueExecutor executor;
+  my_callback.SetExecutor(&executor);
+  my_callback.SetMaxNumPostedEvents(2);
+
+  int counter = 0;
+  my_callback.AddListener([&counter](int x) { counter += x; });
+  my_callback.AddListener([&counter](int x) { counter += x * 10; });
+
+  EXPECT_TRUE(my_callback.TryPost(1));
+  EXPECT_TRUE(my_callback.TryPost(2));
+  EXPECT_FALSE(my_callback.TryPost(3));
+
+  // The slot is freed once all listeners have handled the event.
+  EXPECT_EQ(executor.RunAll(), 4);
+  EXPECT_EQ(counter, 33);
+
+  EXPECT_TRUE(my_callback.TryPost(4));
+  EXPECT_EQ(executor.RunAll(), 2);
+  EXPECT_EQ(counter, 77);
+}
+
+TEST(Callback, DefaultMaxNumPostedEvents) {
+  using MyCallback = Callback<void(int)>;
+  MyCallback my_callback;
+
+  QueueExecutor executor;
+  my_callback.SetExecutor(&executor);
+  my_callback.AddListener([](int /*x*/) {});
+
+  // Zero restores the default number of event slots.
+  my_callback.SetMaxNumPostedEvents(1);
+  my_callback.SetMaxNumPostedEvents(0);
+  for (std::size_t i = 0; i < MyCallback::kDefaultMaxNumPostedEvents; ++i) {
+    EXPECT_TRUE(my_callback.TryPost(1));
+  }
+  EXPECT_FALSE(my_callback.TryPost(1));
+
+  EXPECT_EQ(executor.RunAll(), MyCallback::kDefaultMaxNumPostedEvents);
+}
+
+TEST(Callback, PostDoesNotCopyListeners) {
+  using MyCallback = Callback<void(int)>;
+  MyCallback my_callback;
+
+  // Listener which counts its copies.
+  struct Listener {
+    explicit Listener(int& counter) : num_copies(counter) {}
+    Listener(const Listener& other) : num_copies(other.num_copies) {
+      ++num_copies;
+    }
+
+    void operator()(int /*x*/) const {}
+
+    int& num_copies;
+  };
+
+  QueueExecutor executor;
+  my_callback.SetExecutor(&executor);
+
+  int num_copies = 0;
+  my_callback.AddListener(Listener(num_copies));
+  const int num_copies_after_add = num_copies;
+
+  for (int i = 0; i < 4; ++i) {
+    my_callback.Post(i);
+    EXPECT_EQ(executor.RunAll(), 1);
+  }
+  EXPECT_EQ(num_copies, num_copies_after_add);
+}
+
+TEST(Callback, PostBlocks) {
+  using MyCallback = Callback<void(int)>;
+  MyCallback my_callback;
+
+  QueueExecutor executor;
+  my_callback.SetExecutor(&executor);
+  my_callback.SetMaxNumPostedEvents(1);
+
+  std::atomic<int> counter = 0;
+  my_callback.AddListener([&counter](int x) { counter += x; });
+
+  my_callback.Post(1);
+
+  // The second event waits for the first one to be handled.
+  std::atomic<bool> posted = false;
+  std::thread thread([&]() {
+    my_callback.Post(2);
+    posted = true;
+  });
+
+  while (!posted) {
+    executor.RunAll();
+    std::this_thread::yield();
+  }
+  thread.join();
+
+  executor.RunAll();
+  EXPECT_EQ(counter, 3);
+}
+
+TEST(Callback, PostReentrant) {
+  using MyCallback = Callback<void(int)>;
+  MyCallback my_callback;
+
+  QueueExecutor executor;
+
+  std::vector<int> calls;
+
+  // The listener which is invoked from the Post() adds and removes listeners.
+  MyCallback::ID id;
+  id = my_callback.AddListener([&](int x) {
+    calls.push_back(x);
+    my_callback.RemoveListener(id);
+    my_callback.AddListener([&calls](int y) { calls.push_back(y * 10); },
+                            &executor);
+  });
+
+  my_callback.Post(1);
+  EXPECT_EQ(calls, std::vector<int>({1}));
+
+  // The listener which is added while the event is being dispatched does not
+  // handle the event.
+  EXPECT_EQ(executor.RunAll(), 0);
+
+  my_callback.Post(2);
+  EXPECT_EQ(executor.RunAll(), 1);
+  EXPECT_EQ(calls, std::vector<int>({1, 20}));
+}
+
+TEST(Callback, PostReentrantExecutor) {
+  using MyCallback = Callback<void(int)>;
+  MyCallback my_callback;
+
+  // Executor which changes the listeners of the callback when a task is
+  // scheduled.
+  class ChangingExecutor : public QueueExecutor {
+   public:
+    explicit ChangingExecutor(MyCallback& callback) : callback_(callback) {}
+
+    void Execute(std::function<void()> task) override {
+      callback_.RemoveListener(callback_.AddListener([](int /*x*/) {}));
+      QueueExecutor::Execute(std::move(task));
+    }
+
+   private:
+    MyCallback& callback_;
+  };
+
+  ChangingExecutor executor(my_callback);
+  my_callback.SetExecutor(&executor);
+
+  int counter = 0;
+  const MyCallback::ID id =
+      my_callback.AddListener([&counter](int x) { counter += x; });
+
+  my_callback.Post(17);
+
+  // The listener is handling the posted event even if it is removed prior to
+  // the task being run.
+  my_callback.RemoveListener(id);
+  EXPECT_EQ(executor.RunAll(), 1);
+  EXPECT_EQ(counter, 17);
+}
+
+TEST(Callback, PostMoveOnlyListener) {
+  using MyCallback = Callback<void(std::unique_ptr<int>&&)>;
+  MyCallback my_callback;
+
+  // Post() is not available for callbacks with rvalue reference arguments,
+  // but the callback is still usable for the synchronous invocation.
+  int value = 0;
+  my_callback.AddListener([&value](std::unique_ptr<int>&& x) { value = *x; });
+  my_callback(std::make_unique<int>(17));
+  EXPECT_EQ(value, 17);
+}
+
 }  // namespace tiny_lib::callback
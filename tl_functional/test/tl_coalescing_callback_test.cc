@@ -0,0 +1,241 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_functional/tl_coalescing_callback.h"
+
+#include <atomic>
+#include <chrono>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::coalescing_callback {
+
+namespace {
+
+// Clock which is only advanced explicitly.
+struct FakeClock {
+  using duration = std::chrono::milliseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<FakeClock>;
+
+  static constexpr bool is_steady = true;
+
+  static auto now() -> time_point { return current_time; }
+
+  static inline time_point current_time{};
+};
+
+// Listener which records all deliveries.
+class Recorder {
+ public:
+  auto GetListener() {
+    return [this](std::span<const int> events) {
+      deliveries.emplace_back(events.begin(), events.end());
+    };
+  }
+
+  std::vector<std::vector<int>> deliveries;
+};
+
+// Event which counts its alive instances.
+class CountedEvent {
+ public:
+  static inline int num_alive = 0;
+
+  CountedEvent() { ++num_alive; }
+  CountedEvent(const CountedEvent& /*other*/) { ++num_alive; }
+
+  ~CountedEvent() { --num_alive; }
+
+  auto operator=(const CountedEvent& other) -> CountedEvent& = default;
+};
+
+}  // namespace
+
+TEST(CoalescingCallback, KeepLatest) {
+  CoalescingCallback<int> my_callback;
+
+  Recorder recorder;
+  my_callback.AddListener(recorder.GetListener(),
+                          CoalescingPolicy::KeepLatest());
+
+  // Nothing is delivered until the flush, and the flush without events does
+  // not invoke the listener.
+  my_callback(1);
+  my_callback(2);
+  my_callback(3);
+  EXPECT_TRUE(recorder.deliveries.empty());
+
+  my_callback.Flush();
+  my_callback.Flush();
+  EXPECT_EQ(recorder.deliveries, std::vector<std::vector<int>>({{3}}));
+
+  my_callback(4);
+  my_callback.Flush();
+  EXPECT_EQ(recorder.deliveries, std::vector<std::vector<int>>({{3}, {4}}));
+}
+
+TEST(CoalescingCallback, Batch) {
+  CoalescingCallback<int, 4> my_callback;
+
+  Recorder recorder;
+  my_callback.AddListener(recorder.GetListener(), CoalescingPolicy::Batch(4));
+
+  my_callback(1);
+  my_callback(2);
+  my_callback.Flush();
+  EXPECT_EQ(recorder.deliveries, std::vector<std::vector<int>>({{1, 2}}));
+
+  // The oldest events are discarded when the batch is full.
+  for (int i = 3; i <= 9; ++i) {
+    my_callback(i);
+  }
+  my_callback.Flush();
+  EXPECT_EQ(recorder.deliveries,
+            std::vector<std::vector<int>>({{1, 2}, {6, 7, 8, 9}}));
+}
+
+TEST(CoalescingCallback, BatchSize) {
+  CoalescingCallback<int, 4> my_callback;
+
+  Recorder small;
+  Recorder large;
+  Recorder empty;
+  my_callback.AddListener(small.GetListener(), CoalescingPolicy::Batch(2));
+  my_callback.AddListener(large.GetListener(), CoalescingPolicy::Batch(100));
+  my_callback.AddListener(empty.GetListener(), CoalescingPolicy::Batch(0));
+
+  // Every listener keeps its own number of the latest events. The batch size
+  // is clamped to the MaxBatchSize of the callback, and to at least one event.
+  for (int i = 1; i <= 6; ++i) {
+    my_callback(i);
+  }
+  my_callback.Flush();
+  EXPECT_EQ(small.deliveries, std::vector<std::vector<int>>({{5, 6}}));
+  EXPECT_EQ(large.deliveries, std::vector<std::vector<int>>({{3, 4, 5, 6}}));
+  EXPECT_EQ(empty.deliveries, std::vector<std::vector<int>>({{6}}));
+
+  // The full batch is not delivered until the flush.
+  my_callback(7);
+  my_callback(8);
+  my_callback(9);
+  EXPECT_EQ(small.deliveries.size(), 1);
+  my_callback.Flush();
+  EXPECT_EQ(small.deliveries, std::vector<std::vector<int>>({{5, 6}, {8, 9}}));
+}
+
+TEST(CoalescingCallback, ListenerStorage) {
+  {
+    CoalescingCallback<CountedEvent, 64> my_callback;
+
+    // The listeners only store as many events as their policy needs: one
+    // pending and one delivering event, or two batches.
+    my_callback.AddListener([](std::span<const CountedEvent> /*events*/) {},
+                            CoalescingPolicy::KeepLatest());
+    EXPECT_EQ(CountedEvent::num_alive, 2);
+
+    my_callback.AddListener([](std::span<const CountedEvent> /*events*/) {},
+                            CoalescingPolicy::Batch(4));
+    EXPECT_EQ(CountedEvent::num_alive, 10);
+  }
+  EXPECT_EQ(CountedEvent::num_alive, 0);
+}
+
+TEST(CoalescingCallback, Throttle) {
+  using MyCallback = CoalescingCallback<int, 1, FakeClock>;
+  MyCallback my_callback;
+
+  FakeClock::current_time = FakeClock::time_point(std::chrono::seconds(1));
+
+  Recorder recorder;
+  my_callback.AddListener(
+      recorder.GetListener(),
+      CoalescingPolicy::Throttle(std::chrono::milliseconds(100)));
+
+  // The first event is delivered by the first flush.
+  my_callback(1);
+  my_callback.Flush();
+  EXPECT_EQ(recorder.deliveries, std::vector<std::vector<int>>({{1}}));
+
+  // Within the window the events are kept.
+  my_callback(2);
+  FakeClock::current_time += std::chrono::milliseconds(50);
+  my_callback(3);
+  my_callback.Flush();
+  EXPECT_EQ(recorder.deliveries, std::vector<std::vector<int>>({{1}}));
+
+  // The latest event is delivered once the window has passed.
+  FakeClock::current_time += std::chrono::milliseconds(50);
+  my_callback.Flush();
+  EXPECT_EQ(recorder.deliveries, std::vector<std::vector<int>>({{1}, {3}}));
+}
+
+TEST(CoalescingCallback, PerListenerPolicy) {
+  CoalescingCallback<int, 8> my_callback;
+
+  Recorder latest;
+  Recorder batch;
+  my_callback.AddListener(latest.GetListener(), CoalescingPolicy::KeepLatest());
+  const auto batch_id =
+      my_callback.AddListener(batch.GetListener(), CoalescingPolicy::Batch(8));
+
+  my_callback(1);
+  my_callback(2);
+  my_callback.Flush();
+  EXPECT_EQ(latest.deliveries, std::vector<std::vector<int>>({{2}}));
+  EXPECT_EQ(batch.deliveries, std::vector<std::vector<int>>({{1, 2}}));
+
+  my_callback.RemoveListener(batch_id);
+  my_callback(3);
+  my_callback.Flush();
+  EXPECT_EQ(latest.deliveries, std::vector<std::vector<int>>({{2}, {3}}));
+  EXPECT_EQ(batch.deliveries, std::vector<std::vector<int>>({{1, 2}}));
+
+  my_callback.RemoveAllListeners();
+  my_callback(4);
+  my_callback.Flush();
+  EXPECT_EQ(latest.deliveries.size(), 2);
+}
+
+TEST(CoalescingCallback, Concurrent) {
+  CoalescingCallback<int, 16> my_callback;
+
+  constexpr int kNumEvents = 10000;
+
+  int last_event = 0;
+  int num_events = 0;
+  my_callback.AddListener(
+      [&](std::span<const int> events) {
+        // The events of a batch are delivered in the order they were fired.
+        for (const int event : events) {
+          EXPECT_GT(event, last_event);
+          last_event = event;
+          ++num_events;
+        }
+      },
+      CoalescingPolicy::Batch(16));
+
+  std::atomic<bool> done = false;
+  std::thread thread([&]() {
+    for (int i = 1; i <= kNumEvents; ++i) {
+      my_callback(i);
+    }
+    done = true;
+  });
+
+  while (!done) {
+    my_callback.Flush();
+  }
+  thread.join();
+  my_callback.Flush();
+
+  EXPECT_EQ(last_event, kNumEvents);
+  EXPECT_GT(num_events, 0);
+}
+
+}  // namespace tiny_lib::coalescing_callback
@@ -0,0 +1,218 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_functional/tl_read_mostly_callback.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::read_mostly_callback {
+
+TEST(ReadMostlyCallback, DefaultIDConstructor) {
+  using MyCallback = ReadMostlyCallback<void(int)>;
+  MyCallback my_callback;
+
+  MyCallback::ID id;
+  (void)id;
+}
+
+TEST(ReadMostlyCallback, Basic) {
+  using MyCallback = ReadMostlyCallback<void(int)>;
+  MyCallback my_callback;
+
+  int counter = 0;
+
+  my_callback(11);
+  EXPECT_EQ(counter, 0);
+
+  const MyCallback::ID id =
+      my_callback.AddListener([&counter](int x) { counter += x; });
+
+  my_callback(17);
+  EXPECT_EQ(counter, 17);
+
+  my_callback.RemoveListener(id);
+
+  my_callback(19);
+  EXPECT_EQ(counter, 17);
+}
+
+TEST(ReadMostlyCallback, MultipleListeners) {
+  using MyCallback = ReadMostlyCallback<void(int)>;
+  MyCallback my_callback;
+
+  std::vector<int> calls;
+
+  const MyCallback::ID id1 =
+      my_callback.AddListener([&calls](int x) { calls.push_back(x); });
+  const MyCallback::ID id2 =
+      my_callback.AddListener([&calls](int x) { calls.push_back(x * 10); });
+
+  my_callback(1);
+  EXPECT_EQ(calls, std::vector<int>({1, 10}));
+
+  my_callback.RemoveListener(id1);
+
+  my_callback(2);
+  EXPECT_EQ(calls, std::vector<int>({1, 10, 20}));
+
+  my_callback.RemoveListener(id2);
+
+  my_callback(3);
+  EXPECT_EQ(calls, std::vector<int>({1, 10, 20}));
+}
+
+TEST(ReadMostlyCallback, RemoveAllListeners) {
+  using MyCallback = ReadMostlyCallback<void(int)>;
+  MyCallback my_callback;
+
+  int counter = 0;
+
+  my_callback.AddListener([&counter](int x) { counter += x; });
+
+  my_callback(17);
+  EXPECT_EQ(counter, 17);
+
+  my_callback.RemoveAllListeners();
+
+  my_callback(19);
+  EXPECT_EQ(counter, 17);
+}
+
+TEST(ReadMostlyCallback, ChangeFromListener) {
+  using MyCallback = ReadMostlyCallback<void()>;
+  MyCallback my_callback;
+
+  int counter = 0;
+
+  // The listener removes itself and adds a new listener. The change does not
+  // affect the invocation which is in progress.
+  MyCallback::ID id;
+  id = my_callback.AddListener([&]() {
+    ++counter;
+    my_callback.RemoveListener(id);
+    my_callback.AddListener([&counter]() { counter += 10; });
+  });
+
+  my_callback();
+  EXPECT_EQ(counter, 1);
+
+  my_callback();
+  EXPECT_EQ(counter, 11);
+}
+
+TEST(ReadMostlyCallback, SlowListener) {
+  using MyCallback = ReadMostlyCallback<void()>;
+  MyCallback my_callback;
+
+  std::atomic<bool> is_listener_running = false;
+  std::atomic<bool> is_listener_released = false;
+
+  my_callback.AddListener([&]() {
+    is_listener_running = true;
+    while (!is_listener_released) {
+      std::this_thread::yield();
+    }
+  });
+
+  std::thread thread([&my_callback]() { my_callback(); });
+
+  while (!is_listener_running) {
+    std::this_thread::yield();
+  }
+
+  // The listeners are changed while the slow listener is running. The changes
+  // do not wait for the listener to finish, otherwise the test never finishes.
+  int counter = 0;
+  const MyCallback::ID id =
+      my_callback.AddListener([&counter]() { ++counter; });
+  my_callback.RemoveListener(id);
+  my_callback.AddListener([&counter]() { ++counter; });
+
+  EXPECT_TRUE(is_listener_running);
+  EXPECT_EQ(counter, 0);
+
+  is_listener_released = true;
+  thread.join();
+
+  EXPECT_EQ(counter, 0);
+
+  my_callback();
+  EXPECT_EQ(counter, 1);
+}
+
+TEST(ReadMostlyCallback, ConcurrentChangeFromListener) {
+  using MyCallback = ReadMostlyCallback<void()>;
+  MyCallback my_callback;
+
+  constexpr int kNumInvocations = 500;
+  constexpr int kNumChanges = 500;
+
+  std::atomic<int> counter = 0;
+
+  // The listener changes listeners while another thread changes them too.
+  my_callback.AddListener([&]() {
+    ++counter;
+    const MyCallback::ID id = my_callback.AddListener([]() {});
+    my_callback.RemoveListener(id);
+  });
+
+  std::thread invoke_thread([&my_callback]() {
+    for (int i = 0; i < kNumInvocations; ++i) {
+      my_callback();
+    }
+  });
+
+  std::thread change_thread([&my_callback]() {
+    for (int i = 0; i < kNumChanges; ++i) {
+      const MyCallback::ID id = my_callback.AddListener([]() {});
+      my_callback.RemoveListener(id);
+    }
+  });
+
+  invoke_thread.join();
+  change_thread.join();
+
+  EXPECT_EQ(counter, kNumInvocations);
+}
+
+TEST(ReadMostlyCallback, Concurrent) {
+  using MyCallback = ReadMostlyCallback<void(int)>;
+  MyCallback my_callback;
+
+  constexpr int kNumInvokeThreads = 3;
+  constexpr int kNumInvocations = 2000;
+  constexpr int kNumChanges = 200;
+
+  std::atomic<int> counter = 0;
+  my_callback.AddListener([&counter](int x) { counter += x; });
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumInvokeThreads; ++i) {
+    threads.emplace_back([&my_callback]() {
+      for (int j = 0; j < kNumInvocations; ++j) {
+        my_callback(1);
+      }
+    });
+  }
+
+  // The listener which is added and removed does not affect the counter.
+  threads.emplace_back([&my_callback]() {
+    for (int j = 0; j < kNumChanges; ++j) {
+      const MyCallback::ID id = my_callback.AddListener([](int /*x*/) {});
+      my_callback.RemoveListener(id);
+    }
+  });
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(counter, kNumInvokeThreads * kNumInvocations);
+}
+
+}  // namespace tiny_lib::read_mostly_callback
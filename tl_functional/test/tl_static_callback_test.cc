@@ -0,0 +1,171 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_functional/tl_static_callback.h"
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::static_callback {
+
+TEST(StaticFunction, Basic) {
+  using Function = StaticFunction<int(int), 16>;
+
+  Function empty;
+  EXPECT_FALSE(empty);
+
+  int offset = 10;
+  Function function([&offset](int x) { return x + offset; });
+  EXPECT_TRUE(function);
+  EXPECT_EQ(function(1), 11);
+
+  Function moved(std::move(function));
+  EXPECT_FALSE(function);  // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(moved(2), 12);
+
+  function = std::move(moved);
+  EXPECT_EQ(function(3), 13);
+
+  // Free functions.
+  function = +[](int x) { return x * 2; };
+  EXPECT_EQ(function(4), 8);
+}
+
+TEST(StaticFunction, MoveOnly) {
+  auto value = std::make_unique<int>(17);
+  StaticFunction<int(), 16> function(
+      [value = std::move(value)]() { return *value; });
+  EXPECT_EQ(function(), 17);
+}
+
+TEST(StaticFunction, Destroy) {
+  auto counter = std::make_shared<int>(0);
+
+  {
+    StaticFunction<void(), 32> function([counter]() { ++*counter; });
+    function();
+    EXPECT_EQ(counter.use_count(), 2);
+  }
+
+  EXPECT_EQ(*counter, 1);
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(StaticCallback, DefaultIDConstructor) {
+  using MyCallback = StaticCallback<void(int), 4>;
+  MyCallback my_callback;
+
+  MyCallback::ID id;
+  EXPECT_FALSE(my_callback.RemoveListener(id));
+}
+
+TEST(StaticCallback, Basic) {
+  using MyCallback = StaticCallback<void(int), 4>;
+  MyCallback my_callback;
+
+  int counter = 0;
+
+  my_callback(11);
+  EXPECT_EQ(counter, 0);
+
+  const MyCallback::ID id =
+      my_callback.AddListener([&counter](int x) { counter += x; });
+
+  my_callback(17);
+  EXPECT_EQ(counter, 17);
+
+  EXPECT_TRUE(my_callback.RemoveListener(id));
+
+  my_callback(19);
+  EXPECT_EQ(counter, 17);
+}
+
+TEST(StaticCallback, MultipleListeners) {
+  using MyCallback = StaticCallback<void(int), 4>;
+  MyCallback my_callback;
+
+  std::vector<int> calls;
+
+  const MyCallback::ID id1 =
+      my_callback.AddListener([&calls](int x) { calls.push_back(x); });
+  const MyCallback::ID id2 =
+      my_callback.AddListener([&calls](int x) { calls.push_back(x * 10); });
+  const MyCallback::ID id3 =
+      my_callback.AddListener([&calls](int x) { calls.push_back(x * 100); });
+  EXPECT_EQ(my_callback.GetNumListeners(), 3);
+
+  my_callback(1);
+  EXPECT_EQ(calls, std::vector<int>({1, 10, 100}));
+
+  // Removal keeps the order of the remaining listeners.
+  EXPECT_TRUE(my_callback.RemoveListener(id1));
+  calls.clear();
+  my_callback(2);
+  EXPECT_EQ(calls, std::vector<int>({20, 200}));
+
+  EXPECT_TRUE(my_callback.RemoveListener(id3));
+  calls.clear();
+  my_callback(3);
+  EXPECT_EQ(calls, std::vector<int>({30}));
+
+  EXPECT_TRUE(my_callback.RemoveListener(id2));
+  EXPECT_EQ(my_callback.GetNumListeners(), 0);
+}
+
+TEST(StaticCallback, StaleID) {
+  using MyCallback = StaticCallback<void(), 1>;
+  MyCallback my_callback;
+
+  int counter = 0;
+
+  const MyCallback::ID id1 =
+      my_callback.AddListener([&counter]() { ++counter; });
+  EXPECT_TRUE(my_callback.RemoveListener(id1));
+  EXPECT_FALSE(my_callback.RemoveListener(id1));
+
+  // The handle is reused, but the old ID does not remove the new listener.
+  const MyCallback::ID id2 =
+      my_callback.AddListener([&counter]() { counter += 10; });
+  EXPECT_NE(id1, id2);
+  EXPECT_FALSE(my_callback.RemoveListener(id1));
+
+  my_callback();
+  EXPECT_EQ(counter, 10);
+}
+
+TEST(StaticCallback, Full) {
+  using MyCallback = StaticCallback<void(), 2>;
+  MyCallback my_callback;
+
+  my_callback.AddListener([]() {});
+  my_callback.AddListener([]() {});
+
+  EXPECT_THROW_OR_ABORT(my_callback.AddListener([]() {}), std::length_error);
+  EXPECT_EQ(my_callback.GetNumListeners(), 2);
+}
+
+TEST(StaticCallback, RemoveAllListeners) {
+  using MyCallback = StaticCallback<void(int), 4>;
+  MyCallback my_callback;
+
+  int counter = 0;
+
+  const MyCallback::ID id =
+      my_callback.AddListener([&counter](int x) { counter += x; });
+
+  my_callback(17);
+  EXPECT_EQ(counter, 17);
+
+  my_callback.RemoveAllListeners();
+  EXPECT_FALSE(my_callback.RemoveListener(id));
+
+  my_callback(19);
+  EXPECT_EQ(counter, 17);
+}
+
+}  // namespace tiny_lib::static_callback
@@ -14,6 +14,39 @@
 // The implementation is thread safe: adding, removing, and invoking the
 // callback could happen from a concurrent threads.
 //
+// Asynchronous dispatch
+// =====================
+//
+// Post() hands the invocation of the listeners to executors, so that the thread
+// which fires the callback does not wait for the listeners:
+//
+//   callback.SetExecutor(&thread_pool);
+//   callback.AddListener(update_ui, &ui_event_loop);
+//   callback.AddListener(write_log);
+//
+//   callback.Post(event);
+//
+// Every listener is executed on its own executor, if it was provided when the
+// listener was added, or on the executor of the callback otherwise. Listeners
+// without any executor are invoked from the Post() itself. The executors and
+// the listeners are called without the internal lock held, so they are allowed
+// to add and remove listeners of the callback.
+//
+// The arguments are copied into one of the preallocated event slots, which is
+// shared by all listeners and freed once the last of them has finished. The
+// number of slots is limited: when all of them are in use Post() waits for a
+// slot to be freed, and TryPost() returns false. This provides a backpressure
+// to the thread which posts events faster than the listeners handle them.
+//
+// The event slot also holds shared references to the listeners, so that a
+// listener which is removed while the event is being handled stays alive until
+// it has handled the event. The task which is handed to the executor only
+// refers to the slot. The storage of the slots is reused, so posting an event
+// does not allocate memory once the slots have grown to the number of
+// listeners (unless copying of the arguments allocates).
+//
+// The destructor of the callback waits for all posted events to be handled.
+//
 //
 // Limitations
 // ===========
@@ -21,27 +54,42 @@
 //  - Uses std::function for function pointer and capture. The behavior is
 //    STL implementation specific, might require allocations.
 //
-//  - Uses std::list<> for container, hence requires heap allocation.
+//  - Uses std::list<> for container, and every listener is allocated as a
+//    shared object, hence adding a listener requires heap allocation.
 //
 //  - Uses std::mutex for thread safety. It could be unavailable on
 //    microcontrollers.
 //
+//  - Post() is only available when the listeners can be invoked with the
+//    arguments stored by value (i.e. for callbacks without rvalue reference
+//    or non-const lvalue reference arguments).
+//
 //
 // Version history
 // ===============
 //
+//   0.0.2-alpha    (19 Oct 2026)    Add Post() and TryPost() for asynchronous
+//                                   dispatch through executors.
 //   0.0.1-alpha    (28 Dec 2023)    First public release.
 
 #pragma once
 
+#include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <list>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 // Semantic version of the tl_callback library.
 #define TL_CALLBACK_VERSION_MAJOR 0
 #define TL_CALLBACK_VERSION_MINOR 0
-#define TL_CALLBACK_VERSION_REVISION 1
+#define TL_CALLBACK_VERSION_REVISION 2
 
 // Namespace of the module.
 // The outer name spaces which surrounds the ABI-version namespace.
@@ -71,6 +119,19 @@
 namespace TL_CALLBACK_NAMESPACE {
 inline namespace TL_CALLBACK_VERSION_NAMESPACE {
 
+// Interface of an executor of the listeners of posted events, such as a thread
+// pool or an event loop of a specific thread.
+class Executor {
+ public:
+  virtual ~Executor() = default;
+
+  // Schedule the task for execution.
+  //
+  // Is called from the thread which posts the event, and is expected to queue
+  // the task rather than to execute it in place.
+  virtual void Execute(std::function<void()> task) = 0;
+};
+
 template <class>
 class Callback;
 
@@ -79,15 +140,36 @@ class Callback<R(Args...)> {
   // Internal function type representing listener of this callback.
   using Function = std::function<R(Args...)>;
 
+  // Registered listener and the executor it is to be executed on when an event
+  // is posted.
+  struct ListenerEntry {
+    Function function;
+    Executor* executor;
+  };
+
   // Storage for registered listeners.
   //
   // Use list to allow having an easy way to use list iterator as an identifier
   // od the listeners without them becoming invalid when adding or removing
   // listeners.
   //
+  // The listeners are shared with the posted events which are being handled.
+  //
   // TODO(sergey): Consider adding possibility to use staticly sized container,
   // to help adopting the code for microcontrollers.
-  using Listeners = std::list<Function>;
+  using Listeners = std::list<std::shared_ptr<const ListenerEntry>>;
+
+  // True if the arguments can be stored by value, and the listeners can be
+  // invoked with the stored arguments. The stored arguments are shared by all
+  // listeners, so they are passed as const.
+  static constexpr bool kCanPost =
+      (std::is_constructible_v<std::decay_t<Args>, Args&&> && ...) &&
+      std::is_invocable_v<const Function&, const std::decay_t<Args>&...>;
+
+  // Arguments of a posted event, stored by value.
+  using StoredArgs = std::conditional_t<kCanPost,
+                                        std::tuple<std::decay_t<Args>...>,
+                                        std::tuple<>>;
 
   // Helper class to wrap implementation details of the ID.
   template <class T>
@@ -109,14 +191,32 @@ class Callback<R(Args...)> {
   using Listener = Function;
   using ID = Wrap<typename Listeners::const_iterator>;
 
+  // Default number of events which can be posted and not yet handled.
+  static constexpr std::size_t kDefaultMaxNumPostedEvents = 16;
+
+  Callback() = default;
+
+  Callback(const Callback& other) = delete;
+  Callback(Callback&& other) noexcept = delete;
+
+  auto operator=(const Callback& other) -> Callback& = delete;
+  auto operator=(Callback&& other) -> Callback& = delete;
+
+  // Waits for all posted events to be handled.
+  ~Callback() { WaitForPostedEvents(); }
+
   // Add listener to the callback.
   //
+  // The executor is used to execute the listener for the posted events. If it
+  // is nullptr the executor of the callback is used.
+  //
   // Returns the identifier of the new listener. This ID can be used to remove
   // the listener from this callback.
-  auto AddListener(Listener listener) -> ID {
+  auto AddListener(Listener listener, Executor* executor = nullptr) -> ID {
     std::unique_lock lock(mutex_);
 
-    listeners_.emplace_back(std::move(listener));
+    listeners_.push_back(std::make_shared<const ListenerEntry>(
+        ListenerEntry{std::move(listener), executor}));
     return {std::prev(listeners_.end())};
   }
 
@@ -129,7 +229,11 @@ class Callback<R(Args...)> {
   }
 
   // Remove all listeners.
-  auto RemoveAllListeners() { listeners_.clear(); }
+  auto RemoveAllListeners() {
+    std::unique_lock lock(mutex_);
+
+    listeners_.clear();
+  }
 
   // Execute the callback.
   //
@@ -141,16 +245,247 @@ class Callback<R(Args...)> {
     std::unique_lock lock(mutex_);
 
     for (auto& listener : listeners_) {
-      std::invoke(listener, std::forward<Args>(args)...);
+      std::invoke(listener->function, std::forward<Args>(args)...);
     }
   }
 
+  // Set executor which executes the listeners of the posted events which do
+  // not have their own executor.
+  void SetExecutor(Executor* executor) {
+    std::unique_lock lock(mutex_);
+
+    executor_ = executor;
+  }
+
+  // Set the maximum number of the events which are posted and not yet handled.
+  //
+  // The event slots are allocated by this call, or by the first Post() if the
+  // maximum has not been set. Waits for all posted events to be handled before
+  // the slots are re-allocated.
+  //
+  // Zero restores the default of kDefaultMaxNumPostedEvents.
+  void SetMaxNumPostedEvents(const std::size_t max_num_events) {
+    std::unique_lock lock(post_mutex_);
+
+    post_condition_.wait(lock, [&]() { return num_posted_events_ == 0; });
+
+    AllocateEvents(max_num_events != 0 ? max_num_events
+                                       : kDefaultMaxNumPostedEvents);
+  }
+
+  // Post the event to be handled by the listeners on their executors.
+  //
+  // The arguments are copied into an event slot. If all event slots are in
+  // use waits for one of them to be freed.
+  void Post(Args... args)
+    requires(kCanPost)
+  {
+    std::unique_lock lock(post_mutex_);
+
+    EnsureEventsAllocated();
+    post_condition_.wait(lock, [&]() { return !free_events_.empty(); });
+
+    Dispatch(lock, std::forward<Args>(args)...);
+  }
+
+  // Post the event if there is a free event slot.
+  //
+  // Returns false if all event slots are in use, in which case the event is
+  // not posted.
+  auto TryPost(Args... args) -> bool
+    requires(kCanPost)
+  {
+    std::unique_lock lock(post_mutex_);
+
+    EnsureEventsAllocated();
+    if (free_events_.empty()) {
+      return false;
+    }
+
+    Dispatch(lock, std::forward<Args>(args)...);
+    return true;
+  }
+
+  // Wait for all posted events to be handled by all their listeners.
+  void WaitForPostedEvents() {
+    std::unique_lock lock(post_mutex_);
+
+    post_condition_.wait(lock, [&]() { return num_posted_events_ == 0; });
+  }
+
  private:
+  // Invocation of a listener for a posted event.
+  struct ListenerTask {
+    Callback* callback;
+    std::size_t event_index;
+    std::shared_ptr<const ListenerEntry> listener;
+    Executor* executor;
+
+    void Run() const {
+      const EventReleaser releaser(*callback, event_index);
+      std::apply(listener->function,
+                 std::as_const(*callback->events_[event_index].args));
+    }
+  };
+
+  // Slot which holds arguments of a posted event and the tasks of its
+  // listeners. The slots are reused, so that the storage of the tasks is only
+  // allocated when the number of listeners grows.
+  struct PostedEvent {
+    std::optional<StoredArgs> args;
+    std::vector<ListenerTask> tasks;
+
+    // Number of listeners which have not yet handled the event.
+    std::size_t num_pending_listeners{0};
+  };
+
+  // Is to be called with the post_mutex_ locked.
+  void AllocateEvents(const std::size_t max_num_events) {
+    std::vector<PostedEvent> events(max_num_events);
+    std::vector<std::size_t> free_events;
+    free_events.reserve(max_num_events);
+    for (std::size_t i = 0; i < max_num_events; ++i) {
+      free_events.push_back(max_num_events - 1 - i);
+    }
+
+    events_ = std::move(events);
+    free_events_ = std::move(free_events);
+  }
+
+  // Is to be called with the post_mutex_ locked.
+  void EnsureEventsAllocated() {
+    if (events_.empty()) {
+      AllocateEvents(kDefaultMaxNumPostedEvents);
+    }
+  }
+
+  // Store the arguments in a free event slot and schedule the listeners.
+  //
+  // Is to be called with the post_mutex_ locked and a free event slot
+  // available. Unlocks the post_mutex_.
+  void Dispatch(std::unique_lock<std::mutex>& post_lock, Args... args) {
+    const std::size_t event_index = free_events_.back();
+    PostedEvent& event = events_[event_index];
+    event.args.emplace(std::forward<Args>(args)...);
+    free_events_.pop_back();
+    ++num_posted_events_;
+
+    // The extra pending listener keeps the event alive until all listeners are
+    // scheduled, even if some of them are finished before the loop is over.
+    event.num_pending_listeners = 1;
+
+    post_lock.unlock();
+
+    EventReleaser releaser(*this, event_index);
+
+    // The references to the listeners are stored in the event slot, so that
+    // the executors and the listeners are called without the mutex_ locked and
+    // are allowed to add and remove listeners.
+    {
+      std::unique_lock lock(mutex_);
+      for (const std::shared_ptr<const ListenerEntry>& listener : listeners_) {
+        event.tasks.push_back(
+            {this,
+             event_index,
+             listener,
+             listener->executor ? listener->executor : executor_});
+      }
+    }
+
+    {
+      std::unique_lock event_lock(post_mutex_);
+      event.num_pending_listeners += event.tasks.size();
+    }
+    releaser.Retain(event.tasks.size());
+
+    for (ListenerTask& task : event.tasks) {
+      if (task.executor) {
+        // The task only refers to the state in the event slot, so it fits
+        // into the small buffer of std::function and is not allocated.
+        task.executor->Execute([task = &task]() { task->Run(); });
+        releaser.Transfer();
+      } else {
+        releaser.Transfer();
+        task.Run();
+      }
+    }
+  }
+
+  // Mark the event as handled by the given number of listeners, and free the
+  // event slot when it is handled by all listeners.
+  void ReleaseEvent(const std::size_t event_index,
+                    const std::size_t num_listeners = 1) {
+    std::unique_lock lock(post_mutex_);
+
+    PostedEvent& event = events_[event_index];
+    event.num_pending_listeners -= num_listeners;
+    if (event.num_pending_listeners != 0) {
+      return;
+    }
+
+    event.args.reset();
+    event.tasks.clear();
+    free_events_.push_back(event_index);
+    --num_posted_events_;
+
+    post_condition_.notify_all();
+  }
+
+  // Releases the event when the listeners are finished, including the case
+  // when a listener throws.
+  class EventReleaser {
+   public:
+    EventReleaser(Callback& callback, const std::size_t event_index)
+        : callback_(callback), event_index_(event_index) {}
+
+    EventReleaser(const EventReleaser& other) = delete;
+    EventReleaser(EventReleaser&& other) noexcept = delete;
+
+    ~EventReleaser() {
+      if (num_listeners_ != 0) {
+        callback_.ReleaseEvent(event_index_, num_listeners_);
+      }
+    }
+
+    auto operator=(const EventReleaser& other) -> EventReleaser& = delete;
+    auto operator=(EventReleaser&& other) -> EventReleaser& = delete;
+
+    // Make the releaser responsible for the given number of additional
+    // listeners.
+    void Retain(const std::size_t num_listeners) {
+      num_listeners_ += num_listeners;
+    }
+
+    // Hand the release of one of the listeners over to its task.
+    void Transfer() { --num_listeners_; }
+
+   private:
+    Callback& callback_;
+    std::size_t event_index_;
+    std::size_t num_listeners_{1};
+  };
+
   // Mutable to allow use from const methods where thread-safety is needed.
   mutable std::mutex mutex_;
 
   // Storage of registered listeners.
   Listeners listeners_;
+
+  // Executor of the listeners which do not have their own executor.
+  Executor* executor_{nullptr};
+
+  // Protects the event slots.
+  std::mutex post_mutex_;
+
+  // Notified when an event slot is freed.
+  std::condition_variable post_condition_;
+
+  // Event slots, and indices of the slots which are not in use.
+  std::vector<PostedEvent> events_;
+  std::vector<std::size_t> free_events_;
+
+  // Number of events which are posted and not yet handled.
+  std::size_t num_posted_events_{0};
 };
 
 }  // namespace TL_CALLBACK_VERSION_NAMESPACE
@@ -0,0 +1,380 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A callback which coalesces frequent events before delivering them.
+//
+// NOTE: Experimental functionality. The API might get changed, or even removed
+//       if the library turns out not to be very reusable.
+//
+// CoalescingCallback is intended for high-frequency sources of events, such as
+// meter levels or progress updates, which are fired much more often than their
+// listeners need to see them. Firing the callback only records the event for
+// every listener according to the listener's coalescing policy. The recorded
+// events are delivered when the consumer calls Flush(), for example once per
+// frame of the user interface:
+//
+//   CoalescingCallback<float, 64> level_changed;
+//
+//   level_changed.AddListener(
+//       [](std::span<const float> levels) { meter.SetLevel(levels.back()); },
+//       CoalescingPolicy::KeepLatest());
+//   level_changed.AddListener(
+//       [](std::span<const float> levels) { graph.Append(levels); },
+//       CoalescingPolicy::Batch(64));
+//
+//   // Audio thread.
+//   level_changed(level);
+//
+//   // User interface thread, every frame.
+//   level_changed.Flush();
+//
+// The listeners receive a span of the events, and the policies are:
+//
+//   - KeepLatest: only the latest event since the previous delivery is kept,
+//     and the listener receives a span of a single event.
+//
+//   - Batch(n): up to n latest events are kept, and the listener receives them
+//     in the order they were fired. When more than n events are fired between
+//     two deliveries the oldest events are discarded, so that the listener
+//     receives the n latest events. The batch is not delivered when it becomes
+//     full, as the delivery only happens from the Flush().
+//
+//   - Throttle: the latest event is kept, as with KeepLatest, but it is
+//     delivered at most once per the given time window.
+//
+// The events are stored in buffers within the listeners, which are allocated
+// when the listener is added. The buffers have the batch size of the listener,
+// and a single event for the KeepLatest and Throttle policies. The MaxBatchSize
+// of the callback is the upper limit of the batch size of any listener: the
+// larger batch sizes are clamped to it. Firing the callback and delivering the
+// events do not allocate memory.
+//
+// Thread safety
+// =============
+//
+// The callback can be fired from any number of threads concurrently with the
+// Flush(). Flush() is to be called from a single thread at a time, and the
+// listeners are invoked from it without holding the lock which is used by the
+// firing. This keeps the firing thread from waiting for slow listeners.
+//
+// Listeners are not to be added or removed from within a listener.
+//
+//
+// Limitations
+// ===========
+//
+//  - Uses std::function for function pointer and capture. The behavior is
+//    STL implementation specific, might require allocations when a listener is
+//    added.
+//
+//  - Uses std::list<> for container, hence adding a listener requires heap
+//    allocation.
+//
+//  - Events are stored in preallocated buffers, so the Event is to be default
+//    constructible and copy assignable.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (19 Oct 2026)    First public release.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Semantic version of the tl_coalescing_callback library.
+#define TL_COALESCING_CALLBACK_VERSION_MAJOR 0
+#define TL_COALESCING_CALLBACK_VERSION_MINOR 0
+#define TL_COALESCING_CALLBACK_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_COALESCING_CALLBACK_NAMESPACE
+#  define TL_COALESCING_CALLBACK_NAMESPACE tiny_lib::coalescing_callback
+#endif
+
+// Helpers for TL_COALESCING_CALLBACK_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_COALESCING_CALLBACK_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)  \
+  v_##id1##_##id2##_##id3
+#define TL_COALESCING_CALLBACK_VERSION_NAMESPACE_CONCAT(id1, id2, id3)         \
+  TL_COALESCING_CALLBACK_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_COALESCING_CALLBACK_VERSION_NAMESPACE -> v_0_1_9
+#define TL_COALESCING_CALLBACK_VERSION_NAMESPACE                               \
+  TL_COALESCING_CALLBACK_VERSION_NAMESPACE_CONCAT(                             \
+      TL_COALESCING_CALLBACK_VERSION_MAJOR,                                    \
+      TL_COALESCING_CALLBACK_VERSION_MINOR,                                    \
+      TL_COALESCING_CALLBACK_VERSION_REVISION)
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_COALESCING_CALLBACK_NAMESPACE {
+inline namespace TL_COALESCING_CALLBACK_VERSION_NAMESPACE {
+
+// Policy of coalescing the events for a listener.
+class CoalescingPolicy {
+ public:
+  using Duration = std::chrono::nanoseconds;
+
+  enum class Kind {
+    kKeepLatest,
+    kBatch,
+    kThrottle,
+  };
+
+  // Keep the latest event.
+  static constexpr auto KeepLatest() -> CoalescingPolicy {
+    return {Kind::kKeepLatest, Duration::zero()};
+  }
+
+  // Keep the batch of up to the given number of the latest events.
+  //
+  // The batch size is clamped to the MaxBatchSize of the callback, and to at
+  // least one event.
+  static constexpr auto Batch(const std::size_t batch_size)
+      -> CoalescingPolicy {
+    return {Kind::kBatch, Duration::zero(), batch_size};
+  }
+
+  // Keep the latest event, and deliver it at most once per the window.
+  static constexpr auto Throttle(const Duration window) -> CoalescingPolicy {
+    return {Kind::kThrottle, window};
+  }
+
+  constexpr auto GetKind() const -> Kind { return kind_; }
+  constexpr auto GetWindow() const -> Duration { return window_; }
+  constexpr auto GetBatchSize() const -> std::size_t { return batch_size_; }
+
+ private:
+  constexpr CoalescingPolicy(const Kind kind,
+                             const Duration window,
+                             const std::size_t batch_size = 1)
+      : kind_(kind), window_(window), batch_size_(batch_size) {}
+
+  Kind kind_;
+  Duration window_;
+  std::size_t batch_size_;
+};
+
+// The MaxBatchSize limits the batch size of the listeners, and is to be
+// increased from the default of a single event for the callbacks with batching
+// listeners.
+template <class Event,
+          std::size_t MaxBatchSize = 1,
+          class Clock = std::chrono::steady_clock>
+class CoalescingCallback {
+  static_assert(MaxBatchSize > 0, "Batch needs at least one event");
+
+  // Internal function type representing listener of this callback.
+  using Function = std::function<void(std::span<const Event>)>;
+
+  struct ListenerEntry {
+    ListenerEntry(Function listener_function,
+                  const CoalescingPolicy listener_policy)
+        : function(std::move(listener_function)),
+          policy(listener_policy),
+          batch_size(GetBatchSize(listener_policy)),
+          pending(batch_size),
+          delivering(batch_size) {}
+
+    // Maximum number of the pending events: the batch size clamped to the
+    // MaxBatchSize for the batches, and a single event for other policies.
+    static auto GetBatchSize(const CoalescingPolicy policy) -> std::size_t {
+      if (policy.GetKind() != CoalescingPolicy::Kind::kBatch) {
+        return 1;
+      }
+      return std::clamp<std::size_t>(policy.GetBatchSize(), 1, MaxBatchSize);
+    }
+
+    Function function;
+    CoalescingPolicy policy;
+
+    std::size_t batch_size;
+
+    // Events which are fired since the last delivery.
+    // For the batches the events form a ring buffer which starts at the
+    // pending_begin.
+    std::vector<Event> pending;
+    std::size_t pending_begin{0};
+    std::size_t num_pending{0};
+
+    // Events which are being delivered to the listener.
+    // Only accessed from the Flush().
+    std::vector<Event> delivering;
+
+    // Time of the last delivery, used by the throttling.
+    typename Clock::time_point last_delivery_time{};
+    bool has_delivered{false};
+  };
+
+  // Storage for registered listeners.
+  //
+  // Use list to allow having an easy way to use list iterator as an identifier
+  // of the listeners without them becoming invalid when adding or removing
+  // listeners.
+  using Listeners = std::list<ListenerEntry>;
+
+  // Helper class to wrap implementation details of the ID.
+  template <class T>
+  struct Wrap {
+   public:
+    Wrap() = default;
+
+   private:
+    friend class CoalescingCallback;
+
+    Wrap(const T& value) : value_(value) {}
+
+    constexpr auto Get() const -> const T& { return value_; }
+
+    T value_;
+  };
+
+ public:
+  using Listener = Function;
+  using ID = Wrap<typename Listeners::const_iterator>;
+
+  // Add listener to the callback.
+  //
+  // Returns the identifier of the new listener. This ID can be used to remove
+  // the listener from this callback.
+  auto AddListener(Listener listener, const CoalescingPolicy policy) -> ID {
+    std::unique_lock flush_lock(flush_mutex_);
+    std::unique_lock lock(mutex_);
+
+    listeners_.emplace_back(std::move(listener), policy);
+    return {std::prev(listeners_.end())};
+  }
+
+  // Remove listener with the given ID.
+  // Invalidates the id. Calling with an invalid ID is undefined.
+  void RemoveListener(const ID id) {
+    std::unique_lock flush_lock(flush_mutex_);
+    std::unique_lock lock(mutex_);
+
+    listeners_.erase(id.Get());
+  }
+
+  // Remove all listeners.
+  void RemoveAllListeners() {
+    std::unique_lock flush_lock(flush_mutex_);
+    std::unique_lock lock(mutex_);
+
+    listeners_.clear();
+  }
+
+  // Fire the event.
+  //
+  // The event is recorded for every listener according to its policy, and is
+  // delivered by the following Flush().
+  void operator()(const Event& event) {
+    std::unique_lock lock(mutex_);
+
+    for (ListenerEntry& listener : listeners_) {
+      if (listener.policy.GetKind() != CoalescingPolicy::Kind::kBatch) {
+        listener.pending[0] = event;
+        listener.num_pending = 1;
+        continue;
+      }
+
+      if (listener.num_pending == listener.batch_size) {
+        // Discard the oldest event.
+        listener.pending[listener.pending_begin] = event;
+        listener.pending_begin =
+            (listener.pending_begin + 1) % listener.batch_size;
+        continue;
+      }
+
+      const std::size_t index =
+          (listener.pending_begin + listener.num_pending) % listener.batch_size;
+      listener.pending[index] = event;
+      ++listener.num_pending;
+    }
+  }
+
+  // Deliver the coalesced events to the listeners.
+  //
+  // Listeners which have no events fired since the previous delivery, and the
+  // throttled listeners for which the window since the previous delivery has
+  // not passed yet are not invoked.
+  void Flush() {
+    std::unique_lock flush_lock(flush_mutex_);
+
+    const typename Clock::time_point now = Clock::now();
+
+    for (ListenerEntry& listener : listeners_) {
+      if (listener.policy.GetKind() == CoalescingPolicy::Kind::kThrottle &&
+          listener.has_delivered &&
+          now - listener.last_delivery_time < listener.policy.GetWindow()) {
+        continue;
+      }
+
+      const std::size_t num_events = TakePendingEvents(listener);
+      if (num_events == 0) {
+        continue;
+      }
+
+      listener.last_delivery_time = now;
+      listener.has_delivered = true;
+
+      listener.function(
+          std::span<const Event>(listener.delivering.data(), num_events));
+    }
+  }
+
+ private:
+  // Move the pending events of the listener to its delivering array, in the
+  // order they were fired.
+  // Returns the number of the events.
+  auto TakePendingEvents(ListenerEntry& listener) -> std::size_t {
+    std::unique_lock lock(mutex_);
+
+    const std::size_t num_events = listener.num_pending;
+    for (std::size_t i = 0; i < num_events; ++i) {
+      listener.delivering[i] = std::move(
+          listener.pending[(listener.pending_begin + i) % listener.batch_size]);
+    }
+
+    listener.pending_begin = 0;
+    listener.num_pending = 0;
+
+    return num_events;
+  }
+
+  // Protects the pending events.
+  std::mutex mutex_;
+
+  // Serializes the delivery with the changes of the listeners.
+  std::mutex flush_mutex_;
+
+  // Storage of registered listeners.
+  Listeners listeners_;
+};
+
+}  // namespace TL_COALESCING_CALLBACK_VERSION_NAMESPACE
+}  // namespace TL_COALESCING_CALLBACK_NAMESPACE
+
+#undef TL_COALESCING_CALLBACK_VERSION_MAJOR
+#undef TL_COALESCING_CALLBACK_VERSION_MINOR
+#undef TL_COALESCING_CALLBACK_VERSION_REVISION
+
+#undef TL_COALESCING_CALLBACK_NAMESPACE
+
+#undef TL_COALESCING_CALLBACK_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_COALESCING_CALLBACK_VERSION_NAMESPACE_CONCAT
+#undef TL_COALESCING_CALLBACK_VERSION_NAMESPACE
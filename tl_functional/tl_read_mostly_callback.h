@@ -0,0 +1,348 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A callback with attachable listeners optimized for frequent invocation.
+//
+// NOTE: Experimental functionality. The API might get changed, or even removed
+//       if the library turns out not to be very reusable.
+//
+// ReadMostlyCallback has the same API as the Callback from tl_callback.h, but
+// it is designed for callbacks which are invoked much more often than their
+// listeners are changed:
+//
+//   - The invocation does not take any lock. It is wait-free, and invocations
+//     from multiple threads run in parallel.
+//
+//   - A slow listener does not block adding or removing listeners from other
+//     threads for the duration of its invocation.
+//
+// The listeners are stored in an immutable snapshot which is published via an
+// atomic pointer. An invocation calls the listeners of the snapshot which was
+// current when the invocation started. Adding or removing a listener copies the
+// snapshot, applies the change to the copy, and publishes the copy.
+//
+// Reclamation
+// ===========
+//
+// The old snapshot is freed once no invocation can be using it. Invocations
+// register themselves in one of two reader counters selected by the current
+// epoch. An invocation which starts after the new snapshot is published never
+// sees the old snapshot, so the old snapshot is only used by the invocations
+// which have registered prior to the change. Once each of the reader counters
+// has been observed as zero after the change, none of such invocations is in
+// progress anymore.
+//
+// A change of listeners never waits for the invocations. It retires the old
+// snapshot, flips the epoch so that the counter of the previous epoch can
+// drain, and frees the retired snapshots for which both counters have been
+// observed as zero. The snapshots which are still in use are freed by one of
+// the following changes of listeners, or when the callback is destroyed.
+//
+// This allows listeners to add and remove listeners of the callback which is
+// invoking them, and to do so while other threads change listeners too.
+//
+//
+// Limitations
+// ===========
+//
+//  - Uses std::function for function pointer and capture. The behavior is
+//    STL implementation specific, might require allocations.
+//
+//  - Every change of listeners allocates a new snapshot and copies all the
+//    listeners.
+//
+//  - A snapshot which is replaced while invocations are in progress is kept
+//    in memory until a later change of listeners, or until the callback is
+//    destroyed.
+//
+//  - All invocations update the same reader counter, so the cache line of the
+//    counter is shared between the cores which invoke the callback.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (19 Oct 2026)    First public release.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Semantic version of the tl_read_mostly_callback library.
+#define TL_READ_MOSTLY_CALLBACK_VERSION_MAJOR 0
+#define TL_READ_MOSTLY_CALLBACK_VERSION_MINOR 0
+#define TL_READ_MOSTLY_CALLBACK_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_READ_MOSTLY_CALLBACK_NAMESPACE
+#  define TL_READ_MOSTLY_CALLBACK_NAMESPACE tiny_lib::read_mostly_callback
+#endif
+
+// Helpers for TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3) \
+  v_##id1##_##id2##_##id3
+#define TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE_CONCAT(id1, id2, id3)        \
+  TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE -> v_0_1_9
+#define TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE                              \
+  TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE_CONCAT(                            \
+      TL_READ_MOSTLY_CALLBACK_VERSION_MAJOR,                                   \
+      TL_READ_MOSTLY_CALLBACK_VERSION_MINOR,                                   \
+      TL_READ_MOSTLY_CALLBACK_VERSION_REVISION)
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_READ_MOSTLY_CALLBACK_NAMESPACE {
+inline namespace TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE {
+
+template <class>
+class ReadMostlyCallback;
+
+template <class R, class... Args>
+class ReadMostlyCallback<R(Args...)> {
+  // Internal function type representing listener of this callback.
+  using Function = std::function<R(Args...)>;
+
+  // Registered listener with its identifier.
+  struct Entry {
+    uint64_t id;
+    Function function;
+  };
+
+  // Immutable list of listeners in their order of registration.
+  using Snapshot = std::vector<Entry>;
+
+  // Helper class to wrap implementation details of the ID.
+  template <class T>
+  struct Wrap {
+   public:
+    Wrap() = default;
+
+   private:
+    friend class ReadMostlyCallback;
+
+    Wrap(const T& value) : value_(value) {}
+
+    constexpr auto Get() const -> const T& { return value_; }
+
+    T value_{};
+  };
+
+ public:
+  using Listener = Function;
+  using ID = Wrap<uint64_t>;
+
+  ReadMostlyCallback() = default;
+
+  ReadMostlyCallback(const ReadMostlyCallback& other) = delete;
+  ReadMostlyCallback(ReadMostlyCallback&& other) noexcept = delete;
+
+  auto operator=(const ReadMostlyCallback& other)
+      -> ReadMostlyCallback& = delete;
+  auto operator=(ReadMostlyCallback&& other) -> ReadMostlyCallback& = delete;
+
+  // The callback is not to be invoked while it is being destroyed.
+  ~ReadMostlyCallback() {
+    delete snapshot_.load();
+    FreeRetiredSnapshots();
+  }
+
+  // Add listener to the callback.
+  //
+  // Returns the identifier of the new listener. This ID can be used to remove
+  // the listener from this callback.
+  auto AddListener(Listener listener) -> ID {
+    std::unique_lock lock(mutex_);
+
+    const uint64_t id = ++last_id_;
+
+    auto new_snapshot = std::make_unique<Snapshot>();
+    if (const Snapshot* snapshot = snapshot_.load()) {
+      new_snapshot->reserve(snapshot->size() + 1);
+      *new_snapshot = *snapshot;
+    }
+    new_snapshot->push_back({id, std::move(listener)});
+
+    Publish(std::move(new_snapshot));
+
+    return {id};
+  }
+
+  // Remove listener with the given ID.
+  // Invalidates the id. Calling with an invalid ID is undefined.
+  void RemoveListener(const ID id) {
+    std::unique_lock lock(mutex_);
+
+    const Snapshot* snapshot = snapshot_.load();
+    if (!snapshot) {
+      return;
+    }
+
+    auto new_snapshot = std::make_unique<Snapshot>();
+    new_snapshot->reserve(snapshot->size());
+    for (const Entry& entry : *snapshot) {
+      if (entry.id != id.Get()) {
+        new_snapshot->push_back(entry);
+      }
+    }
+
+    if (new_snapshot->empty()) {
+      new_snapshot.reset();
+    }
+
+    Publish(std::move(new_snapshot));
+  }
+
+  // Remove all listeners.
+  void RemoveAllListeners() {
+    std::unique_lock lock(mutex_);
+
+    Publish(nullptr);
+  }
+
+  // Execute the callback.
+  //
+  // Will invoke all listeners which are registered at the moment of the call
+  // with the forwarded arguments. The return value of the listeners is ignored.
+  //
+  // The listeners are invoked in their order of registration.
+  void operator()(Args... args) const {
+    const ReadGuard guard(*this);
+
+    const Snapshot* snapshot = snapshot_.load();
+    if (!snapshot) {
+      return;
+    }
+
+    for (const Entry& entry : *snapshot) {
+      std::invoke(entry.function, std::forward<Args>(args)...);
+    }
+  }
+
+ private:
+  // Registers an invocation in the reader counter of the current epoch for
+  // the lifetime of the guard.
+  class ReadGuard {
+   public:
+    explicit ReadGuard(const ReadMostlyCallback& callback)
+        : counter_(callback.readers_[callback.epoch_.load()].count) {
+      counter_.fetch_add(1);
+    }
+
+    ReadGuard(const ReadGuard& other) = delete;
+    ReadGuard(ReadGuard&& other) noexcept = delete;
+
+    ~ReadGuard() { counter_.fetch_sub(1); }
+
+    auto operator=(const ReadGuard& other) -> ReadGuard& = delete;
+    auto operator=(ReadGuard&& other) -> ReadGuard& = delete;
+
+   private:
+    std::atomic<uint32_t>& counter_;
+  };
+
+  // Publish the new snapshot, and free the retired snapshots which can no
+  // longer be used by invocations.
+  //
+  // Is to be called with the mutex locked. Never waits for the invocations.
+  void Publish(std::unique_ptr<Snapshot> new_snapshot) {
+    // Reserve prior to publishing, so that the old snapshot does not leak if
+    // the list of retired snapshots fails to grow.
+    retired_.reserve(retired_.size() + 1);
+    if (const Snapshot* old_snapshot =
+            snapshot_.exchange(new_snapshot.release())) {
+      retired_.push_back({old_snapshot, kAllReaderCounters});
+    }
+
+    // New invocations register in the other counter, so that the counter of
+    // the previous epoch drains even if the callback is invoked continuously.
+    epoch_.store(1 - epoch_.load());
+
+    FreeDrainedSnapshots();
+  }
+
+  // Free the retired snapshots for which all reader counters have been
+  // observed as zero since the snapshot was retired.
+  void FreeDrainedSnapshots() {
+    uint32_t drained_counters = 0;
+    for (uint32_t i = 0; i < 2; ++i) {
+      if (readers_[i].count.load() == 0) {
+        drained_counters |= (1u << i);
+      }
+    }
+
+    std::erase_if(retired_, [&](RetiredSnapshot& retired) {
+      retired.pending_counters &= ~drained_counters;
+      if (retired.pending_counters != 0) {
+        return false;
+      }
+      delete retired.snapshot;
+      return true;
+    });
+  }
+
+  void FreeRetiredSnapshots() {
+    for (const RetiredSnapshot& retired : retired_) {
+      delete retired.snapshot;
+    }
+    retired_.clear();
+  }
+
+  // Counter of the invocations which are in progress, on its own cache line.
+  struct alignas(64) ReaderCounter {
+    std::atomic<uint32_t> count{0};
+  };
+
+  // Snapshot which is replaced but might still be used by invocations.
+  struct RetiredSnapshot {
+    const Snapshot* snapshot;
+
+    // Bitmask of the reader counters which have not been observed as zero
+    // since the snapshot was retired.
+    uint32_t pending_counters;
+  };
+
+  static constexpr uint32_t kAllReaderCounters = 0b11;
+
+  // Current list of listeners, nullptr when there are no listeners.
+  std::atomic<const Snapshot*> snapshot_{nullptr};
+
+  // Index of the reader counter which new invocations register in.
+  std::atomic<uint32_t> epoch_{0};
+
+  mutable ReaderCounter readers_[2];
+
+  // Serializes changes of listeners.
+  std::mutex mutex_;
+
+  // Snapshots which are replaced but might still be used by invocations.
+  std::vector<RetiredSnapshot> retired_;
+
+  uint64_t last_id_{0};
+};
+
+}  // namespace TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE
+}  // namespace TL_READ_MOSTLY_CALLBACK_NAMESPACE
+
+#undef TL_READ_MOSTLY_CALLBACK_VERSION_MAJOR
+#undef TL_READ_MOSTLY_CALLBACK_VERSION_MINOR
+#undef TL_READ_MOSTLY_CALLBACK_VERSION_REVISION
+
+#undef TL_READ_MOSTLY_CALLBACK_NAMESPACE
+
+#undef TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE_CONCAT
+#undef TL_READ_MOSTLY_CALLBACK_VERSION_NAMESPACE
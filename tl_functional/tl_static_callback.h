@@ -0,0 +1,391 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A callback with attachable listeners which does not allocate memory.
+//
+// NOTE: Experimental functionality. The API might get changed, or even removed
+//       if the library turns out not to be very reusable.
+//
+// StaticCallback follows the API of the Callback from tl_callback.h, but keeps
+// all its state in-object:
+//
+//   - The listeners are stored in a StaticFunction, which keeps the callable
+//     object in an in-object buffer of InlineBytes bytes. There is no fallback
+//     to the heap: a callable which does not fit into the buffer fails the
+//     compilation.
+//
+//   - The listeners are stored in a contiguous array of MaxListeners elements,
+//     which is walked when the callback is invoked.
+//
+//   - The ID of a listener is an index in a table of handles paired with the
+//     generation of the handle. Removing a listener increments the generation,
+//     so that an ID of a removed listener is detected as stale, even when its
+//     handle is reused by a new listener.
+//
+//   using ButtonCallback = StaticCallback<void(int), 4>;
+//
+//   ButtonCallback on_press;
+//   const ButtonCallback::ID id =
+//       on_press.AddListener([&](int button) { ++num_presses[button]; });
+//   on_press(1);
+//   on_press.RemoveListener(id);
+//
+// StaticFunction is also usable on its own as an allocation-free replacement of
+// the std::function. Unlike the std::function it is move-only, which allows it
+// to store callables which are not copyable.
+//
+// Thread safety
+// =============
+//
+// StaticCallback is not thread-safe, as mutexes might be unavailable on the
+// microcontrollers. Listeners are not to be added or removed from within an
+// invocation of the callback.
+//
+//
+// Exceptions
+// ==========
+//
+// General notes on exceptions:
+//
+//  - If an exception is thrown for any reason, functions have no effect
+//    (strong exception guarantee).
+//
+//  - If a listener is added to a callback which has MaxListeners listeners an
+//    std::length_error exception is thrown.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (19 Oct 2026)    First public release.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "tl_container/tl_static_vector.h"
+
+// Semantic version of the tl_static_callback library.
+#define TL_STATIC_CALLBACK_VERSION_MAJOR 0
+#define TL_STATIC_CALLBACK_VERSION_MINOR 0
+#define TL_STATIC_CALLBACK_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_CALLBACK_NAMESPACE
+#  define TL_STATIC_CALLBACK_NAMESPACE tiny_lib::static_callback
+#endif
+
+// Namespace in which the StaticVector is defined.
+// Is to be defined when the tl_static_vector library is configured to use a
+// non-default namespace.
+#ifndef TL_STATIC_CALLBACK_STATIC_VECTOR_NAMESPACE
+#  define TL_STATIC_CALLBACK_STATIC_VECTOR_NAMESPACE tiny_lib::static_vector
+#endif
+
+// Helpers for TL_STATIC_CALLBACK_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_CALLBACK_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)      \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_CALLBACK_VERSION_NAMESPACE_CONCAT(id1, id2, id3)             \
+  TL_STATIC_CALLBACK_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_CALLBACK_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_CALLBACK_VERSION_NAMESPACE                                   \
+  TL_STATIC_CALLBACK_VERSION_NAMESPACE_CONCAT(                                 \
+      TL_STATIC_CALLBACK_VERSION_MAJOR,                                        \
+      TL_STATIC_CALLBACK_VERSION_MINOR,                                        \
+      TL_STATIC_CALLBACK_VERSION_REVISION)
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_CALLBACK_NAMESPACE {
+inline namespace TL_STATIC_CALLBACK_VERSION_NAMESPACE {
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticFunction.
+
+template <class Signature, std::size_t InlineBytes>
+class StaticFunction;
+
+template <class R, class... Args, std::size_t InlineBytes>
+class StaticFunction<R(Args...), InlineBytes> {
+ public:
+  // Number of bytes available for the callable object.
+  static constexpr std::size_t kInlineBytes = InlineBytes;
+
+  // Construct an empty function.
+  StaticFunction() = default;
+
+  // Construct function which stores the given callable object.
+  //
+  // The callable is to fit into kInlineBytes, and its alignment is not to be
+  // stricter than the alignment of the std::max_align_t.
+  template <class F>
+    requires(!std::is_same_v<std::remove_cvref_t<F>, StaticFunction> &&
+             std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+  // NOLINTNEXTLINE(bugprone-forwarding-reference-overload)
+  StaticFunction(F&& f) {
+    using Callable = std::decay_t<F>;
+
+    static_assert(sizeof(Callable) <= kInlineBytes,
+                  "Callable does not fit into the inline storage");
+    static_assert(alignof(Callable) <= alignof(std::max_align_t),
+                  "Callable alignment is not supported");
+    static_assert(std::is_nothrow_move_constructible_v<Callable>,
+                  "Callable is to be nothrow move constructible");
+
+    new (storage_) Callable(std::forward<F>(f));
+    ops_ = &kOps<Callable>;
+  }
+
+  StaticFunction(StaticFunction&& other) noexcept { MoveFrom(other); }
+
+  auto operator=(StaticFunction&& other) noexcept -> StaticFunction& {
+    if (this != &other) {
+      Reset();
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  // Copying would require the callable to be copyable, which is not required
+  // from the callables stored in the function.
+  StaticFunction(const StaticFunction& other) = delete;
+  auto operator=(const StaticFunction& other) -> StaticFunction& = delete;
+
+  ~StaticFunction() { Reset(); }
+
+  // Returns true if the function stores a callable object.
+  explicit operator bool() const { return ops_ != nullptr; }
+
+  // Invoke the stored callable object with the given arguments.
+  // Invoking an empty function is undefined.
+  auto operator()(Args... args) const -> R {
+    return ops_->invoke(storage_, std::forward<Args>(args)...);
+  }
+
+ private:
+  // Type-erased operations on the stored callable object.
+  struct Ops {
+    R (*invoke)(void* storage, Args&&... args);
+    void (*move)(void* dst, void* src);
+    void (*destroy)(void* storage);
+  };
+
+  template <class Callable>
+  static constexpr Ops kOps = {
+      [](void* storage, Args&&... args) -> R {
+        if constexpr (std::is_void_v<R>) {
+          std::invoke(*static_cast<Callable*>(storage),
+                      std::forward<Args>(args)...);
+        } else {
+          return std::invoke(*static_cast<Callable*>(storage),
+                             std::forward<Args>(args)...);
+        }
+      },
+      [](void* dst, void* src) {
+        new (dst) Callable(std::move(*static_cast<Callable*>(src)));
+      },
+      [](void* storage) { static_cast<Callable*>(storage)->~Callable(); },
+  };
+
+  void MoveFrom(StaticFunction& other) {
+    if (other.ops_) {
+      other.ops_->move(storage_, other.storage_);
+      ops_ = other.ops_;
+      other.Reset();
+    }
+  }
+
+  void Reset() {
+    if (ops_) {
+      ops_->destroy(storage_);
+      ops_ = nullptr;
+    }
+  }
+
+  // The callable is invoked as non-const, matching the std::function.
+  alignas(std::max_align_t) mutable std::byte storage_[kInlineBytes];
+
+  const Ops* ops_{nullptr};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// StaticCallback.
+
+template <class Signature,
+          std::size_t MaxListeners,
+          std::size_t InlineBytes = 4 * sizeof(void*)>
+class StaticCallback;
+
+template <class R,
+          class... Args,
+          std::size_t MaxListeners,
+          std::size_t InlineBytes>
+class StaticCallback<R(Args...), MaxListeners, InlineBytes> {
+  static_assert(MaxListeners > 0, "Callback needs at least one listener");
+
+  // Marker of a handle which is not used by any listener.
+  static constexpr uint32_t kFreeHandle = uint32_t(-1);
+
+  // Handle of a listener: position of the listener in the array of listeners
+  // and the generation which is incremented every time the handle is freed.
+  struct Handle {
+    uint32_t position{kFreeHandle};
+    uint32_t generation{0};
+  };
+
+ public:
+  using Listener = StaticFunction<R(Args...), InlineBytes>;
+
+  // Identifier of a listener.
+  class ID {
+   public:
+    ID() = default;
+
+    auto operator==(const ID& other) const -> bool = default;
+
+   private:
+    friend class StaticCallback;
+
+    ID(const uint32_t handle_index, const uint32_t generation)
+        : handle_index_(handle_index), generation_(generation) {}
+
+    uint32_t handle_index_{kFreeHandle};
+    uint32_t generation_{0};
+  };
+
+  StaticCallback() = default;
+
+  // The IDs refer to the handles of this callback, and can not be transferred
+  // to another callback.
+  StaticCallback(const StaticCallback& other) = delete;
+  StaticCallback(StaticCallback&& other) noexcept = delete;
+
+  auto operator=(const StaticCallback& other) -> StaticCallback& = delete;
+  auto operator=(StaticCallback&& other) -> StaticCallback& = delete;
+
+  ~StaticCallback() = default;
+
+  // Add listener to the callback.
+  //
+  // The listener is any callable object which fits into the InlineBytes.
+  //
+  // Returns the identifier of the new listener. This ID can be used to remove
+  // the listener from this callback.
+  template <class F>
+  auto AddListener(F&& listener) -> ID {
+    // There is a free handle unless the callback is full, in which case the
+    // emplace_back() throws.
+    uint32_t handle_index = 0;
+    while (handle_index < MaxListeners &&
+           handles_[handle_index].position != kFreeHandle) {
+      ++handle_index;
+    }
+
+    listeners_.emplace_back(handle_index, std::forward<F>(listener));
+
+    Handle& handle = handles_[handle_index];
+    handle.position = uint32_t(listeners_.size() - 1);
+    return {handle_index, handle.generation};
+  }
+
+  // Remove listener with the given ID.
+  //
+  // Returns false if the ID does not refer to a listener of this callback,
+  // for example if the listener has already been removed.
+  auto RemoveListener(const ID id) -> bool {
+    if (id.handle_index_ >= MaxListeners) {
+      return false;
+    }
+
+    Handle& handle = handles_[id.handle_index_];
+    if (handle.position == kFreeHandle || handle.generation != id.generation_) {
+      return false;
+    }
+
+    const uint32_t position = handle.position;
+    listeners_.erase(listeners_.begin() + position);
+    FreeHandle(handle);
+
+    // Update positions of the listeners which were shifted by the erase.
+    for (uint32_t i = position; i < listeners_.size(); ++i) {
+      handles_[listeners_[i].handle_index].position = i;
+    }
+
+    return true;
+  }
+
+  // Remove all listeners.
+  void RemoveAllListeners() {
+    for (const Entry& entry : listeners_) {
+      FreeHandle(handles_[entry.handle_index]);
+    }
+    listeners_.clear();
+  }
+
+  // Get the number of registered listeners.
+  auto GetNumListeners() const -> std::size_t { return listeners_.size(); }
+
+  // Execute the callback.
+  //
+  // Will invoke all currently registered listeners with the forwarded
+  // arguments. The return value of the listeners is ignored.
+  //
+  // The listeners are invoked in their order of registration.
+  void operator()(Args... args) const {
+    for (const Entry& entry : listeners_) {
+      entry.function(std::forward<Args>(args)...);
+    }
+  }
+
+ private:
+  struct Entry {
+    template <class F>
+    Entry(const uint32_t index, F&& f)
+        : handle_index(index), function(std::forward<F>(f)) {}
+
+    uint32_t handle_index;
+    Listener function;
+  };
+
+  static void FreeHandle(Handle& handle) {
+    handle.position = kFreeHandle;
+    ++handle.generation;
+  }
+
+  // Listeners in their order of registration.
+  TL_STATIC_CALLBACK_STATIC_VECTOR_NAMESPACE::StaticVector<Entry, MaxListeners>
+      listeners_;
+
+  std::array<Handle, MaxListeners> handles_;
+};
+
+}  // namespace TL_STATIC_CALLBACK_VERSION_NAMESPACE
+}  // namespace TL_STATIC_CALLBACK_NAMESPACE
+
+#undef TL_STATIC_CALLBACK_VERSION_MAJOR
+#undef TL_STATIC_CALLBACK_VERSION_MINOR
+#undef TL_STATIC_CALLBACK_VERSION_REVISION
+
+#undef TL_STATIC_CALLBACK_NAMESPACE
+#undef TL_STATIC_CALLBACK_STATIC_VECTOR_NAMESPACE
+
+#undef TL_STATIC_CALLBACK_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_CALLBACK_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_CALLBACK_VERSION_NAMESPACE
@@ -5,7 +5,10 @@
 #include "tl_io/tl_io_file.h"
 
 #include <array>
+#include <cstddef>
+#include <memory_resource>
 #include <span>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -13,6 +16,7 @@
 
 #include "tiny_lib/unittest/mock.h"
 #include "tiny_lib/unittest/test.h"
+#include "tl_memory/tl_monotonic_arena.h"
 
 DECLARE_string(test_srcdir);
 
@@ -50,6 +54,38 @@ TEST(tl_io_file, Open) {
   }
 }
 
+TEST(tl_io_file, OpenUTF8) {
+  const std::string dir = Path{FLAGS_test_srcdir}.string() + "/";
+
+  {
+    File file;
+    EXPECT_TRUE(file.OpenUTF8(dir + std::string(kASCIIFileName), File::kRead));
+    EXPECT_EQ(file.Size(), 33);
+  }
+
+  {
+    File file;
+    EXPECT_TRUE(
+        file.OpenUTF8(dir + std::string(kUnicodeFileName), File::kRead));
+  }
+
+  // Name which does not fit into the stack buffer.
+  {
+    File file;
+    EXPECT_TRUE(file.OpenUTF8(
+        dir + std::string(2000, '/') + std::string(kUnicodeFileName),
+        File::kRead));
+  }
+
+  {
+    File file;
+    EXPECT_FALSE(file.OpenUTF8(dir + "file\xff.txt", File::kRead));
+    EXPECT_FALSE(file.OpenUTF8(dir + std::string("file.txt\0", 9),
+                               File::kRead));
+    EXPECT_FALSE(file.OpenUTF8(dir + "non-existing.txt", File::kRead));
+  }
+}
+
 TEST(tl_io_file, Size) {
   File file;
 
@@ -94,6 +130,30 @@ TEST(tl_io_file, Write) {
   EXPECT_TRUE(std::filesystem::remove(filename));
 }
 
+TEST(tl_io_file, WriteV) {
+  const Path filename = Path(FLAGS_test_srcdir) / "temp.txt";
+
+  {
+    const std::array<std::string_view, 3> buffers = {"Hello", ", ", "World!"};
+
+    File file;
+    EXPECT_TRUE(file.Open(filename, File::kWrite | File::kCreateAlways));
+    EXPECT_EQ(file.WriteV(buffers), 13);
+
+    const std::array<std::span<const char>, 0> no_buffers;
+    EXPECT_EQ(file.WriteV(no_buffers), 0);
+  }
+
+  {
+    std::string text;
+
+    EXPECT_TRUE(File::ReadText(filename, text));
+    EXPECT_EQ(text, "Hello, World!");
+  }
+
+  EXPECT_TRUE(std::filesystem::remove(filename));
+}
+
 TEST(tl_io_file, IsEOR) {
   File file;
 
@@ -128,6 +188,21 @@ TEST(tl_io_file, ReadBytes) {
             "ASCII: Lorem ipsum dolor sit amet");
 }
 
+TEST(tl_io_file, ReadBytesArena) {
+  using monotonic_arena::ArenaResource;
+  using monotonic_arena::StaticMonotonicArena;
+
+  // The buffer is allocated from the arena, without any upstream allocations.
+  StaticMonotonicArena<256> arena;
+  ArenaResource resource(arena);
+
+  std::pmr::vector<char> bytes(&resource);
+
+  EXPECT_TRUE(File::ReadBytes(Path{FLAGS_test_srcdir} / kASCIIFileName, bytes));
+  EXPECT_EQ(std::string(bytes.data(), bytes.size()),
+            "ASCII: Lorem ipsum dolor sit amet");
+}
+
 TEST(tl_io_file, WriteText) {
   const Path filename = Path(FLAGS_test_srcdir) / "temp.txt";
 
@@ -6,6 +6,7 @@
 //
 //   - RAII style file descriptor management.
 //   - Cross-platform support of access to non-ASCII file names.
+//   - Opening files by UTF-8 names without going through std::filesystem.
 //   - Cross-platform access to files which are bigger than 4 GiB.
 //
 // This file implementation can also be used as IO interface for other tiny lib
@@ -29,22 +30,30 @@
 // Version history
 // ===============
 //
+//   0.0.3-alpha    (19 Oct 2026)    Add File::WriteV().
+//   0.0.2-alpha    (18 Oct 2026)    Add File::OpenUTF8().
 //   0.0.1-alpha    (28 Dec 2023)    First public release.
 
 #pragma once
 
 #include <fcntl.h>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <filesystem>
 #include <limits>
 #include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include "tl_string/tl_utf8.h"
 
 // Semantic version of the tl_io_file library.
 #define TL_IO_FILE_VERSION_MAJOR 0
 #define TL_IO_FILE_VERSION_MINOR 0
-#define TL_IO_FILE_VERSION_REVISION 1
+#define TL_IO_FILE_VERSION_REVISION 3
 
 // Namespace of the module.
 // The outer name spaces which surrounds the ABI-version namespace.
@@ -52,6 +61,13 @@
 #  define TL_IO_FILE_NAMESPACE tiny_lib::io_file
 #endif
 
+// Namespace in which the UTF-8 functions are defined.
+// Is to be defined when the tl_utf8 library is configured to use a non-default
+// namespace.
+#ifndef TL_IO_FILE_UTF8_NAMESPACE
+#  define TL_IO_FILE_UTF8_NAMESPACE tiny_lib::utf8
+#endif
+
 // Helpers for TL_IO_FILE_VERSION_NAMESPACE.
 //
 // Typical extra indirection for such conversion to allow macro to be expanded
@@ -166,6 +182,16 @@ class File {
   // Returns true on success.
   inline auto Open(const std::filesystem::path& filename, int flags) -> bool;
 
+  // Open file with the given UTF-8 encoded name for access in the given mode.
+  //
+  // Unlike the Open() with std::filesystem::path the name is converted to the
+  // platform's native encoding directly. Names which fit into a buffer on the
+  // stack are converted without heap allocations.
+  //
+  // Returns false if the filename is not a valid UTF-8, contains a null
+  // character, or if the file can not be opened.
+  inline auto OpenUTF8(std::string_view filename, int flags) -> bool;
+
   // Close the file if it is open.
   //
   // Returns true on success.
@@ -213,6 +239,22 @@ class File {
   // error occurs.
   inline auto Write(const void* ptr, SizeType num_bytes_to_write) -> SizeType;
 
+  // Write the buffers one after another into the file starting from the
+  // current position.
+  //
+  // The buffers are given as a range of contiguous ranges, such as
+  // std::string_view or std::span. For example, the chunks of a
+  // StaticStringBuilder.
+  //
+  // The file is written via a buffered stream, so small buffers are gathered
+  // in the stream buffer rather than being written to the file one by one.
+  //
+  // Returns the total number of bytes actually written. The writing stops at
+  // the first buffer which is not written completely, in which case the
+  // returned number of bytes is lower than the total size of the buffers.
+  template <class BufferRange>
+  auto WriteV(const BufferRange& buffers) -> SizeType;
+
   // Returns true if the file has end-of-file indicator.
   //
   // Note that stream's internal position indicator may point to the end-of-file
@@ -242,6 +284,10 @@ class File {
   // If the file is larger than the buffer.max_size() then false is returned.
   // The buffer is resized to the file size using buffer.resize().
   //
+  // The buffer keeps using its own allocator, so a container with a
+  // polymorphic allocator (i.e. std::pmr::vector) can be used to read the file
+  // into memory of an arena.
+  //
   // NOTE: When the filename is constructed from a string it is expected that
   // std::filesystem::u8path is used. Otherwise non-ASCII paths will not be
   // handled correctly.
@@ -396,6 +442,64 @@ auto File::Open(const std::filesystem::path& filename, const int flags)
   return file_stream_ != nullptr;
 }
 
+auto File::OpenUTF8(const std::string_view filename, const int flags) -> bool {
+  Close();
+
+  if (filename.find('\0') != std::string_view::npos ||
+      !TL_IO_FILE_UTF8_NAMESPACE::IsValidUTF8(filename)) {
+    return false;
+  }
+
+  // Number of characters in the name which is converted on the stack, without
+  // the null-terminator.
+  constexpr size_t kMaxStackFilenameLength = 1023;
+
+#if TL_IO_FILE_COMPILER_MSVC
+  const wchar_t* mode = internal::OpenFlagsToMode(flags);
+
+  wchar_t stack_filename[kMaxStackFilenameLength + 1];
+  std::wstring heap_filename;
+  const wchar_t* native_filename = stack_filename;
+
+  const TL_IO_FILE_UTF8_NAMESPACE::TranscodeResult result =
+      TL_IO_FILE_UTF8_NAMESPACE::ConvertUTF8ToWide(
+          filename, std::span(stack_filename, kMaxStackFilenameLength));
+  if (result.ec == std::errc()) {
+    stack_filename[result.size] = L'\0';
+  } else {
+    if (!TL_IO_FILE_UTF8_NAMESPACE::AssignFromUTF8(heap_filename, filename)) {
+      return false;
+    }
+    native_filename = heap_filename.c_str();
+  }
+
+  const errno_t error = ::_wfopen_s(&file_stream_, native_filename, mode);
+  if (error != 0) {
+    return false;
+  }
+#else
+  const char* mode = internal::OpenFlagsToMode(flags);
+
+  // POSIX file names are sequences of bytes, which are expected to be UTF-8.
+  // The name only needs to be null-terminated.
+  char stack_filename[kMaxStackFilenameLength + 1];
+  std::string heap_filename;
+  const char* native_filename = stack_filename;
+
+  if (filename.size() <= kMaxStackFilenameLength) {
+    filename.copy(stack_filename, filename.size());
+    stack_filename[filename.size()] = '\0';
+  } else {
+    heap_filename = filename;
+    native_filename = heap_filename.c_str();
+  }
+
+  file_stream_ = ::fopen(native_filename, mode);
+#endif
+
+  return file_stream_ != nullptr;
+}
+
 auto File::Close() -> bool {
   if (file_stream_ == nullptr) {
     return true;
@@ -522,6 +626,24 @@ auto File::Write(const void* ptr, const SizeType num_bytes_to_write)
   return num_bytes_written;
 }
 
+template <class BufferRange>
+auto File::WriteV(const BufferRange& buffers) -> SizeType {
+  SizeType num_bytes_written = 0;
+
+  for (const auto& buffer : buffers) {
+    const std::span<const std::byte> bytes = std::as_bytes(std::span(buffer));
+
+    const SizeType num_bytes_written_now = Write(bytes.data(), bytes.size());
+    num_bytes_written += num_bytes_written_now;
+
+    if (num_bytes_written_now != bytes.size()) {
+      break;
+    }
+  }
+
+  return num_bytes_written;
+}
+
 inline auto File::IsEOF() -> bool { return ::feof(file_stream_); }
 
 inline auto File::IsError() -> bool { return ::ferror(file_stream_) != 0; }
@@ -666,6 +788,7 @@ auto File::WriteBytes(const std::filesystem::path& filename,
 #undef TL_IO_FILE_VERSION_REVISION
 
 #undef TL_IO_FILE_NAMESPACE
+#undef TL_IO_FILE_UTF8_NAMESPACE
 
 #undef TL_IO_FILE_VERSION_NAMESPACE_CONCAT_HELPER
 #undef TL_IO_FILE_VERSION_NAMESPACE_CONCAT
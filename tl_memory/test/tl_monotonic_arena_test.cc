@@ -0,0 +1,217 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_memory/tl_monotonic_arena.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "tiny_lib/unittest/mock.h"
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::monotonic_arena {
+
+// Memory resource which counts allocations and deallocations, and forwards them
+// to the new/delete resource.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  int num_allocations{0};
+  int num_deallocations{0};
+  size_t num_allocated_bytes{0};
+
+ private:
+  auto do_allocate(const size_t bytes, const size_t alignment)
+      -> void* override {
+    ++num_allocations;
+    num_allocated_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p,
+                     const size_t bytes,
+                     const size_t alignment) override {
+    ++num_deallocations;
+    num_allocated_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override {
+    return this == &other;
+  }
+};
+
+static auto IsAligned(const void* pointer, const size_t alignment) -> bool {
+  return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+TEST(MonotonicArena, Allocate) {
+  alignas(std::max_align_t) std::byte buffer[64];
+  MonotonicArena arena(buffer);
+
+  EXPECT_EQ(arena.GetNumAvailableBytes(), 64);
+
+  void* a = arena.Allocate(3, 1);
+  EXPECT_EQ(a, buffer);
+
+  void* b = arena.Allocate(8, 8);
+  EXPECT_EQ(b, buffer + 8);
+
+  void* c = arena.Allocate(1, 1);
+  EXPECT_EQ(c, buffer + 16);
+
+  void* d = arena.Allocate(16, 16);
+  EXPECT_EQ(d, buffer + 32);
+  EXPECT_EQ(arena.GetNumAvailableBytes(), 16);
+
+  EXPECT_EQ(arena.TryAllocate(17, 1), nullptr);
+  EXPECT_THROW_OR_ABORT(arena.Allocate(17, 1), std::bad_alloc);
+  EXPECT_THROW_OR_ABORT(arena.Allocate(1, 3), std::invalid_argument);
+
+  // Allocation which fits exactly.
+  EXPECT_EQ(arena.Allocate(16, 1), buffer + 48);
+  EXPECT_EQ(arena.GetNumAvailableBytes(), 0);
+
+  // Allocations of zero size are allowed.
+  EXPECT_NE(arena.TryAllocate(0, 1), nullptr);
+
+  arena.Reset();
+  EXPECT_EQ(arena.Allocate(1, 1), buffer);
+}
+
+TEST(MonotonicArena, New) {
+  StaticMonotonicArena<64> arena;
+
+  struct Point {
+    int x, y;
+  };
+
+  const Point* point = arena.New<Point>(1, 2);
+  EXPECT_TRUE(IsAligned(point, alignof(Point)));
+  EXPECT_EQ(point->x, 1);
+  EXPECT_EQ(point->y, 2);
+
+  const double* value = arena.New<double>(3.5);
+  EXPECT_TRUE(IsAligned(value, alignof(double)));
+  EXPECT_EQ(*value, 3.5);
+}
+
+TEST(MonotonicArena, Upstream) {
+  CountingResource upstream;
+
+  {
+    StaticMonotonicArena<64> arena(&upstream);
+
+    arena.Allocate(64, 1);
+    EXPECT_EQ(upstream.num_allocations, 0);
+
+    // Exhausting the buffer requests a chunk from the upstream, which is used
+    // for the following allocations.
+    arena.Allocate(100, 1);
+    arena.Allocate(100, 1);
+    EXPECT_EQ(upstream.num_allocations, 1);
+
+    // Allocation which is larger than the regular chunk size.
+    arena.Allocate(100000, 1);
+    EXPECT_EQ(upstream.num_allocations, 2);
+
+    // Over-aligned allocation.
+    EXPECT_TRUE(IsAligned(arena.Allocate(1, 256), 256));
+  }
+
+  EXPECT_EQ(upstream.num_deallocations, upstream.num_allocations);
+  EXPECT_EQ(upstream.num_allocated_bytes, 0);
+}
+
+TEST(MonotonicArena, Reset) {
+  CountingResource upstream;
+
+  StaticMonotonicArena<64> arena(&upstream);
+
+  // Simulate a request which needs more memory than the initial buffer.
+  const auto request = [&arena]() {
+    for (int i = 0; i < 100; ++i) {
+      arena.Allocate(100, 1);
+    }
+  };
+
+  request();
+  const int num_first_allocations = upstream.num_allocations;
+  EXPECT_GT(num_first_allocations, 1);
+
+  // The largest chunk is kept, all other chunks are released.
+  arena.Reset();
+  EXPECT_EQ(upstream.num_deallocations, num_first_allocations - 1);
+
+  // The arena warms up after a couple of requests, and the following requests
+  // are served without the upstream.
+  request();
+  arena.Reset();
+  const int num_allocations = upstream.num_allocations;
+  for (int i = 0; i < 10; ++i) {
+    request();
+    arena.Reset();
+  }
+  EXPECT_EQ(upstream.num_allocations, num_allocations);
+
+  arena.Release();
+  EXPECT_EQ(upstream.num_deallocations, num_allocations);
+  EXPECT_EQ(upstream.num_allocated_bytes, 0);
+}
+
+TEST(MonotonicArena, NoBuffer) {
+  CountingResource upstream;
+
+  MonotonicArena arena(&upstream);
+  EXPECT_EQ(arena.GetUpstream(), &upstream);
+
+  EXPECT_NE(arena.Allocate(10), nullptr);
+  EXPECT_EQ(upstream.num_allocations, 1);
+
+  arena.Reset();
+  EXPECT_NE(arena.Allocate(10), nullptr);
+  EXPECT_EQ(upstream.num_allocations, 1);
+}
+
+TEST(ArenaResource, Containers) {
+  CountingResource upstream;
+
+  StaticMonotonicArena<4096> arena(&upstream);
+  ArenaResource resource(arena);
+
+  {
+    std::pmr::vector<int> vector(&resource);
+    for (int i = 0; i < 100; ++i) {
+      vector.push_back(i);
+    }
+    EXPECT_EQ(vector.size(), 100);
+    EXPECT_EQ(vector[99], 99);
+
+    std::pmr::string string("a string which does not fit into SSO", &resource);
+    EXPECT_EQ(string, "a string which does not fit into SSO");
+  }
+
+  EXPECT_EQ(upstream.num_allocations, 0);
+}
+
+TEST(ArenaResource, Compare) {
+  StaticMonotonicArena<64> arena;
+  StaticMonotonicArena<64> other_arena;
+
+  ArenaResource resource(arena);
+  ArenaResource same_arena_resource(arena);
+  ArenaResource other_arena_resource(other_arena);
+
+  EXPECT_TRUE(resource.is_equal(resource));
+  EXPECT_TRUE(resource.is_equal(same_arena_resource));
+  EXPECT_FALSE(resource.is_equal(other_arena_resource));
+  EXPECT_FALSE(resource.is_equal(*std::pmr::new_delete_resource()));
+
+  EXPECT_EQ(&resource.GetArena(), &arena);
+}
+
+}  // namespace tiny_lib::monotonic_arena
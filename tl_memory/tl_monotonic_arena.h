@@ -0,0 +1,456 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A monotonic (bump) allocator over a fixed buffer with an optional upstream.
+//
+// MonotonicArena hands out memory by advancing a pointer within the current
+// region, and never frees individual allocations. All the memory is reclaimed
+// at once with Reset(), which makes it a good fit for per-request or per-frame
+// work: all temporary allocations of a request are bump allocations, followed
+// by a single reset.
+//
+//   std::byte buffer[4096];
+//   MonotonicArena arena(buffer, std::pmr::new_delete_resource());
+//
+//   for (const Request& request : requests) {
+//     ArenaResource resource(arena);
+//     std::pmr::vector<char> bytes(&resource);
+//     File::ReadBytes(request.filename, bytes);
+//     ...
+//     arena.Reset();
+//   }
+//
+// StaticMonotonicArena<N> is a MonotonicArena which keeps its initial buffer of
+// N bytes in-object.
+//
+// Upstream
+// ========
+//
+// When the initial buffer is exhausted the arena requests chunks from the
+// upstream memory resource. The size of the chunks grows geometrically. If no
+// upstream is provided the allocation fails once the initial buffer is
+// exhausted.
+//
+// Reset() releases all upstream chunks except for the largest one, which is
+// reused for the allocations which follow the reset. If more than one chunk
+// was used the next chunk is sized to fit all of them. This allows the arena to
+// warm up to the peak memory usage of a request within a couple of resets,
+// after which there are no calls to the upstream. Release() returns all
+// upstream chunks.
+//
+// Polymorphic allocators
+// ======================
+//
+// ArenaResource is an adapter which implements std::pmr::memory_resource on top
+// of an arena, which allows to use the arena with any allocator-aware container
+// via std::pmr::polymorphic_allocator. The deallocation is a no-op, the memory
+// is reclaimed when the arena is reset.
+//
+// Thread safety
+// =============
+//
+// MonotonicArena is not thread-safe.
+//
+//
+// Exceptions
+// ==========
+//
+// General notes on exceptions:
+//
+//  - If an exception is thrown for any reason, functions have effect (strong
+//    exception guarantee).
+//
+//  - If the memory can not be allocated from neither the arena nor the upstream
+//    an std::bad_alloc exception is thrown.
+//
+//  - If the requested alignment is not a power of two an std::invalid_argument
+//    exception is thrown.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Semantic version of the tl_monotonic_arena library.
+#define TL_MONOTONIC_ARENA_VERSION_MAJOR 0
+#define TL_MONOTONIC_ARENA_VERSION_MINOR 0
+#define TL_MONOTONIC_ARENA_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_MONOTONIC_ARENA_NAMESPACE
+#  define TL_MONOTONIC_ARENA_NAMESPACE tiny_lib::monotonic_arena
+#endif
+
+// Helpers for TL_MONOTONIC_ARENA_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_MONOTONIC_ARENA_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)      \
+  v_##id1##_##id2##_##id3
+#define TL_MONOTONIC_ARENA_VERSION_NAMESPACE_CONCAT(id1, id2, id3)             \
+  TL_MONOTONIC_ARENA_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_MONOTONIC_ARENA_VERSION_NAMESPACE -> v_0_1_9
+#define TL_MONOTONIC_ARENA_VERSION_NAMESPACE                                   \
+  TL_MONOTONIC_ARENA_VERSION_NAMESPACE_CONCAT(                                 \
+      TL_MONOTONIC_ARENA_VERSION_MAJOR,                                        \
+      TL_MONOTONIC_ARENA_VERSION_MINOR,                                        \
+      TL_MONOTONIC_ARENA_VERSION_REVISION)
+
+// Throw an exception of the given type ExceptionType if the expression is
+// evaluated to a truthful value.
+// The default implementation throws an ExceptionType(#expression) if the
+// condition is met, or ExceptionType() if the exception type can not be
+// constructed from a string.
+// If the default behavior is not suitable for the application it should define
+// TL_MONOTONIC_ARENA_THROW_IF prior to including this header. The provided
+// implementation is not to return, otherwise an undefined behavior of memory
+// corruption will happen.
+#if !defined(TL_MONOTONIC_ARENA_THROW_IF)
+#  define TL_MONOTONIC_ARENA_THROW_IF(ExceptionType, expression)               \
+    internal::ThrowIfOrAbort<ExceptionType>(expression, #expression)
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_MONOTONIC_ARENA_NAMESPACE {
+inline namespace TL_MONOTONIC_ARENA_VERSION_NAMESPACE {
+
+namespace internal {
+
+// If the exceptions are enabled throws a new exception of the given type
+// passing the given expression_str to its constructor as a reason. If the
+// exceptions are disabled aborts the program execution.
+template <class Exception>
+[[noreturn]] inline constexpr void ThrowOrAbort(const char* expression_str) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  if constexpr (std::is_constructible_v<Exception, const char*>) {
+    throw Exception(expression_str);
+  } else {
+    (void)expression_str;
+    throw Exception();
+  }
+#else
+  (void)expression_str;
+  __builtin_abort();
+#endif
+}
+
+// A default implementation of the TL_MONOTONIC_ARENA_THROW_IF().
+template <class Exception>
+inline constexpr void ThrowIfOrAbort(const bool expression_eval,
+                                     const char* expression_str) {
+  if (expression_eval) {
+    ThrowOrAbort<Exception>(expression_str);
+  }
+}
+
+// The smallest size of a chunk requested from the upstream, in bytes.
+inline constexpr size_t kMinChunkSize = 1024;
+
+// Alignment of the chunks requested from the upstream.
+inline constexpr size_t kChunkAlignment = alignof(std::max_align_t);
+
+}  // namespace internal
+
+class MonotonicArena {
+ public:
+  // Arena without initial buffer: all allocations are served by the upstream.
+  explicit MonotonicArena(std::pmr::memory_resource* upstream)
+      : MonotonicArena({}, upstream) {}
+
+  // Arena which allocates from the given buffer first, and falls back to the
+  // upstream when the buffer is exhausted. If the upstream is nullptr then the
+  // allocations beyond the buffer capacity fail.
+  //
+  // The buffer is to outlive the arena.
+  explicit MonotonicArena(const std::span<std::byte> buffer,
+                          std::pmr::memory_resource* upstream = nullptr)
+      : initial_buffer_(buffer),
+        upstream_(upstream),
+        current_(buffer.data()),
+        current_end_(buffer.data() + buffer.size()),
+        next_chunk_size_(GetInitialChunkSize(buffer.size())) {}
+
+  MonotonicArena(const MonotonicArena& other) = delete;
+  MonotonicArena(MonotonicArena&& other) noexcept = delete;
+
+  ~MonotonicArena() { ReleaseChunks(nullptr); }
+
+  auto operator=(const MonotonicArena& other) -> MonotonicArena& = delete;
+  auto operator=(MonotonicArena&& other) -> MonotonicArena& = delete;
+
+  // Allocate memory of the given size and alignment.
+  //
+  // The alignment is to be a power of two. Throws std::bad_alloc if the memory
+  // can not be allocated.
+  auto Allocate(const size_t size,
+                const size_t alignment = alignof(std::max_align_t)) -> void* {
+    void* pointer = TryAllocate(size, alignment);
+    TL_MONOTONIC_ARENA_THROW_IF(std::bad_alloc, pointer == nullptr);
+    return pointer;
+  }
+
+  // Allocate memory of the given size and alignment.
+  //
+  // Returns nullptr if the arena is exhausted and there is no upstream. Errors
+  // of the upstream are propagated to the caller.
+  auto TryAllocate(const size_t size,
+                   const size_t alignment = alignof(std::max_align_t))
+      -> void* {
+    TL_MONOTONIC_ARENA_THROW_IF(std::invalid_argument,
+                                !IsPowerOfTwo(alignment));
+
+    if (void* pointer = AllocateFromCurrent(size, alignment)) {
+      return pointer;
+    }
+
+    if (upstream_ == nullptr || !AllocateChunk(size, alignment)) {
+      return nullptr;
+    }
+
+    return AllocateFromCurrent(size, alignment);
+  }
+
+  // Construct a new object of type T in the memory allocated from the arena.
+  //
+  // The destructor of the object is never called by the arena, so it is
+  // mainly useful for trivially destructible types.
+  template <class T, class... Args>
+  auto New(Args&&... args) -> T* {
+    void* pointer = Allocate(sizeof(T), alignof(T));
+    return ::new (pointer) T(std::forward<Args>(args)...);
+  }
+
+  // Reclaim all memory allocated from the arena.
+  //
+  // The largest chunk allocated from the upstream is kept and is used for the
+  // allocations which follow the reset, all other chunks are returned to the
+  // upstream.
+  void Reset() {
+    ChunkHeader* largest_chunk = nullptr;
+    size_t total_size = initial_buffer_.size();
+    for (ChunkHeader* chunk = chunks_; chunk; chunk = chunk->previous) {
+      if (!largest_chunk || chunk->size > largest_chunk->size) {
+        largest_chunk = chunk;
+      }
+      total_size += std::min(chunk->size, SIZE_MAX - total_size);
+    }
+
+    if (largest_chunk && largest_chunk->previous) {
+      next_chunk_size_ = std::max(next_chunk_size_, total_size);
+    }
+
+    // Only keep the chunk if it is larger than the initial buffer, otherwise
+    // the allocations are served from the initial buffer.
+    if (largest_chunk &&
+        largest_chunk->size - sizeof(ChunkHeader) <= initial_buffer_.size()) {
+      largest_chunk = nullptr;
+    }
+
+    ReleaseChunks(largest_chunk);
+
+    if (largest_chunk == nullptr) {
+      current_ = initial_buffer_.data();
+      current_end_ = initial_buffer_.data() + initial_buffer_.size();
+      return;
+    }
+
+    std::byte* chunk_data = reinterpret_cast<std::byte*>(largest_chunk);
+    current_ = chunk_data + sizeof(ChunkHeader);
+    current_end_ = chunk_data + largest_chunk->size;
+  }
+
+  // Reclaim all memory allocated from the arena, and return all chunks to the
+  // upstream.
+  void Release() {
+    ReleaseChunks(nullptr);
+
+    current_ = initial_buffer_.data();
+    current_end_ = initial_buffer_.data() + initial_buffer_.size();
+    next_chunk_size_ = GetInitialChunkSize(initial_buffer_.size());
+  }
+
+  // Get the upstream memory resource of the arena.
+  auto GetUpstream() const -> std::pmr::memory_resource* { return upstream_; }
+
+  // Get the number of bytes which can be allocated from the current region
+  // without alignment padding and without requesting memory from the upstream.
+  auto GetNumAvailableBytes() const -> size_t {
+    return size_t(current_end_ - current_);
+  }
+
+ private:
+  // Header which is stored at the beginning of every upstream chunk.
+  // The size includes the header itself.
+  struct ChunkHeader {
+    ChunkHeader* previous;
+    size_t size;
+  };
+
+  static constexpr auto IsPowerOfTwo(const size_t value) -> bool {
+    return value != 0 && (value & (value - 1)) == 0;
+  }
+
+  static constexpr auto GetInitialChunkSize(const size_t buffer_size)
+      -> size_t {
+    return std::max(internal::kMinChunkSize, buffer_size * 2);
+  }
+
+  // Allocate memory from the current region.
+  // Returns nullptr if the region does not have enough space.
+  auto AllocateFromCurrent(const size_t size, const size_t alignment)
+      -> void* {
+    const uintptr_t current = reinterpret_cast<uintptr_t>(current_);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(current_end_);
+    const uintptr_t aligned = (current + alignment - 1) & ~(alignment - 1);
+
+    if (aligned < current || aligned > end || size > end - aligned) {
+      return nullptr;
+    }
+
+    std::byte* pointer = current_ + (aligned - current);
+    current_ = pointer + size;
+
+    return pointer;
+  }
+
+  // Allocate a new chunk from the upstream which is big enough to hold an
+  // allocation of the given size and alignment, and make it current.
+  //
+  // Returns false if the size of the chunk overflows.
+  auto AllocateChunk(const size_t size, const size_t alignment) -> bool {
+    const size_t padding = alignment > internal::kChunkAlignment
+                               ? alignment - internal::kChunkAlignment
+                               : 0;
+    const size_t overhead = sizeof(ChunkHeader) + padding;
+    if (size > SIZE_MAX - overhead) {
+      return false;
+    }
+
+    const size_t chunk_size = std::max(next_chunk_size_, size + overhead);
+
+    void* chunk_data =
+        upstream_->allocate(chunk_size, internal::kChunkAlignment);
+
+    ChunkHeader* chunk = ::new (chunk_data) ChunkHeader{chunks_, chunk_size};
+    chunks_ = chunk;
+
+    std::byte* chunk_bytes = static_cast<std::byte*>(chunk_data);
+    current_ = chunk_bytes + sizeof(ChunkHeader);
+    current_end_ = chunk_bytes + chunk_size;
+
+    next_chunk_size_ =
+        chunk_size > SIZE_MAX / 2 ? chunk_size : chunk_size * 2;
+
+    return true;
+  }
+
+  // Return all chunks to the upstream, except for the given one.
+  void ReleaseChunks(ChunkHeader* chunk_to_keep) {
+    ChunkHeader* chunk = chunks_;
+    while (chunk) {
+      ChunkHeader* previous = chunk->previous;
+      if (chunk != chunk_to_keep) {
+        upstream_->deallocate(chunk, chunk->size, internal::kChunkAlignment);
+      }
+      chunk = previous;
+    }
+
+    chunks_ = chunk_to_keep;
+    if (chunk_to_keep) {
+      chunk_to_keep->previous = nullptr;
+    }
+  }
+
+  std::span<std::byte> initial_buffer_;
+  std::pmr::memory_resource* upstream_;
+
+  // The region from which the allocations are currently served.
+  std::byte* current_;
+  std::byte* current_end_;
+
+  // Singly-linked list of chunks allocated from the upstream, newest first.
+  ChunkHeader* chunks_{nullptr};
+
+  size_t next_chunk_size_;
+};
+
+// MonotonicArena with the initial buffer of N bytes stored in-object.
+template <size_t N>
+class StaticMonotonicArena : public MonotonicArena {
+ public:
+  explicit StaticMonotonicArena(std::pmr::memory_resource* upstream = nullptr)
+      : MonotonicArena(std::span<std::byte>(buffer_), upstream) {}
+
+ private:
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  alignas(std::max_align_t) std::byte buffer_[N];
+};
+
+// Adapter of an arena to the std::pmr::memory_resource interface.
+//
+// The deallocation is a no-op: the memory is reclaimed when the arena is reset.
+// Two resources are equal if they allocate from the same arena.
+class ArenaResource : public std::pmr::memory_resource {
+ public:
+  explicit ArenaResource(MonotonicArena& arena) : arena_(&arena) {}
+
+  auto GetArena() const -> MonotonicArena& { return *arena_; }
+
+ private:
+  auto do_allocate(const size_t bytes, const size_t alignment)
+      -> void* override {
+    return arena_->Allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* /*p*/,
+                     size_t /*bytes*/,
+                     size_t /*alignment*/) override {}
+
+  auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override {
+    if (this == &other) {
+      return true;
+    }
+    const auto* other_resource = dynamic_cast<const ArenaResource*>(&other);
+    return other_resource && other_resource->arena_ == arena_;
+  }
+
+  MonotonicArena* arena_;
+};
+
+}  // namespace TL_MONOTONIC_ARENA_VERSION_NAMESPACE
+}  // namespace TL_MONOTONIC_ARENA_NAMESPACE
+
+#undef TL_MONOTONIC_ARENA_VERSION_MAJOR
+#undef TL_MONOTONIC_ARENA_VERSION_MINOR
+#undef TL_MONOTONIC_ARENA_VERSION_REVISION
+
+#undef TL_MONOTONIC_ARENA_NAMESPACE
+
+#undef TL_MONOTONIC_ARENA_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_MONOTONIC_ARENA_VERSION_NAMESPACE_CONCAT
+#undef TL_MONOTONIC_ARENA_VERSION_NAMESPACE
+
+#undef TL_MONOTONIC_ARENA_THROW_IF
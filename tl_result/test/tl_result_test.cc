@@ -4,6 +4,12 @@
 
 #include "tl_result/tl_result.h"
 
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+
 #include "tiny_lib/unittest/test.h"
 
 namespace tiny_lib::result {
@@ -14,6 +20,8 @@ enum class Error {
   kImpossibleError,
 };
 
+using IntResult = Result<int, Error>;
+
 TEST(tl_result, Construct) {
   // Empty.
   {
@@ -30,15 +38,6 @@ TEST(tl_result, Construct) {
     EXPECT_TRUE(result.HasValue());
     EXPECT_EQ(result.GetValue(), 20);
   }
-
-  // Initialize from rvalue with an error.
-  {
-    Result<int, Error> result(20, Error::kGenericError);
-    EXPECT_FALSE(result.Ok());
-    EXPECT_EQ(result.GetError(), Error::kGenericError);
-    EXPECT_TRUE(result.HasValue());
-    EXPECT_EQ(result.GetValue(), 20);
-  }
 }
 
 TEST(tl_result, ValueAccessViaOperator) {
@@ -84,4 +83,160 @@ TEST(tl_result, Boolean) {
   }
 }
 
+TEST(tl_result, Size) {
+  // The value and the error share the storage.
+  static_assert(sizeof(Result<int, Error>) <= 2 * sizeof(int));
+  static_assert(sizeof(Result<int, Error>) <
+                sizeof(PartialResult<int, Error>));
+}
+
+TEST(tl_result, Equality) {
+  EXPECT_EQ(IntResult(10), IntResult(10));
+  EXPECT_NE(IntResult(10), IntResult(20));
+  EXPECT_NE(IntResult(10), IntResult(Error::kGenericError));
+  EXPECT_EQ(IntResult(Error::kGenericError), IntResult(Error::kGenericError));
+}
+
+TEST(tl_result, BadAccess) {
+  IntResult ok(10);
+  EXPECT_THROW_OR_ABORT((void)ok.GetError(), std::bad_optional_access);
+
+  IntResult error(Error::kGenericError);
+  EXPECT_THROW_OR_ABORT((void)error.GetValue(), std::bad_optional_access);
+}
+
+TEST(tl_result, MoveValue) {
+  Result<std::unique_ptr<int>, Error> result(std::make_unique<int>(17));
+
+  const std::unique_ptr<int> value = std::move(result).GetValue();
+  EXPECT_EQ(*value, 17);
+}
+
+TEST(tl_result, Print) {
+  std::stringstream os;
+  os << IntResult(10) << " " << IntResult(Error::kGenericError);
+  EXPECT_EQ(os.str(), "value:10 error:1");
+}
+
+TEST(tl_result, AndThen) {
+  const auto half = [](const int x) -> IntResult {
+    if (x % 2) {
+      return Error::kImpossibleError;
+    }
+    return x / 2;
+  };
+
+  EXPECT_EQ(IntResult(20).AndThen(half).AndThen(half), IntResult(5));
+  EXPECT_EQ(IntResult(20).AndThen(half).AndThen(half).AndThen(half),
+            IntResult(Error::kImpossibleError));
+
+  // The error is propagated without invoking the function.
+  int num_calls = 0;
+  const auto count = [&num_calls](int x) -> IntResult {
+    ++num_calls;
+    return x;
+  };
+  const IntResult error(Error::kGenericError);
+  EXPECT_EQ(error.AndThen(count), IntResult(Error::kGenericError));
+  EXPECT_EQ(num_calls, 0);
+
+  // The value of an rvalue result is moved to the function.
+  Result<std::unique_ptr<int>, Error> ptr(std::make_unique<int>(17));
+  const IntResult value = std::move(ptr).AndThen(
+      [](std::unique_ptr<int>&& p) -> IntResult { return *p; });
+  EXPECT_EQ(value, IntResult(17));
+}
+
+TEST(tl_result, Transform) {
+  const Result<std::string, Error> str =
+      IntResult(17).Transform([](int x) { return std::to_string(x); });
+  EXPECT_EQ(str, (Result<std::string, Error>("17")));
+
+  const Result<std::string, Error> error =
+      IntResult(Error::kGenericError).Transform([](int x) {
+        return std::to_string(x);
+      });
+  EXPECT_EQ(error, (Result<std::string, Error>(Error::kGenericError)));
+
+  // The value of an rvalue result is moved to the function.
+  Result<std::unique_ptr<int>, Error> ptr(std::make_unique<int>(17));
+  const Result<std::unique_ptr<int>, Error> moved =
+      std::move(ptr).Transform([](std::unique_ptr<int>&& p) {
+        *p += 1;
+        return std::move(p);
+      });
+  EXPECT_EQ(**moved, 18);
+}
+
+TEST(tl_result, OrElse) {
+  const auto fallback = [](Error error) -> IntResult {
+    if (error == Error::kGenericError) {
+      return 0;
+    }
+    return error;
+  };
+
+  EXPECT_EQ(IntResult(10).OrElse(fallback), IntResult(10));
+  EXPECT_EQ(IntResult(Error::kGenericError).OrElse(fallback), IntResult(0));
+  EXPECT_EQ(IntResult(Error::kImpossibleError).OrElse(fallback),
+            IntResult(Error::kImpossibleError));
+
+  // The value of an rvalue result is moved to the returned result.
+  Result<std::unique_ptr<int>, Error> ptr(std::make_unique<int>(17));
+  const Result<std::unique_ptr<int>, Error> moved = std::move(ptr).OrElse(
+      [](Error error) -> Result<std::unique_ptr<int>, Error> { return error; });
+  EXPECT_EQ(**moved, 17);
+}
+
+TEST(tl_result, Constexpr) {
+  constexpr IntResult kResult =
+      IntResult(10).Transform([](int x) { return x * 2; });
+  static_assert(kResult.Ok());
+  static_assert(*kResult == 20);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// PartialResult.
+
+TEST(tl_partial_result, Construct) {
+  // Empty.
+  {
+    PartialResult<int, Error> result(Error::kGenericError);
+    EXPECT_FALSE(result.Ok());
+    EXPECT_EQ(result.GetError(), Error::kGenericError);
+    EXPECT_FALSE(result.HasValue());
+  }
+
+  // Initialize from rvalue.
+  {
+    PartialResult<int, Error> result(20);
+    EXPECT_TRUE(result.Ok());
+    EXPECT_TRUE(result.HasValue());
+    EXPECT_EQ(result.GetValue(), 20);
+  }
+
+  // Initialize from rvalue with an error.
+  {
+    PartialResult<int, Error> result(20, Error::kGenericError);
+    EXPECT_FALSE(result.Ok());
+    EXPECT_EQ(result.GetError(), Error::kGenericError);
+    EXPECT_TRUE(result.HasValue());
+    EXPECT_EQ(result.GetValue(), 20);
+  }
+}
+
+TEST(tl_partial_result, MoveValue) {
+  PartialResult<std::unique_ptr<int>, Error> result(std::make_unique<int>(17),
+                                                    Error::kGenericError);
+
+  const std::unique_ptr<int> value = std::move(result).GetValue();
+  EXPECT_EQ(*value, 17);
+}
+
+TEST(tl_partial_result, Print) {
+  std::stringstream os;
+  os << PartialResult<int, Error>(10, Error::kGenericError);
+  EXPECT_EQ(os.str(), "value:10error:1");
+}
+
 }  // namespace tiny_lib::result
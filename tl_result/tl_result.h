@@ -8,12 +8,10 @@
 // known. This error will provide details about reasoning why the result could
 // not be calculated.
 //
-// It is possible to have result which has both value and error associated with
-// it. In this case the result is considered to be ill-calculated, but it is
-// allowed to access the partially calculated value.
-//
-// The result is considered to be successfully calculated if and only if there
-// is no error associated with it.
+// The Result contains either a value or an error. It is stored as a single
+// discriminated union, so its size is close to the size of the larger of the
+// value and the error, and checking whether the result is ok is a single
+// branch.
 //
 // A common use case for the Result is the return value of a function which
 // might fail and wants to communicate details about the failure mode.
@@ -39,6 +37,39 @@
 // does not add any semantic to the value, so both true and false error codes
 // in this case will be considered a non-OK result.
 //
+// Monadic operations
+// ==================
+//
+// The Result provides operations which allow to chain fallible calls without
+// checking the result after every call:
+//
+//   - AndThen(f) returns f(value) if the result is ok, which is to return a
+//     Result with the same error type. Otherwise the error is propagated.
+//
+//   - Transform(f) returns a Result which contains f(value) if the result is
+//     ok. Otherwise the error is propagated.
+//
+//   - OrElse(f) returns f(error) if the result is not ok, which is to return a
+//     Result with the same value type. Otherwise the value is propagated.
+//
+// The operations called on an rvalue result move its value or error to the
+// function and the returned result instead of copying them:
+//
+//   Result<Frame, Error> frame = ReadPacket(file)
+//                                    .AndThen(DecodePacket)
+//                                    .Transform(ConvertToFrame);
+//
+// Partial result
+// ==============
+//
+// PartialResult is a result which can have both value and error associated
+// with it. In this case the result is considered to be ill-calculated, but it
+// is allowed to access the partially calculated value. The value and the error
+// are stored separately, which makes the PartialResult larger than the Result.
+//
+// The partial result is considered to be successfully calculated if and only
+// if there is no error associated with it.
+//
 // NOTE: The ValueType and ErrorType should not be implicitly convertible
 // between each-other.
 //
@@ -46,19 +77,27 @@
 // Version history
 // ===============
 //
+//   0.0.2-alpha    (19 Oct 2026)    Store either value or error in the Result,
+//                                   move the value with error mode to the
+//                                   PartialResult. Add monadic operations, fix
+//                                   access to the value of rvalue results.
 //   0.0.1-alpha    (28 Dec 2023)    First public release.
 
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <functional>
 #include <optional>
 #include <ostream>
 #include <type_traits>
+#include <utility>
+#include <variant>
 
 // Semantic version of the tl_result library.
 #define TL_RESULT_VERSION_MAJOR 0
 #define TL_RESULT_VERSION_MINOR 0
-#define TL_RESULT_VERSION_REVISION 1
+#define TL_RESULT_VERSION_REVISION 2
 
 // Namespace of the module.
 // The outer name spaces which surrounds the ABI-version namespace.
@@ -91,6 +130,8 @@ inline namespace TL_RESULT_VERSION_NAMESPACE {
 // The result shall not be silently ignored.
 template <class ValueType, class ErrorType>
 class [[nodiscard]] Result;
+template <class ValueType, class ErrorType>
+class [[nodiscard]] PartialResult;
 
 namespace result_internal {
 
@@ -100,38 +141,69 @@ using IsInPlaceType = std::is_same<std::remove_cvref_t<T>, std::in_place_t>;
 template <class T>
 using IsNotInPlaceType = std::negation<IsInPlaceType<T>>;
 
-template <class ValueType, class OtherValueType, class ErrorType>
+template <class ValueType, class OtherValueType, class ResultType>
 using IsDirectInitializable = std::conjunction<
     std::is_constructible<ValueType, OtherValueType&&>,
     IsNotInPlaceType<OtherValueType>,
     std::negation<std::is_same<std::remove_cvref_t<OtherValueType>,
-                               Result<ValueType, ErrorType>>>>;
+                               ResultType>>>;
 
-template <class ValueType, class OtherValueType, class ErrorType>
+template <class ValueType, class OtherValueType, class ResultType>
 using IsDirectInitializableImplicit = std::conjunction<
-    IsDirectInitializable<ValueType, OtherValueType, ErrorType>,
+    IsDirectInitializable<ValueType, OtherValueType, ResultType>,
     std::is_convertible<OtherValueType&&, ValueType>>;
 
-template <class ValueType, class OtherValueType, class ErrorType>
+template <class ValueType, class OtherValueType, class ResultType>
 using IsDirectInitializableExplicit = std::conjunction<
-    IsDirectInitializable<ValueType, OtherValueType, ErrorType>,
+    IsDirectInitializable<ValueType, OtherValueType, ResultType>,
     std::negation<std::is_convertible<OtherValueType&&, ValueType>>>;
 
+// If T is a Result provides the member constant value equal to `true`.
+// Otherwise value is `false`.
+template <class T>
+struct IsResult : std::false_type {};
+template <class ValueType, class ErrorType>
+struct IsResult<Result<ValueType, ErrorType>> : std::true_type {};
+
+// Report an access to the value or the error which is not in the result.
+// If the exceptions are enabled throws std::bad_optional_access, otherwise
+// aborts the program execution.
+[[noreturn]] inline void ThrowBadAccess() {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  throw std::bad_optional_access();
+#else
+  __builtin_abort();
+#endif
+}
+
 }  // namespace result_internal
 
+////////////////////////////////////////////////////////////////////////////////
+// Result.
+
 template <class ValueType, class ErrorType>
 class Result {
+  // Indices of the alternatives in the storage.
+  // The access is done by index, which allows ValueType and ErrorType to be
+  // the same type.
+  static constexpr std::size_t kValueIndex = 0;
+  static constexpr std::size_t kErrorIndex = 1;
+
  public:
+  // NOLINTBEGIN(readability-identifier-naming)
+  using value_type = ValueType;
+  using error_type = ErrorType;
+  // NOLINTEND(readability-identifier-naming)
+
   // Constructs an object that does not contain a value.
-  constexpr Result(const ErrorType error) : error_(error) {}
+  constexpr Result(const ErrorType error)
+      : storage_(std::in_place_index<kErrorIndex>, error) {}
 
   // Copy and move constructors.
   // Follows semantic of the std::optional.
   constexpr Result(const Result& other) = default;
   constexpr Result(Result&& other) noexcept = default;
 
-  // TODO(sergey): Implement all constructors from the std::optional.
-
   // Constructs a Result object that contains a value, initialized as if
   // direct-initializing (but not direct-list-initializing) an object of type
   // ValueType with the expression std::forward<OtherValueType>(value).
@@ -140,49 +212,311 @@ class Result {
             std::enable_if_t<result_internal::IsDirectInitializableImplicit<
                                  ValueType,
                                  OtherValueType,
-                                 ErrorType>::value,
+                                 Result>::value,
                              bool> = true>
   constexpr Result(OtherValueType&& value)
-      : value_(std::forward<OtherValueType>(value)) {}
+      : storage_(std::in_place_index<kValueIndex>,
+                 std::forward<OtherValueType>(value)) {}
 
   template <class OtherValueType = ValueType,
             std::enable_if_t<result_internal::IsDirectInitializableExplicit<
                                  ValueType,
                                  OtherValueType,
-                                 ErrorType>::value,
+                                 Result>::value,
                              bool> = true>
   explicit constexpr Result(OtherValueType&& value)
+      : storage_(std::in_place_index<kValueIndex>,
+                 std::forward<OtherValueType>(value)) {}
+
+  ~Result() = default;
+
+  constexpr auto operator=(const Result& other) -> Result& = default;
+  constexpr auto operator=(Result&& other) noexcept -> Result& = default;
+
+  constexpr auto operator==(const Result& other) const -> bool {
+    return storage_ == other.storage_;
+  }
+  constexpr auto operator!=(const Result& other) const -> bool {
+    return !(*this == other);
+  }
+
+  // Checks whether *this contains a value.
+  // When the value is present an error is considered to be absent.
+  constexpr auto Ok() const noexcept -> bool {
+    return storage_.index() == kValueIndex;
+  }
+
+  // When the result is not ok returns the error code.
+  // When is called for result which is ok throws a std::bad_optional_access
+  // exception.
+  constexpr auto GetError() const& -> const ErrorType& {
+    if (Ok()) {
+      result_internal::ThrowBadAccess();
+    }
+    return *std::get_if<kErrorIndex>(&storage_);
+  }
+  constexpr auto GetError() && -> ErrorType&& {
+    if (Ok()) {
+      result_internal::ThrowBadAccess();
+    }
+    return std::move(*std::get_if<kErrorIndex>(&storage_));
+  }
+
+  // Checks whether the result contains a value.
+  // Is the same as Ok().
+  constexpr auto HasValue() const noexcept -> bool { return Ok(); }
+
+  // If *this contains a value, returns a reference to the contained value.
+  // Otherwise, throws a std::bad_optional_access exception.
+  constexpr auto GetValue() & -> ValueType& {
+    CheckHasValue();
+    return **this;
+  }
+  constexpr auto GetValue() const& -> const ValueType& {
+    CheckHasValue();
+    return **this;
+  }
+  constexpr auto GetValue() && -> ValueType&& {
+    CheckHasValue();
+    return *std::move(*this);
+  }
+  constexpr auto GetValue() const&& -> const ValueType&& {
+    CheckHasValue();
+    return *std::move(*this);
+  }
+
+  // Accesses the contained value.
+  //
+  // Leads to an undefined behavior when the result is not ok.
+  constexpr auto operator->() const noexcept -> const ValueType* {
+    assert(HasValue());
+    return std::get_if<kValueIndex>(&storage_);
+  }
+  constexpr auto operator->() noexcept -> ValueType* {
+    assert(HasValue());
+    return std::get_if<kValueIndex>(&storage_);
+  }
+
+  constexpr auto operator*() const& noexcept -> const ValueType& {
+    return *operator->();
+  }
+  constexpr auto operator*() & noexcept -> ValueType& { return *operator->(); }
+  constexpr auto operator*() const&& noexcept -> const ValueType&& {
+    return std::move(*operator->());
+  }
+  constexpr auto operator*() && noexcept -> ValueType&& {
+    return std::move(*operator->());
+  }
+
+  // If the result is ok returns the result of the function invoked with the
+  // value. Otherwise returns the error.
+  //
+  // The function is to return a Result with the same ErrorType.
+  template <class F>
+  constexpr auto AndThen(F&& f) & {
+    return AndThenImpl(*this, std::forward<F>(f));
+  }
+  template <class F>
+  constexpr auto AndThen(F&& f) const& {
+    return AndThenImpl(*this, std::forward<F>(f));
+  }
+  template <class F>
+  constexpr auto AndThen(F&& f) && {
+    return AndThenImpl(std::move(*this), std::forward<F>(f));
+  }
+  template <class F>
+  constexpr auto AndThen(F&& f) const&& {
+    return AndThenImpl(std::move(*this), std::forward<F>(f));
+  }
+
+  // If the result is ok returns a result which contains the result of the
+  // function invoked with the value. Otherwise returns the error.
+  template <class F>
+  constexpr auto Transform(F&& f) & {
+    return TransformImpl(*this, std::forward<F>(f));
+  }
+  template <class F>
+  constexpr auto Transform(F&& f) const& {
+    return TransformImpl(*this, std::forward<F>(f));
+  }
+  template <class F>
+  constexpr auto Transform(F&& f) && {
+    return TransformImpl(std::move(*this), std::forward<F>(f));
+  }
+  template <class F>
+  constexpr auto Transform(F&& f) const&& {
+    return TransformImpl(std::move(*this), std::forward<F>(f));
+  }
+
+  // If the result is not ok returns the result of the function invoked with
+  // the error. Otherwise returns the value.
+  //
+  // The function is to return a Result with the same ValueType.
+  template <class F>
+  constexpr auto OrElse(F&& f) & {
+    return OrElseImpl(*this, std::forward<F>(f));
+  }
+  template <class F>
+  constexpr auto OrElse(F&& f) const& {
+    return OrElseImpl(*this, std::forward<F>(f));
+  }
+  template <class F>
+  constexpr auto OrElse(F&& f) && {
+    return OrElseImpl(std::move(*this), std::forward<F>(f));
+  }
+  template <class F>
+  constexpr auto OrElse(F&& f) const&& {
+    return OrElseImpl(std::move(*this), std::forward<F>(f));
+  }
+
+ private:
+  constexpr void CheckHasValue() const {
+    if (!Ok()) {
+      result_internal::ThrowBadAccess();
+    }
+  }
+
+  // The Self is the result with the value category of the object the
+  // operation is invoked on, so that the value and the error are moved from
+  // an rvalue result.
+
+  template <class Self, class F>
+  static constexpr auto AndThenImpl(Self&& self, F&& f) {
+    using NewResult = std::remove_cvref_t<
+        std::invoke_result_t<F, decltype(*std::forward<Self>(self))>>;
+    static_assert(result_internal::IsResult<NewResult>::value,
+                  "AndThen() function is to return a Result");
+    static_assert(
+        std::is_same_v<typename NewResult::error_type, ErrorType>,
+        "AndThen() function is to return a Result with the same error type");
+
+    if (self.Ok()) {
+      return NewResult(
+          std::invoke(std::forward<F>(f), *std::forward<Self>(self)));
+    }
+    return NewResult(std::forward<Self>(self).GetErrorUnchecked());
+  }
+
+  template <class Self, class F>
+  static constexpr auto TransformImpl(Self&& self, F&& f) {
+    using NewValueType = std::remove_cvref_t<
+        std::invoke_result_t<F, decltype(*std::forward<Self>(self))>>;
+    static_assert(!std::is_void_v<NewValueType>,
+                  "Transform() function is to return a value");
+
+    using NewResult = Result<NewValueType, ErrorType>;
+
+    if (self.Ok()) {
+      return NewResult(
+          std::invoke(std::forward<F>(f), *std::forward<Self>(self)));
+    }
+    return NewResult(std::forward<Self>(self).GetErrorUnchecked());
+  }
+
+  template <class Self, class F>
+  static constexpr auto OrElseImpl(Self&& self, F&& f) {
+    using NewResult = std::remove_cvref_t<std::invoke_result_t<
+        F,
+        decltype(std::forward<Self>(self).GetErrorUnchecked())>>;
+    static_assert(result_internal::IsResult<NewResult>::value,
+                  "OrElse() function is to return a Result");
+    static_assert(
+        std::is_same_v<typename NewResult::value_type, ValueType>,
+        "OrElse() function is to return a Result with the same value type");
+
+    if (self.Ok()) {
+      return NewResult(*std::forward<Self>(self));
+    }
+    return NewResult(std::invoke(
+        std::forward<F>(f), std::forward<Self>(self).GetErrorUnchecked()));
+  }
+
+  constexpr auto GetErrorUnchecked() const& -> const ErrorType& {
+    return *std::get_if<kErrorIndex>(&storage_);
+  }
+  constexpr auto GetErrorUnchecked() && -> ErrorType&& {
+    return std::move(*std::get_if<kErrorIndex>(&storage_));
+  }
+  constexpr auto GetErrorUnchecked() const&& -> const ErrorType&& {
+    return std::move(*std::get_if<kErrorIndex>(&storage_));
+  }
+
+  std::variant<ValueType, ErrorType> storage_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// PartialResult.
+
+template <class ValueType, class ErrorType>
+class PartialResult {
+ public:
+  // NOLINTBEGIN(readability-identifier-naming)
+  using value_type = ValueType;
+  using error_type = ErrorType;
+  // NOLINTEND(readability-identifier-naming)
+
+  // Constructs an object that does not contain a value.
+  constexpr PartialResult(const ErrorType error) : error_(error) {}
+
+  // Copy and move constructors.
+  // Follows semantic of the std::optional.
+  constexpr PartialResult(const PartialResult& other) = default;
+  constexpr PartialResult(PartialResult&& other) noexcept = default;
+
+  // TODO(sergey): Implement all constructors from the std::optional.
+
+  // Constructs a PartialResult object that contains a value, initialized as if
+  // direct-initializing (but not direct-list-initializing) an object of type
+  // ValueType with the expression std::forward<OtherValueType>(value).
+
+  template <class OtherValueType = ValueType,
+            std::enable_if_t<result_internal::IsDirectInitializableImplicit<
+                                 ValueType,
+                                 OtherValueType,
+                                 PartialResult>::value,
+                             bool> = true>
+  constexpr PartialResult(OtherValueType&& value)
       : value_(std::forward<OtherValueType>(value)) {}
 
-  // Constructs a Result object that contains a value, initialized as if
+  template <class OtherValueType = ValueType,
+            std::enable_if_t<result_internal::IsDirectInitializableExplicit<
+                                 ValueType,
+                                 OtherValueType,
+                                 PartialResult>::value,
+                             bool> = true>
+  explicit constexpr PartialResult(OtherValueType&& value)
+      : value_(std::forward<OtherValueType>(value)) {}
+
+  // Constructs a PartialResult object that contains a value, initialized as if
   // direct-initializing (but not direct-list-initializing) an object of type
   // ValueType with the expression std::forward<OtherValueType>(value), and an
   // error.
-  template <
-      class OtherValueType = ValueType,
-      std::enable_if_t<result_internal::IsDirectInitializable<ValueType,
-                                                              OtherValueType,
-                                                              ErrorType>::value,
-                       bool> = true>
-  constexpr Result(OtherValueType&& value, const ErrorType error)
+  template <class OtherValueType = ValueType,
+            std::enable_if_t<
+                result_internal::IsDirectInitializable<ValueType,
+                                                       OtherValueType,
+                                                       PartialResult>::value,
+                bool> = true>
+  constexpr PartialResult(OtherValueType&& value, const ErrorType error)
       : value_(std::forward<OtherValueType>(value)), error_(error) {}
 
-  ~Result() = default;
+  ~PartialResult() = default;
 
-  constexpr auto operator=(const Result& other) -> Result& = default;
-  constexpr auto operator=(Result&& other) noexcept -> Result& = default;
+  constexpr auto operator=(const PartialResult& other)
+      -> PartialResult& = default;
+  constexpr auto operator=(PartialResult&& other) noexcept
+      -> PartialResult& = default;
 
-  constexpr auto operator==(const Result& other) const -> bool {
+  constexpr auto operator==(const PartialResult& other) const -> bool {
     return value_ == other.value_ && error_ == other.error_;
   }
-  constexpr auto operator!=(const Result& other) const -> bool {
+  constexpr auto operator!=(const PartialResult& other) const -> bool {
     return !(*this == other);
   }
 
   // TODO(sergey): Implement assignment operator.
 
-  // Checks whether *this contains a value.
-  // When the value is present an error is considered to be absent.
+  // Checks whether the result has no error.
   constexpr auto Ok() const noexcept -> bool { return !error_.has_value(); }
 
   // When the result is not ok returns the error code.
@@ -201,14 +535,16 @@ class Result {
   constexpr auto GetValue() const& -> const ValueType& {
     return value_.value();
   }
-  constexpr auto GetValue() && -> ValueType&& { return value_.value(); }
+  constexpr auto GetValue() && -> ValueType&& {
+    return std::move(value_).value();
+  }
   constexpr auto GetValue() const&& -> const ValueType&& {
-    return value_.value();
+    return std::move(value_).value();
   }
 
   // Accesses the contained value.
   //
-  // Leads to an undefined behavior when the result is not ok.
+  // Leads to an undefined behavior when the result has no value.
   constexpr auto operator->() const noexcept -> const ValueType* {
     assert(HasValue());
     return &(*value_);
@@ -223,9 +559,11 @@ class Result {
   }
   constexpr auto operator*() & noexcept -> ValueType& { return *value_; }
   constexpr auto operator*() const&& noexcept -> const ValueType&& {
-    return *value_;
+    return *std::move(value_);
+  }
+  constexpr auto operator*() && noexcept -> ValueType&& {
+    return *std::move(value_);
   }
-  constexpr auto operator*() && noexcept -> ValueType&& { return *value_; }
 
  private:
   std::optional<ValueType> value_;
@@ -385,6 +723,21 @@ template <class ValueType, class ErrorType>
 inline auto operator<<(std::ostream& os,
                        const Result<ValueType, ErrorType>& result)
     -> std::ostream& {
+  if (result.Ok()) {
+    os << "value:";
+    result_internal::ValuePrinter::PrintTo(result.GetValue(), os);
+  } else {
+    os << "error:";
+    result_internal::ValuePrinter::PrintTo(result.GetError(), os);
+  }
+
+  return os;
+}
+
+template <class ValueType, class ErrorType>
+inline auto operator<<(std::ostream& os,
+                       const PartialResult<ValueType, ErrorType>& result)
+    -> std::ostream& {
   if (result.HasValue()) {
     os << "value:";
     result_internal::ValuePrinter::PrintTo(result.GetValue(), os);
@@ -0,0 +1,175 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_string/tl_ascii_case.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "tl_string/tl_cstring_view.h"
+#include "tl_string/tl_static_string.h"
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::ascii_case {
+
+using cstring_view::CStringView;
+using static_string::StaticString;
+
+namespace {
+
+// Reference implementation of the character conversion.
+auto ToLowerReference(const char ch) -> char {
+  return (ch >= 'A' && ch <= 'Z') ? char(ch - 'A' + 'a') : ch;
+}
+auto ToUpperReference(const char ch) -> char {
+  return (ch >= 'a' && ch <= 'z') ? char(ch - 'a' + 'A') : ch;
+}
+
+// String of the given length which contains all byte values, so that every
+// position of the vector sees letters as well as the bytes around the letter
+// ranges.
+auto MakeString(const std::size_t length, const int offset) -> std::string {
+  std::string str(length, '\0');
+  for (std::size_t i = 0; i < length; ++i) {
+    str[i] = char((i * 7 + offset) % 256);
+  }
+  return str;
+}
+
+template <std::size_t N>
+constexpr auto ConstexprToLower(const std::string_view str)
+    -> StaticString<N> {
+  StaticString<N> result(str);
+  ToLowerASCII(result);
+  return result;
+}
+
+}  // namespace
+
+TEST(tl_ascii_case, Character) {
+  for (int i = 0; i < 256; ++i) {
+    const char ch = char(i);
+    EXPECT_EQ(ToLowerASCII(ch), ToLowerReference(ch)) << i;
+    EXPECT_EQ(ToUpperASCII(ch), ToUpperReference(ch)) << i;
+  }
+}
+
+TEST(tl_ascii_case, InPlace) {
+  StaticString<32> str("Content-Type: Text/HTML");
+
+  ToLowerASCII(str);
+  EXPECT_EQ(str, "content-type: text/html");
+
+  ToUpperASCII(str);
+  EXPECT_EQ(str, "CONTENT-TYPE: TEXT/HTML");
+
+  // All lengths around the vector width, and all byte values.
+  for (std::size_t length = 0; length < 100; ++length) {
+    for (int offset = 0; offset < 256; offset += 37) {
+      const std::string src = MakeString(length, offset);
+
+      std::string lower = src;
+      ToLowerASCII(lower);
+
+      std::string upper = src;
+      ToUpperASCII(upper);
+
+      for (std::size_t i = 0; i < length; ++i) {
+        ASSERT_EQ(lower[i], ToLowerReference(src[i])) << length << " " << i;
+        ASSERT_EQ(upper[i], ToUpperReference(src[i])) << length << " " << i;
+      }
+    }
+  }
+}
+
+TEST(tl_ascii_case, ToDestination) {
+  const CStringView src("Hello, World! 0123456789 [\\]^_`{|}~@");
+
+  StaticString<64> lower;
+  lower.resize_and_overwrite(src.size(), [&](char* dst, std::size_t n) {
+    EXPECT_EQ(ToLowerASCII(src, dst), dst + n);
+    return n;
+  });
+  EXPECT_EQ(lower, "hello, world! 0123456789 [\\]^_`{|}~@");
+
+  StaticString<64> upper;
+  upper.resize_and_overwrite(src.size(), [&](char* dst, std::size_t n) {
+    EXPECT_EQ(ToUpperASCII(src, dst), dst + n);
+    return n;
+  });
+  EXPECT_EQ(upper, "HELLO, WORLD! 0123456789 [\\]^_`{|}~@");
+
+  // Non-ASCII bytes are kept as-is.
+  const std::string_view utf8 = "\xc3\x84pfel \xd0\x96";
+  std::string dst(utf8.size(), '\0');
+  ToLowerASCII(utf8, dst.data());
+  EXPECT_EQ(dst, "\xc3\x84pfel \xd0\x96");
+}
+
+TEST(tl_ascii_case, Constexpr) {
+  static_assert(ConstexprToLower<32>("Hello, WORLD") == "hello, world");
+  static_assert(EqualsIgnoreCaseASCII("Hello", "hELLO"));
+  static_assert(CompareIgnoreCaseASCII("abc", "ABD") < 0);
+}
+
+TEST(tl_ascii_case, EqualsIgnoreCase) {
+  EXPECT_TRUE(EqualsIgnoreCaseASCII("", ""));
+  EXPECT_TRUE(EqualsIgnoreCaseASCII("RIFF", "riff"));
+  EXPECT_TRUE(
+      EqualsIgnoreCaseASCII(StaticString<8>("Data"), CStringView("dATA")));
+  EXPECT_FALSE(EqualsIgnoreCaseASCII("RIFF", "riff "));
+  EXPECT_FALSE(EqualsIgnoreCaseASCII("RIFF", "RIFX"));
+
+  // Characters which differ only in the 0x20 bit, but are not letters.
+  EXPECT_FALSE(EqualsIgnoreCaseASCII("@", "`"));
+  EXPECT_FALSE(EqualsIgnoreCaseASCII("[", "{"));
+  EXPECT_FALSE(EqualsIgnoreCaseASCII("\xc1", "\xe1"));
+
+  // A difference at every position of strings of different lengths.
+  for (std::size_t length = 1; length < 100; ++length) {
+    const std::string a = MakeString(length, 0);
+    std::string b = a;
+    ToUpperASCII(b);
+    ASSERT_TRUE(EqualsIgnoreCaseASCII(a, b)) << length;
+
+    for (std::size_t i = 0; i < length; ++i) {
+      std::string c = b;
+      c[i] = char(c[i] ^ 0x01);
+      ASSERT_FALSE(EqualsIgnoreCaseASCII(a, c)) << length << " " << i;
+    }
+  }
+}
+
+TEST(tl_ascii_case, CompareIgnoreCase) {
+  EXPECT_EQ(CompareIgnoreCaseASCII("", ""), 0);
+  EXPECT_EQ(CompareIgnoreCaseASCII("Hello", "hELLO"), 0);
+
+  EXPECT_LT(CompareIgnoreCaseASCII("abc", "ABD"), 0);
+  EXPECT_GT(CompareIgnoreCaseASCII("ABD", "abc"), 0);
+
+  // Prefix is ordered first.
+  EXPECT_LT(CompareIgnoreCaseASCII("abc", "ABCD"), 0);
+  EXPECT_GT(CompareIgnoreCaseASCII("ABCD", "abc"), 0);
+
+  // Letters are compared as lower case: '_' is between upper and lower case
+  // letters, but is ordered before letters of both cases.
+  EXPECT_GT(CompareIgnoreCaseASCII("A", "_"), 0);
+  EXPECT_GT(CompareIgnoreCaseASCII("a", "_"), 0);
+
+  // Bytes are compared as unsigned values.
+  EXPECT_GT(CompareIgnoreCaseASCII("\xff", "a"), 0);
+
+  // The mismatch is found at every position past the vector width.
+  const std::string a(40, 'a');
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    std::string b(a.size(), 'A');
+    b[i] = 'B';
+    ASSERT_LT(CompareIgnoreCaseASCII(a, b), 0) << i;
+    ASSERT_GT(CompareIgnoreCaseASCII(b, a), 0) << i;
+  }
+}
+
+}  // namespace tiny_lib::ascii_case
@@ -0,0 +1,141 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_string/tl_static_string_builder.h"
+
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "tl_string/tl_static_string.h"
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::static_string_builder {
+
+using static_string::StaticString;
+
+namespace {
+
+// Memory resource which counts the number of allocated bytes.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t num_allocated_bytes{0};
+
+ private:
+  auto do_allocate(const std::size_t bytes, const std::size_t alignment)
+      -> void* override {
+    num_allocated_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p,
+                     const std::size_t bytes,
+                     const std::size_t alignment) override {
+    num_allocated_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+TEST(tl_static_string_builder, Append) {
+  StaticStringBuilder<8> builder;
+  EXPECT_TRUE(builder.IsEmpty());
+  EXPECT_TRUE(builder.GetChunks().empty());
+
+  builder.Append("Hello").Append(',').Append(1, ' ');
+  builder += std::string("World");
+  builder += StaticString<4>("!");
+  builder.Append(0, '?');
+
+  EXPECT_FALSE(builder.IsEmpty());
+  EXPECT_EQ(builder.GetSize(), 13);
+  EXPECT_EQ(builder.Flatten(), "Hello, World!");
+
+  // The text is split into chunks at their capacity.
+  ASSERT_EQ(builder.GetChunks().size(), 2);
+  EXPECT_EQ(builder.GetChunks()[0], "Hello, W");
+  EXPECT_EQ(builder.GetChunks()[1], "orld!");
+}
+
+TEST(tl_static_string_builder, AppendLong) {
+  StaticStringBuilder<4> builder;
+
+  builder.Append("ab");
+  builder.Append("cdefghijk");
+  builder.Append(5, 'x');
+
+  ASSERT_EQ(builder.GetChunks().size(), 4);
+  EXPECT_EQ(builder.GetChunks()[0], "abcd");
+  EXPECT_EQ(builder.GetChunks()[1], "efgh");
+  EXPECT_EQ(builder.GetChunks()[2], "ijkx");
+  EXPECT_EQ(builder.GetChunks()[3], "xxxx");
+
+  EXPECT_EQ(builder.Flatten(), "abcdefghijkxxxxx");
+}
+
+TEST(tl_static_string_builder, ChunksAreNotMoved) {
+  StaticStringBuilder<16> builder;
+
+  builder.Append("first chunk.....");
+  const char* data = builder.GetChunks()[0].data();
+
+  for (int i = 0; i < 100; ++i) {
+    builder.Append("more text");
+  }
+
+  EXPECT_EQ(builder.GetChunks()[0].data(), data);
+  EXPECT_EQ(builder.GetChunks()[0], "first chunk.....");
+  EXPECT_EQ(builder.GetSize(), 16 + 100 * 9);
+}
+
+TEST(tl_static_string_builder, Flatten) {
+  StaticStringBuilder<4> builder;
+  builder.Append("Hello, World!");
+
+  EXPECT_EQ(builder.Flatten<StaticString<16>>(), "Hello, World!");
+  EXPECT_THROW_OR_ABORT(builder.Flatten<StaticString<8>>(), std::length_error);
+}
+
+TEST(tl_static_string_builder, Resource) {
+  CountingResource resource;
+
+  {
+    StaticStringBuilder<64> builder(&resource);
+    builder.Append(100, 'x');
+    EXPECT_GE(resource.num_allocated_bytes, 128);
+
+    // The chunks are returned, the list of chunks is kept for reuse.
+    builder.Clear();
+    EXPECT_TRUE(builder.IsEmpty());
+    EXPECT_LT(resource.num_allocated_bytes, 64);
+
+    builder.Append("text");
+    EXPECT_EQ(builder.Flatten(), "text");
+
+    // The moved builder owns the chunks.
+    StaticStringBuilder<64> other(std::move(builder));
+    EXPECT_EQ(other.Flatten(), "text");
+    EXPECT_TRUE(builder.IsEmpty());  // NOLINT(bugprone-use-after-move)
+  }
+
+  EXPECT_EQ(resource.num_allocated_bytes, 0);
+}
+
+TEST(tl_static_string_builder, Wide) {
+  BasicStaticStringBuilder<wchar_t, 3> builder;
+  builder.Append(L"Hello");
+  EXPECT_EQ(builder.Flatten(), L"Hello");
+}
+
+}  // namespace tiny_lib::static_string_builder
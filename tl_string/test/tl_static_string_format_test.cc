@@ -0,0 +1,129 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_string/tl_static_string_format.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include "tl_string/tl_cstring_view.h"
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::static_string_format {
+
+using cstring_view::CStringView;
+
+TEST(tl_static_string_format, Literal) {
+  StaticString<32> str;
+
+  AppendFormat(str, "Hello");
+  EXPECT_EQ(str, "Hello");
+
+  AppendFormat(str, ", {{world}}!");
+  EXPECT_EQ(str, "Hello, {world}!");
+
+  AppendFormat(str, "");
+  EXPECT_EQ(str, "Hello, {world}!");
+}
+
+TEST(tl_static_string_format, Integer) {
+  EXPECT_EQ(Format<32>("{}", 0), "0");
+  EXPECT_EQ(Format<32>("{}", 123), "123");
+  EXPECT_EQ(Format<32>("{}", -45), "-45");
+  EXPECT_EQ(Format<32>("{}", uint8_t(255)), "255");
+  EXPECT_EQ(Format<32>("{}", int64_t(1234567890123)), "1234567890123");
+  EXPECT_EQ(Format<32>("{}", std::numeric_limits<uint64_t>::max()),
+            "18446744073709551615");
+  EXPECT_EQ(Format<32>("a{}b{}c", 1, 2), "a1b2c");
+}
+
+TEST(tl_static_string_format, Float) {
+  EXPECT_EQ(Format<32>("{}", 0.5), "0.5");
+  EXPECT_EQ(Format<32>("{}", 1.25f), "1.25");
+  EXPECT_EQ(Format<32>("{}", -3.0), "-3");
+  EXPECT_EQ(Format<32>("{}", 0.1), "0.1");
+  EXPECT_EQ(Format<32>("{}", 1e100), "1e+100");
+}
+
+TEST(tl_static_string_format, BoolAndChar) {
+  EXPECT_EQ(Format<32>("{} {}", true, false), "true false");
+  EXPECT_EQ(Format<32>("[{}]", 'x'), "[x]");
+}
+
+TEST(tl_static_string_format, String) {
+  const StaticString<8> static_string("static");
+  const CStringView cstring_view("view");
+  const std::string std_string("std");
+  const char* c_string = "c";
+
+  EXPECT_EQ(Format<32>("{} {} {} {} {}",
+                       static_string,
+                       cstring_view,
+                       std_string,
+                       c_string,
+                       "literal"),
+            "static view std c literal");
+
+  EXPECT_EQ(Format<32>("{}", std::string_view("a\0b", 3)),
+            std::string_view("a\0b", 3));
+}
+
+TEST(tl_static_string_format, AppendFormat) {
+  StaticString<32> str("Frame");
+
+  AppendFormat(str, " {} of {}", 10, 20);
+  EXPECT_EQ(str, "Frame 10 of 20");
+
+  AppendFormat(str, ": {}", CStringView("done"));
+  EXPECT_EQ(str, "Frame 10 of 20: done");
+}
+
+TEST(tl_static_string_format, Overflow) {
+  // Exact fit.
+  {
+    StaticString<5> str("ab");
+    EXPECT_TRUE(TryAppendFormat(str, "{}", 123));
+    EXPECT_EQ(str, "ab123");
+  }
+
+  // Overflow in the integer.
+  {
+    StaticString<5> str("ab");
+    EXPECT_FALSE(TryAppendFormat(str, "{}", 1234));
+    EXPECT_EQ(str, "ab");
+  }
+
+  // Overflow in the floating point value.
+  {
+    StaticString<5> str("ab");
+    EXPECT_FALSE(TryAppendFormat(str, "{}", 0.125));
+    EXPECT_EQ(str, "ab");
+  }
+
+  // Overflow in a string argument which follows successfully formatted text.
+  {
+    StaticString<5> str("ab");
+    EXPECT_FALSE(TryAppendFormat(str, "{}{}", 1, "long"));
+    EXPECT_EQ(str, "ab");
+  }
+
+  // Overflow in the literal text.
+  {
+    StaticString<5> str("ab");
+    EXPECT_FALSE(TryAppendFormat(str, "{} {{}}", 1));
+    EXPECT_EQ(str, "ab");
+  }
+
+  {
+    StaticString<5> str("ab");
+    EXPECT_THROW_OR_ABORT(AppendFormat(str, "{}", 1234), std::length_error);
+  }
+
+  EXPECT_THROW_OR_ABORT(Format<2>("{}", 100), std::length_error);
+}
+
+}  // namespace tiny_lib::static_string_format
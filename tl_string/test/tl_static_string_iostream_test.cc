@@ -0,0 +1,65 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_string/tl_static_string_iostream.h"
+
+#include <sstream>
+
+#include "tl_string/tl_static_string.h"
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::static_string {
+
+TEST(tl_static_string_iostream, PutToStream) {
+  std::stringstream os;
+  os << StaticString<24>("Hello, World!");
+  EXPECT_EQ(os.str(), "Hello, World!");
+}
+
+TEST(tl_static_string_iostream, PutToWideStream) {
+  std::wstringstream os;
+  os << BasicStaticString<wchar_t, 24>(L"Hello, World!");
+  EXPECT_EQ(os.str(), L"Hello, World!");
+}
+
+TEST(tl_static_string_iostream, PutConcatToStream) {
+  const StaticString<24> hello("Hello");
+  std::stringstream os;
+  os << hello + ", " + StaticString<24>("World") + '!';
+  EXPECT_EQ(os.str(), "Hello, World!");
+}
+
+TEST(tl_static_string_iostream, GetFromStream) {
+  std::stringstream is("Hello, World!");
+  StaticString<24> str;
+
+  is >> str;
+  EXPECT_EQ(str, "Hello,");
+
+  EXPECT_EQ(is.peek(), ' ');
+
+  is >> str;
+  EXPECT_EQ(str, "World!");
+}
+
+TEST(tl_static_string_iostream, GetFromStreamCapacity) {
+  std::stringstream is("Hello, World!");
+  StaticString<4> str;
+
+  is >> str;
+  EXPECT_EQ(str, "Hell");
+  EXPECT_EQ(is.peek(), 'o');
+}
+
+TEST(tl_static_string_iostream, GetFromStreamWidth) {
+  std::stringstream is("Hello, World!");
+  StaticString<24> str;
+
+  is.width(3);
+  is >> str;
+  EXPECT_EQ(str, "Hel");
+}
+
+}  // namespace tiny_lib::static_string
@@ -6,7 +6,6 @@
 
 #include <array>
 #include <cstring>
-#include <sstream>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -56,13 +55,32 @@ inline auto AsView(const StaticString<N>& str) -> std::string_view {
 }
 #endif
 
+// Get the string which is represented by the given string or concatenation
+// expression.
+template <class T>
+inline auto Evaluate(const T& str) -> const T& {
+  return str;
+}
+#if !USE_STD_STRING_REFERENCE
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+inline auto Evaluate(
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& concat)
+    -> BasicStaticString<CharT, N, Traits> {
+  return concat.str();
+}
+#endif
+
 // helper macro to test whether StaticString str matches the expected string.
 // Performs checks of both content and null-terminator.
+//
+// A concatenation expression is evaluated after the end of the full-expression
+// in which it is created, which checks that it does not refer to temporaries.
 #define EXPECT_STATIC_STR_EQ(str, expected)                                    \
   do {                                                                         \
     std::remove_reference_t<decltype(str)> local_str{str};                     \
-    EXPECT_EQ(AsView(local_str), expected);                                    \
-    EXPECT_EQ(local_str.data()[local_str.size()], '\0');                       \
+    const auto& local_value = Evaluate(local_str);                             \
+    EXPECT_EQ(AsView(local_value), expected);                                  \
+    EXPECT_EQ(local_value.data()[local_value.size()], '\0');                   \
   } while (false)
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2358,6 +2376,105 @@ TEST(tl_static_string, operator_add) {
   EXPECT_STATIC_STR_EQ('b' + foo, "bfoo");
 }
 
+TEST(tl_static_string, operator_add_chain) {
+  using StaticString = StaticString<16>;
+
+  const StaticString dir("/tmp");
+  const StaticString name("file");
+
+  // Chain of operands of all kinds.
+  {
+    const StaticString path = dir + '/' + name + ".txt";
+    EXPECT_STATIC_STR_EQ(path, "/tmp/file.txt");
+  }
+
+  // Operands on the left hand side of the expression.
+  {
+    const StaticString path = "x:" + ('/' + name);
+    EXPECT_STATIC_STR_EQ(path, "x:/file");
+  }
+  {
+    const StaticString path = '[' + (dir + ']');
+    EXPECT_STATIC_STR_EQ(path, "[/tmp]");
+  }
+
+  // Concatenation of two expressions.
+  {
+    const StaticString path = (dir + '/') + (name + '/');
+    EXPECT_STATIC_STR_EQ(path, "/tmp/file/");
+  }
+
+  // Assignment and comparison of the result.
+  {
+    StaticString path("old");
+    path = dir + '/' + name;
+    EXPECT_STATIC_STR_EQ(path, "/tmp/file");
+    EXPECT_EQ(StaticString(name + name), "filefile");
+  }
+
+  // Comparison of the expression.
+  {
+    EXPECT_TRUE((dir + name) == "/tmpfile");
+    EXPECT_TRUE("/tmpfile" == (dir + name));
+    EXPECT_TRUE((dir + name) == StaticString("/tmpfile"));
+    EXPECT_TRUE((dir + name) != "/tmp");
+    EXPECT_TRUE((dir + name) < "/tmpz");
+    EXPECT_TRUE((StaticString("a") + 'b') == "ab");
+  }
+
+  // Temporary operands are stored in the expression.
+  {
+    auto expression = StaticString("foo") + StaticString("bar");
+    const StaticString str = expression;
+    EXPECT_STATIC_STR_EQ(str, "foobar");
+
+    auto chain = dir + StaticString("/") + name;
+    EXPECT_STATIC_STR_EQ(chain, "/tmp/file");
+  }
+
+  // Read-only accessors of the expression.
+  {
+    const auto expression = dir + '/' + name;
+    EXPECT_EQ(expression.size(), 9);
+    EXPECT_EQ(expression.length(), 9);
+    EXPECT_FALSE(expression.empty());
+    EXPECT_TRUE((StaticString() + "").empty());
+    EXPECT_EQ(expression[0], '/');
+    EXPECT_EQ(expression[4], '/');
+    EXPECT_EQ(expression[8], 'e');
+    EXPECT_EQ(std::string(expression), "/tmp/file");
+  }
+
+#if !USE_STD_STRING_REFERENCE
+  // Explicit evaluation of the expression, which allows deduction of the
+  // capacity of the string.
+  {
+    const auto get_capacity =
+        []<std::size_t M>(const static_string::StaticString<M>& /*str*/) {
+          return M;
+        };
+    EXPECT_EQ(get_capacity((dir + name).str()), 16);
+    EXPECT_EQ((dir + name).max_size(), 16);
+    EXPECT_STATIC_STR_EQ((dir + name).str(), "/tmpfile");
+  }
+#endif
+
+  // The result does not fit into the capacity.
+  {
+    const StaticString long_name("0123456789");
+    EXPECT_THROW_OR_ABORT(StaticString(long_name + '/' + long_name),
+                          std::length_error);
+  }
+
+#if !USE_STD_STRING_REFERENCE
+  // Evaluation at compile time.
+  {
+    constexpr StaticString kPath = StaticString("a") + '/' + "b";
+    static_assert(std::string_view(kPath) == "a/b");
+  }
+#endif
+}
+
 TEST(tl_static_string, operator_equals) {
   using StaticString = StaticString<24>;
 
@@ -2428,25 +2545,6 @@ TEST(tl_static_string, erase_if) {
   }
 }
 
-TEST(tl_static_string, PutToStream) {
-  std::stringstream os;
-  os << StaticString<24>("Hello, World!");
-  EXPECT_EQ(os.str(), "Hello, World!");
-}
-
-TEST(tl_static_string, GetFromStream) {
-  std::stringstream is("Hello, World!");
-  StaticString<24> str;
-
-  is >> str;
-  EXPECT_EQ(str, "Hello,");
-
-  EXPECT_EQ(is.peek(), ' ');
-
-  is >> str;
-  EXPECT_EQ(str, "World!");
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 // Compile-time evaluations.
 
@@ -0,0 +1,154 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_string/tl_string_hash.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "tl_string/tl_cstring_view.h"
+#include "tl_string/tl_static_string.h"
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::string_hash {
+
+using cstring_view::CStringView;
+using static_string::StaticString;
+
+// Text which is long enough to cover all code paths of the hash.
+inline constexpr std::string_view kText =
+    "The quick brown fox jumps over the lazy dog. "
+    "Pack my box with five dozen liquor jugs. "
+    "How vexingly quick daft zebras jump!";
+
+template <std::size_t N>
+constexpr auto HashPrefixes(const std::string_view text)
+    -> std::array<uint64_t, N> {
+  std::array<uint64_t, N> hashes;
+  for (std::size_t i = 0; i < N; ++i) {
+    hashes[i] = HashString(text.substr(0, i));
+  }
+  return hashes;
+}
+
+TEST(tl_string_hash, ConstexprMatchesRuntime) {
+  constexpr std::size_t kNumPrefixes = 120;
+  static_assert(kText.size() >= kNumPrefixes);
+
+  constexpr std::array<uint64_t, kNumPrefixes> kHashes =
+      HashPrefixes<kNumPrefixes>(kText);
+
+  for (std::size_t i = 0; i < kNumPrefixes; ++i) {
+    const std::string prefix(kText.substr(0, i));
+    EXPECT_EQ(HashString(std::string_view(prefix)), kHashes[i]) << i;
+  }
+}
+
+TEST(tl_string_hash, StringViewLike) {
+  constexpr uint64_t kHash = HashString(std::string_view("open"));
+
+  static_assert(HashString(CStringView("open")) == kHash);
+  static_assert(HashString(StaticString<8>("open")) == kHash);
+  static_assert(HashString(CStringView("open"), 1) ==
+                HashString(std::string_view("open"), 1));
+
+  EXPECT_EQ(HashString(std::string("open")), kHash);
+}
+
+TEST(tl_string_hash, WideCharacters) {
+  constexpr std::u16string_view kWideText = u"Wide characters, 16 bits each.";
+  constexpr uint64_t kHash = HashString(kWideText);
+
+  const std::u16string text(kWideText);
+  EXPECT_EQ(HashString(std::u16string_view(text)), kHash);
+
+  // Strings with the same number of characters, but different bytes.
+  EXPECT_NE(HashString(std::u16string_view(u"\u0100")),
+            HashString(std::u16string_view(u"\u0001")));
+}
+
+TEST(tl_string_hash, Distribution) {
+  std::set<std::string> strings;
+
+  // All substrings of the text.
+  for (std::size_t start = 0; start < kText.size(); ++start) {
+    for (std::size_t length = 0; start + length <= kText.size(); ++length) {
+      strings.emplace(kText.substr(start, length));
+    }
+  }
+
+  // Strings which differ in a single bit.
+  for (int bit = 0; bit < 8 * 64; ++bit) {
+    std::string str(64, '\0');
+    str[bit / 8] = char(1 << (bit % 8));
+    strings.insert(str);
+  }
+
+  std::set<uint64_t> hashes;
+  for (const std::string& str : strings) {
+    hashes.insert(HashString(std::string_view(str)));
+  }
+
+  EXPECT_EQ(hashes.size(), strings.size());
+}
+
+TEST(tl_string_hash, Seed) {
+  const std::string_view str = "hello";
+  EXPECT_EQ(HashString(str, 1), HashString(str, 1));
+  EXPECT_NE(HashString(str, 1), HashString(str, 2));
+  EXPECT_NE(HashString(str, 0), HashString(str, 1));
+}
+
+TEST(tl_string_hash, StringHash) {
+  const StringHash hash;
+
+  const std::size_t expected_hash = hash(std::string_view("hello"));
+  EXPECT_EQ(hash("hello"), expected_hash);
+  EXPECT_EQ(hash(std::string("hello")), expected_hash);
+  EXPECT_EQ(hash(StaticString<8>("hello")), expected_hash);
+  EXPECT_EQ(hash(CStringView("hello")), expected_hash);
+
+  const StringEqual equal;
+  EXPECT_TRUE(equal(StaticString<8>("hello"), CStringView("hello")));
+  EXPECT_TRUE(equal(std::string("hello"), "hello"));
+  EXPECT_FALSE(equal(StaticString<8>("hello"), std::string_view("world")));
+}
+
+TEST(tl_string_hash, StdHash) {
+  const std::size_t expected_hash = StringHash()(std::string_view("hello"));
+
+  EXPECT_EQ(std::hash<StaticString<8>>()(StaticString<8>("hello")),
+            expected_hash);
+  EXPECT_EQ(std::hash<CStringView>()(CStringView("hello")), expected_hash);
+
+  // The default hasher of the standard containers.
+  std::unordered_set<StaticString<8>> set;
+  set.insert(StaticString<8>("hello"));
+  EXPECT_EQ(set.count(StaticString<8>("hello")), 1);
+  EXPECT_EQ(set.count(StaticString<8>("world")), 0);
+}
+
+TEST(tl_string_hash, HeterogeneousLookup) {
+  std::unordered_map<StaticString<16>, int, StringHash, StringEqual> map;
+  map.emplace("one", 1);
+  map.emplace("two", 2);
+
+  EXPECT_TRUE(map.contains(std::string_view("one")));
+  EXPECT_TRUE(map.contains(CStringView("two")));
+  EXPECT_TRUE(map.contains("one"));
+  EXPECT_FALSE(map.contains(std::string_view("three")));
+
+  const auto it = map.find(CStringView("two"));
+  ASSERT_NE(it, map.end());
+  EXPECT_EQ(it->second, 2);
+}
+
+}  // namespace tiny_lib::string_hash
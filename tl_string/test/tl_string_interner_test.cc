@@ -0,0 +1,134 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_string/tl_string_interner.h"
+
+#include <cstddef>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "tl_string/tl_static_string.h"
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::string_interner {
+
+using static_string::StaticString;
+
+TEST(tl_string_interner, Intern) {
+  StringInterner interner;
+
+  const CStringView a = interner.Intern("flac");
+  EXPECT_EQ(a, "flac");
+  EXPECT_EQ(a.c_str()[a.size()], '\0');
+
+  // Equal strings of different types share the same storage.
+  EXPECT_EQ(interner.Intern(std::string("flac")).data(), a.data());
+  EXPECT_EQ(interner.Intern(StaticString<8>("flac")).data(), a.data());
+  EXPECT_EQ(interner.Intern(CStringView("flac")).data(), a.data());
+
+  // The storage does not refer to the input.
+  std::string str = "vorbis";
+  const CStringView b = interner.Intern(str);
+  str = "opus";
+  EXPECT_EQ(b, "vorbis");
+  EXPECT_NE(b.data(), a.data());
+
+  // Empty string and strings with embedded null characters.
+  EXPECT_EQ(interner.Intern(""), "");
+  EXPECT_EQ(interner.Intern("").data(), interner.Intern("").data());
+  const std::string_view with_null("a\0b", 3);
+  EXPECT_EQ(interner.Intern(with_null).size(), 3);
+  EXPECT_NE(interner.Intern(with_null).data(), interner.Intern("a").data());
+
+  EXPECT_EQ(interner.GetNumStrings(), 5);
+}
+
+TEST(tl_string_interner, ID) {
+  StringInterner interner;
+
+  const StringID a = interner.InternID("alpha");
+  const StringID b = interner.InternID("beta");
+  EXPECT_NE(a, b);
+  EXPECT_EQ(interner.InternID("alpha"), a);
+
+  EXPECT_EQ(interner.GetString(a), "alpha");
+  EXPECT_EQ(interner.GetString(b), "beta");
+  EXPECT_EQ(interner.GetString(a).data(), interner.Intern("alpha").data());
+
+  const auto [view, id] = interner.InternWithID("beta");
+  EXPECT_EQ(view.data(), interner.GetString(b).data());
+  EXPECT_EQ(id, b);
+
+  EXPECT_THROW_OR_ABORT(interner.GetString(StringID(0xfffffff0)),
+                        std::out_of_range);
+}
+
+TEST(tl_string_interner, Many) {
+  StringInterner interner;
+
+  constexpr int kNumStrings = 10000;
+
+  std::vector<CStringView> views;
+  std::vector<StringID> ids;
+  for (int i = 0; i < kNumStrings; ++i) {
+    const std::string str = "string " + std::to_string(i);
+    views.push_back(interner.Intern(str));
+    ids.push_back(interner.InternID(str));
+  }
+
+  EXPECT_EQ(interner.GetNumStrings(), kNumStrings);
+
+  // All views stay valid as the interner grows.
+  std::set<StringID> unique_ids;
+  for (int i = 0; i < kNumStrings; ++i) {
+    const std::string str = "string " + std::to_string(i);
+    ASSERT_EQ(views[i], str);
+    ASSERT_EQ(interner.Intern(str).data(), views[i].data());
+    ASSERT_EQ(interner.GetString(ids[i]).data(), views[i].data());
+    unique_ids.insert(ids[i]);
+  }
+  EXPECT_EQ(unique_ids.size(), kNumStrings);
+}
+
+TEST(tl_string_interner, Upstream) {
+  std::pmr::monotonic_buffer_resource upstream;
+
+  StringInterner interner(&upstream);
+  EXPECT_EQ(interner.Intern("hello"), "hello");
+}
+
+TEST(tl_string_interner, Concurrent) {
+  constexpr int kNumThreads = 4;
+  constexpr int kNumStrings = 2000;
+
+  StringInterner interner;
+
+  // Every thread interns the same set of strings, in a different order.
+  std::vector<std::vector<const char*>> pointers(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&interner, &pointers, t]() {
+      pointers[t].resize(kNumStrings);
+      for (int j = 0; j < kNumStrings; ++j) {
+        const int i = (t % 2) ? (kNumStrings - 1 - j) : j;
+        pointers[t][i] = interner.Intern("key " + std::to_string(i)).data();
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(interner.GetNumStrings(), kNumStrings);
+  for (int t = 1; t < kNumThreads; ++t) {
+    EXPECT_EQ(pointers[t], pointers[0]);
+  }
+}
+
+}  // namespace tiny_lib::string_interner
@@ -0,0 +1,144 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_string/tl_string_split.h"
+
+#include <algorithm>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "tl_string/tl_cstring_view.h"
+#include "tl_string/tl_static_string.h"
+
+#include "tiny_lib/unittest/mock.h"
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::string_split {
+
+using cstring_view::CStringView;
+using static_string::StaticString;
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+namespace {
+
+template <class Range>
+auto Collect(Range&& range) -> std::vector<std::string_view> {
+  std::vector<std::string_view> fields;
+  for (const std::string_view field : range) {
+    fields.push_back(field);
+  }
+  return fields;
+}
+
+constexpr auto CountFields(const std::string_view str, const char delimiter)
+    -> int {
+  int count = 0;
+  for (const std::string_view field : Split(str, delimiter)) {
+    (void)field;
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace
+
+static_assert(std::ranges::forward_range<SplitRange<internal::CharDelimiter>>);
+static_assert(std::ranges::view<SplitRange<internal::AnyOfDelimiter>>);
+
+TEST(tl_string_split, SplitChar) {
+  EXPECT_THAT(Collect(Split("a,b,,c", ',')), ElementsAre("a", "b", "", "c"));
+  EXPECT_THAT(Collect(Split("abc", ',')), ElementsAre("abc"));
+  EXPECT_THAT(Collect(Split("", ',')), ElementsAre(""));
+  EXPECT_THAT(Collect(Split(",", ',')), ElementsAre("", ""));
+  EXPECT_THAT(Collect(Split(",a,", ',')), ElementsAre("", "a", ""));
+}
+
+TEST(tl_string_split, SplitString) {
+  EXPECT_THAT(Collect(Split("a::b::::c", "::")),
+              ElementsAre("a", "b", "", "c"));
+  EXPECT_THAT(Collect(Split("a:b", "::")), ElementsAre("a:b"));
+  EXPECT_THAT(Collect(Split("a:::b", "::")), ElementsAre("a", ":b"));
+
+  // Empty delimiter does not split.
+  EXPECT_THAT(Collect(Split("abc", "")), ElementsAre("abc"));
+}
+
+TEST(tl_string_split, SplitAny) {
+  EXPECT_THAT(Collect(SplitAny("a b\tc\n", " \t\n")),
+              ElementsAre("a", "b", "c", ""));
+  EXPECT_THAT(Collect(SplitAny("/usr\\local/bin", "/\\")),
+              ElementsAre("", "usr", "local", "bin"));
+  EXPECT_THAT(Collect(SplitAny("abc", "")), ElementsAre("abc"));
+
+  // Non-ASCII characters in the set.
+  EXPECT_THAT(Collect(SplitAny("a\xff" "b\x80" "c", "\x80\xff")),
+              ElementsAre("a", "b", "c"));
+}
+
+TEST(tl_string_split, SkipEmpty) {
+  const SplitOptions options{.skip_empty = true};
+
+  EXPECT_THAT(Collect(Split(",,a,,b,,", ',', options)), ElementsAre("a", "b"));
+  EXPECT_THAT(Collect(Split("", ',', options)), IsEmpty());
+  EXPECT_THAT(Collect(Split(",,,", ',', options)), IsEmpty());
+  EXPECT_THAT(Collect(SplitAny("  ls   -l\t/tmp ", " \t", options)),
+              ElementsAre("ls", "-l", "/tmp"));
+}
+
+TEST(tl_string_split, Trim) {
+  EXPECT_THAT(Collect(Split(" a , b\t,,\r\nc ", ',', {.trim = true})),
+              ElementsAre("a", "b", "", "c"));
+  EXPECT_THAT(
+      Collect(Split(" a , ,  ,b ", ',', {.skip_empty = true, .trim = true})),
+      ElementsAre("a", "b"));
+}
+
+TEST(tl_string_split, StringTypes) {
+  const StaticString<16> static_string("x/y/z");
+  EXPECT_THAT(Collect(Split(static_string, '/')), ElementsAre("x", "y", "z"));
+
+  const CStringView cstring_view("key=value");
+  EXPECT_THAT(Collect(Split(cstring_view, '=')), ElementsAre("key", "value"));
+
+  // Fields point into the original string.
+  const std::string str = "ab,cd";
+  const std::vector<std::string_view> fields = Collect(Split(str, ','));
+  ASSERT_EQ(fields.size(), 2);
+  EXPECT_EQ(fields[0].data(), str.data());
+  EXPECT_EQ(fields[1].data(), str.data() + 3);
+}
+
+TEST(tl_string_split, Iterator) {
+  const auto range = Split("a,b", ',');
+
+  auto it = range.begin();
+  auto it_copy = it;
+  EXPECT_EQ(it, it_copy);
+  EXPECT_EQ(*it, "a");
+  EXPECT_EQ(it->size(), 1);
+
+  EXPECT_EQ(*it++, "a");
+  EXPECT_NE(it, it_copy);
+  EXPECT_EQ(*it, "b");
+
+  ++it;
+  EXPECT_EQ(it, range.end());
+  EXPECT_EQ(it, decltype(it)());
+
+  // Works with the standard algorithms and views.
+  EXPECT_EQ(std::ranges::distance(Split("a,b,c,d", ',')), 4);
+  EXPECT_THAT(Collect(Split("1,2,3", ',') | std::views::drop(1)),
+              ElementsAre("2", "3"));
+  EXPECT_EQ(Split("a,b", ',').front(), "a");
+}
+
+TEST(tl_string_split, Constexpr) {
+  static_assert(CountFields("a,b,c", ',') == 3);
+  static_assert(CountFields("", ',') == 1);
+}
+
+}  // namespace tiny_lib::string_split
@@ -0,0 +1,99 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_string/tl_string_switch.h"
+
+#include <string>
+#include <string_view>
+
+#include "tl_string/tl_cstring_view.h"
+#include "tl_string/tl_static_string.h"
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::string_switch {
+
+using cstring_view::CStringView;
+using static_string::StaticString;
+
+namespace {
+
+constexpr auto kCommands = MakeStringSwitch("open", "close", "read", "write");
+
+auto Dispatch(const std::string_view command) -> int {
+  switch (kCommands.Find(command)) {
+    case kCommands.IndexOf("open"): return 1;
+    case kCommands.IndexOf("close"): return 2;
+    case kCommands.IndexOf("read"): return 3;
+    case kCommands.IndexOf("write"): return 4;
+    case kCommands.kNotFound: return 0;
+  }
+  return -1;
+}
+
+}  // namespace
+
+TEST(tl_string_switch, Find) {
+  EXPECT_EQ(kCommands.size(), 4);
+
+  EXPECT_EQ(kCommands.Find("open"), 0);
+  EXPECT_EQ(kCommands.Find("close"), 1);
+  EXPECT_EQ(kCommands.Find("read"), 2);
+  EXPECT_EQ(kCommands.Find("write"), 3);
+
+  EXPECT_EQ(kCommands.Find(""), kCommands.kNotFound);
+  EXPECT_EQ(kCommands.Find("ope"), kCommands.kNotFound);
+  EXPECT_EQ(kCommands.Find("opens"), kCommands.kNotFound);
+  EXPECT_EQ(kCommands.Find("OPEN"), kCommands.kNotFound);
+
+  EXPECT_EQ(kCommands.GetKey(1), "close");
+}
+
+TEST(tl_string_switch, Switch) {
+  EXPECT_EQ(Dispatch("open"), 1);
+  EXPECT_EQ(Dispatch("close"), 2);
+  EXPECT_EQ(Dispatch("read"), 3);
+  EXPECT_EQ(Dispatch("write"), 4);
+  EXPECT_EQ(Dispatch("seek"), 0);
+}
+
+TEST(tl_string_switch, StringTypes) {
+  EXPECT_EQ(kCommands.Find(CStringView("read")), 2);
+  EXPECT_EQ(kCommands.Find(StaticString<8>("write")), 3);
+  EXPECT_EQ(kCommands.Find(std::string("close")), 1);
+
+  // Keys of different types which refer to string literals.
+  constexpr auto kSwitch =
+      MakeStringSwitch(CStringView("a"), std::string_view("b"), "c");
+  EXPECT_EQ(kSwitch.Find("b"), 1);
+  EXPECT_EQ(kSwitch.Find(CStringView("c")), 2);
+}
+
+TEST(tl_string_switch, Constexpr) {
+  static_assert(kCommands.Find("write") == 3);
+  static_assert(kCommands.Find("seek") == kCommands.kNotFound);
+  static_assert(kCommands.IndexOf("read") == 2);
+
+  static_assert(MakeStringSwitch("single").Find("single") == 0);
+}
+
+TEST(tl_string_switch, Many) {
+  // Chunk identifiers of the RIFF-based file formats.
+  constexpr auto kChunks = MakeStringSwitch(
+      "RIFF", "LIST", "WAVE", "fmt ", "data", "fact", "cue ", "plst", "labl",
+      "note", "ltxt", "smpl", "inst", "INFO", "IART", "ICMT", "ICOP", "ICRD",
+      "IENG", "IGNR", "IKEY", "IMED", "INAM", "IPRD", "ISBJ", "ISFT", "ISRC",
+      "ISRF", "ITCH", "bext", "iXML", "axml", "JUNK", "PAD ", "ds64", "RF64",
+      "id3 ", "ID3 ", "AVI ", "hdrl", "avih", "strl", "strh", "strf", "movi",
+      "idx1", "odml", "dmlh");
+
+  for (std::size_t i = 0; i < kChunks.size(); ++i) {
+    EXPECT_EQ(kChunks.Find(kChunks.GetKey(i)), i) << kChunks.GetKey(i);
+  }
+
+  EXPECT_EQ(kChunks.Find("riff"), kChunks.kNotFound);
+  EXPECT_EQ(kChunks.Find("fmt"), kChunks.kNotFound);
+}
+
+}  // namespace tiny_lib::string_switch
@@ -0,0 +1,216 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+#include "tl_string/tl_utf8.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include "tl_string/tl_static_string.h"
+
+#include "tiny_lib/unittest/test.h"
+
+namespace tiny_lib::utf8 {
+
+using static_string::BasicStaticString;
+
+namespace {
+
+// Text which has characters of all encoded lengths: "A", "ё", "要", and "𝄞".
+constexpr std::string_view kMixed = "A\xd1\x91\xe8\xa6\x81\xf0\x9d\x84\x9e";
+constexpr std::u16string_view kMixed16 = u"Aё要\U0001D11E";
+constexpr std::u32string_view kMixed32 = U"Aё要\U0001D11E";
+
+// Construct text from the given number of ASCII characters followed by the
+// given suffix, so that the suffix lands on different positions within the
+// blocks processed by the vector code.
+auto MakeText(const std::size_t num_ascii, const std::string_view suffix)
+    -> std::string {
+  std::string text;
+  for (std::size_t i = 0; i < num_ascii; ++i) {
+    text += char('a' + i % 26);
+  }
+  text += suffix;
+  return text;
+}
+
+}  // namespace
+
+TEST(tl_utf8, IsValid) {
+  EXPECT_TRUE(IsValidUTF8(""));
+  EXPECT_TRUE(IsValidUTF8("Hello, World!"));
+  EXPECT_TRUE(IsValidUTF8(kMixed));
+  EXPECT_TRUE(IsValidUTF8(std::string_view("\0", 1)));
+
+  // Boundaries of the code point ranges.
+  EXPECT_TRUE(IsValidUTF8("\x7f"));
+  EXPECT_TRUE(IsValidUTF8("\xc2\x80"));
+  EXPECT_TRUE(IsValidUTF8("\xdf\xbf"));
+  EXPECT_TRUE(IsValidUTF8("\xe0\xa0\x80"));
+  EXPECT_TRUE(IsValidUTF8("\xed\x9f\xbf"));
+  EXPECT_TRUE(IsValidUTF8("\xee\x80\x80"));
+  EXPECT_TRUE(IsValidUTF8("\xef\xbf\xbf"));
+  EXPECT_TRUE(IsValidUTF8("\xf0\x90\x80\x80"));
+  EXPECT_TRUE(IsValidUTF8("\xf4\x8f\xbf\xbf"));
+
+  // Unexpected continuation bytes.
+  EXPECT_FALSE(IsValidUTF8("\x80"));
+  EXPECT_FALSE(IsValidUTF8("\xbf"));
+
+  // Overlong encodings.
+  EXPECT_FALSE(IsValidUTF8("\xc0\xaf"));
+  EXPECT_FALSE(IsValidUTF8("\xc1\xbf"));
+  EXPECT_FALSE(IsValidUTF8("\xe0\x9f\xbf"));
+  EXPECT_FALSE(IsValidUTF8("\xf0\x8f\xbf\xbf"));
+
+  // Surrogates.
+  EXPECT_FALSE(IsValidUTF8("\xed\xa0\x80"));
+  EXPECT_FALSE(IsValidUTF8("\xed\xbf\xbf"));
+
+  // Above U+10FFFF.
+  EXPECT_FALSE(IsValidUTF8("\xf4\x90\x80\x80"));
+  EXPECT_FALSE(IsValidUTF8("\xf5\x80\x80\x80"));
+  EXPECT_FALSE(IsValidUTF8("\xff"));
+
+  // Truncated and interrupted sequences.
+  EXPECT_FALSE(IsValidUTF8("\xc2"));
+  EXPECT_FALSE(IsValidUTF8("\xe8\xa6"));
+  EXPECT_FALSE(IsValidUTF8("\xf0\x9d\x84"));
+  EXPECT_FALSE(IsValidUTF8("\xe8" "a" "\x81"));
+}
+
+TEST(tl_utf8, FindInvalid) {
+  EXPECT_EQ(FindInvalidUTF8(kMixed), std::string_view::npos);
+
+  // Invalid byte at every position relative to the blocks.
+  for (std::size_t num_ascii = 0; num_ascii < 40; ++num_ascii) {
+    const std::string text = MakeText(num_ascii, "\xd1\x91\xff" "abc");
+    EXPECT_EQ(FindInvalidUTF8(text), num_ascii + 2) << num_ascii;
+
+    const std::string truncated = MakeText(num_ascii, "\xe8\xa6");
+    EXPECT_EQ(FindInvalidUTF8(truncated), num_ascii) << num_ascii;
+  }
+}
+
+TEST(tl_utf8, Length) {
+  EXPECT_EQ(GetUTF16Length(""), 0);
+  EXPECT_EQ(GetUTF16Length(kMixed), kMixed16.size());
+  EXPECT_EQ(GetUTF32Length(kMixed), kMixed32.size());
+  EXPECT_EQ(GetUTF16Length(MakeText(37, "")), 37);
+
+  EXPECT_EQ(GetUTF16Length("\xff"), std::string_view::npos);
+  EXPECT_EQ(GetUTF32Length("\xc2"), std::string_view::npos);
+}
+
+TEST(tl_utf8, ConvertToUTF16) {
+  for (std::size_t num_ascii = 0; num_ascii < 40; ++num_ascii) {
+    const std::string text = MakeText(num_ascii, kMixed);
+
+    std::u16string expected;
+    for (const char ch : MakeText(num_ascii, "")) {
+      expected += char16_t(ch);
+    }
+    expected += kMixed16;
+
+    std::array<char16_t, 64> buffer;
+    const TranscodeResult result = ConvertUTF8ToUTF16(text, buffer);
+    ASSERT_EQ(result.ec, std::errc()) << num_ascii;
+    EXPECT_EQ(std::u16string_view(buffer.data(), result.size), expected)
+        << num_ascii;
+  }
+}
+
+TEST(tl_utf8, ConvertToUTF32) {
+  for (std::size_t num_ascii = 0; num_ascii < 40; ++num_ascii) {
+    const std::string text = MakeText(num_ascii, kMixed);
+
+    std::u32string expected;
+    for (const char ch : MakeText(num_ascii, "")) {
+      expected += char32_t(ch);
+    }
+    expected += kMixed32;
+
+    std::array<char32_t, 64> buffer;
+    const TranscodeResult result = ConvertUTF8ToUTF32(text, buffer);
+    ASSERT_EQ(result.ec, std::errc()) << num_ascii;
+    EXPECT_EQ(std::u32string_view(buffer.data(), result.size), expected)
+        << num_ascii;
+  }
+}
+
+TEST(tl_utf8, ConvertErrors) {
+  // Invalid input.
+  {
+    std::array<char16_t, 16> buffer;
+    const TranscodeResult result = ConvertUTF8ToUTF16("ab\xc0\xaf", buffer);
+    EXPECT_EQ(result.ec, std::errc::illegal_byte_sequence);
+    EXPECT_EQ(result.size, 2);
+  }
+
+  // Destination is too small.
+  {
+    std::array<char16_t, 4> buffer;
+    const TranscodeResult result = ConvertUTF8ToUTF16("abcde", buffer);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.size, 4);
+  }
+
+  // No space for the second code unit of a surrogate pair.
+  {
+    std::array<char16_t, 2> buffer;
+    const TranscodeResult result =
+        ConvertUTF8ToUTF16("a\xf0\x9d\x84\x9e", buffer);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.size, 1);
+  }
+
+  // Destination is too small for the ASCII block.
+  {
+    std::array<char32_t, 20> buffer;
+    const TranscodeResult result = ConvertUTF8ToUTF32(MakeText(32, ""), buffer);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.size, 20);
+  }
+}
+
+TEST(tl_utf8, ConvertToWide) {
+  std::array<wchar_t, 16> buffer;
+  const TranscodeResult result = ConvertUTF8ToWide(kMixed, buffer);
+  ASSERT_EQ(result.ec, std::errc());
+  EXPECT_EQ(std::wstring_view(buffer.data(), result.size),
+            L"Aё要\U0001D11E");
+}
+
+TEST(tl_utf8, AssignFromUTF8) {
+  {
+    BasicStaticString<char16_t, 8> str;
+    EXPECT_TRUE(AssignFromUTF8(str, kMixed));
+    EXPECT_EQ(std::u16string_view(str), kMixed16);
+  }
+
+  {
+    std::u32string str;
+    EXPECT_TRUE(AssignFromUTF8(str, kMixed));
+    EXPECT_EQ(str, kMixed32);
+  }
+
+  // Invalid input keeps the string unchanged.
+  {
+    std::u16string str = u"keep";
+    EXPECT_FALSE(AssignFromUTF8(str, "\xff"));
+    EXPECT_EQ(str, u"keep");
+  }
+
+  // Does not fit.
+  {
+    BasicStaticString<char16_t, 4> str(u"keep");
+    EXPECT_FALSE(AssignFromUTF8(str, kMixed));
+    EXPECT_EQ(std::u16string_view(str), u"keep");
+  }
+}
+
+}  // namespace tiny_lib::utf8
@@ -0,0 +1,333 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Locale-independent case conversion and case-insensitive comparison of ASCII
+// strings.
+//
+// Only the Latin letters A-Z and a-z are affected by the functions: all other
+// bytes, including bytes of multi-byte UTF-8 sequences, are kept as-is. This
+// makes the functions suitable for matching of identifiers, header names, and
+// chunk IDs in file formats, where std::tolower() is both slow and has a
+// behavior which depends on the current locale.
+//
+// The functions accept std::string_view and std::span<char>, so they work with
+// the std::string, BasicStaticString, and BasicCStringView:
+//
+//   StaticString<16> str("Content-Type");
+//   ToLowerASCII(str);
+//   EqualsIgnoreCaseASCII(str, CStringView("CONTENT-TYPE"));
+//
+// Conversion to a destination writes exactly src.size() characters and the
+// destination is allowed to be the same as the source:
+//
+//   StaticString<16> lower;
+//   lower.resize_and_overwrite(src.size(), [&](char* dst, std::size_t n) {
+//     ToLowerASCII(src, dst);
+//     return n;
+//   });
+//
+// At run time the strings are processed 16 bytes at a time using SSE2 or NEON
+// instructions when they are available: a letter is detected with a single
+// range check, and its case is flipped by toggling the 0x20 bit. The remaining
+// bytes are processed one at a time. All functions are also usable in constant
+// expressions.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "tl_build_config/tl_build_config.h"
+
+// Semantic version of the tl_ascii_case library.
+#define TL_ASCII_CASE_VERSION_MAJOR 0
+#define TL_ASCII_CASE_VERSION_MINOR 0
+#define TL_ASCII_CASE_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_ASCII_CASE_NAMESPACE
+#  define TL_ASCII_CASE_NAMESPACE tiny_lib::ascii_case
+#endif
+
+// Helpers for TL_ASCII_CASE_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_ASCII_CASE_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)           \
+  v_##id1##_##id2##_##id3
+#define TL_ASCII_CASE_VERSION_NAMESPACE_CONCAT(id1, id2, id3)                  \
+  TL_ASCII_CASE_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_ASCII_CASE_VERSION_NAMESPACE -> v_0_1_9
+#define TL_ASCII_CASE_VERSION_NAMESPACE                                        \
+  TL_ASCII_CASE_VERSION_NAMESPACE_CONCAT(TL_ASCII_CASE_VERSION_MAJOR,          \
+                                         TL_ASCII_CASE_VERSION_MINOR,          \
+                                         TL_ASCII_CASE_VERSION_REVISION)
+
+// The vector code follows the instruction sets the compiler is allowed to use,
+// as detected by the tl_build_config. The application can define these to 0
+// prior to including this header to force the use of the portable code.
+#if !defined(TL_ASCII_CASE_USE_SSE2)
+#  define TL_ASCII_CASE_USE_SSE2 ISA_CPU_X86_SSE2
+#endif
+#if !defined(TL_ASCII_CASE_USE_NEON)
+#  define TL_ASCII_CASE_USE_NEON (ISA_CPU_ARM_NEON && ARCH_CPU_LITTLE_ENDIAN)
+#endif
+
+#if TL_ASCII_CASE_USE_SSE2
+#  include <emmintrin.h>
+#elif TL_ASCII_CASE_USE_NEON
+#  include <arm_neon.h>
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_ASCII_CASE_NAMESPACE {
+inline namespace TL_ASCII_CASE_VERSION_NAMESPACE {
+
+// Convert a single character.
+inline constexpr auto ToLowerASCII(const char ch) -> char {
+  return (ch >= 'A' && ch <= 'Z') ? char(ch ^ 0x20) : ch;
+}
+inline constexpr auto ToUpperASCII(const char ch) -> char {
+  return (ch >= 'a' && ch <= 'z') ? char(ch ^ 0x20) : ch;
+}
+
+namespace internal {
+
+#if TL_ASCII_CASE_USE_SSE2 || TL_ASCII_CASE_USE_NEON
+inline constexpr bool kHasVector = true;
+#else
+inline constexpr bool kHasVector = false;
+#endif
+
+// Number of bytes processed by a single vector instruction.
+inline constexpr std::size_t kVectorWidth = 16;
+
+#if TL_ASCII_CASE_USE_SSE2
+
+using Vector = __m128i;
+
+inline auto Load(const char* src) -> Vector {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+inline void Store(char* dst, const Vector v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+}
+
+// Flip the case of all bytes which are in the [first, first + 25] range.
+//
+// SSE2 only has signed byte comparison, so the range is shifted to start at
+// -128, which allows to check both of its ends with a single comparison.
+template <char kFirst>
+inline auto FlipCaseInRange(const Vector v) -> Vector {
+  const Vector shifted = _mm_add_epi8(v, _mm_set1_epi8(char(0x80 - kFirst)));
+  const Vector in_range = _mm_cmplt_epi8(shifted, _mm_set1_epi8(-128 + 26));
+  return _mm_xor_si128(v, _mm_and_si128(in_range, _mm_set1_epi8(0x20)));
+}
+
+// Bit mask with a bit set for every byte which is equal in a and b.
+inline auto EqualMask(const Vector a, const Vector b) -> uint64_t {
+  return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+}
+
+// Number of bits in the EqualMask() per byte.
+inline constexpr int kEqualMaskBitsPerByte = 1;
+inline constexpr uint64_t kEqualMaskAll = 0xffff;
+
+#elif TL_ASCII_CASE_USE_NEON
+
+using Vector = uint8x16_t;
+
+inline auto Load(const char* src) -> Vector {
+  return vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+}
+
+inline void Store(char* dst, const Vector v) {
+  vst1q_u8(reinterpret_cast<uint8_t*>(dst), v);
+}
+
+// Flip the case of all bytes which are in the [first, first + 25] range.
+template <char kFirst>
+inline auto FlipCaseInRange(const Vector v) -> Vector {
+  const Vector shifted = vsubq_u8(v, vdupq_n_u8(uint8_t(kFirst)));
+  const Vector in_range = vcleq_u8(shifted, vdupq_n_u8(25));
+  return veorq_u8(v, vandq_u8(in_range, vdupq_n_u8(0x20)));
+}
+
+// Bit mask with bits set for every byte which is equal in a and b.
+//
+// NEON does not have an equivalent of the movemask, so the comparison result
+// is narrowed to 4 bits per byte.
+inline auto EqualMask(const Vector a, const Vector b) -> uint64_t {
+  const uint8x8_t narrowed =
+      vshrn_n_u16(vreinterpretq_u16_u8(vceqq_u8(a, b)), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+// Number of bits in the EqualMask() per byte.
+inline constexpr int kEqualMaskBitsPerByte = 4;
+inline constexpr uint64_t kEqualMaskAll = ~uint64_t(0);
+
+#endif
+
+// Convert case of the characters from src to dst using vector instructions
+// for as many full vectors as possible.
+// Returns the number of processed characters.
+template <char kFirst>
+inline auto ConvertVector(const char* src, char* dst, const std::size_t size)
+    -> std::size_t {
+  std::size_t i = 0;
+#if TL_ASCII_CASE_USE_SSE2 || TL_ASCII_CASE_USE_NEON
+  for (; i + kVectorWidth <= size; i += kVectorWidth) {
+    Store(dst + i, FlipCaseInRange<kFirst>(Load(src + i)));
+  }
+#else
+  (void)src;
+  (void)dst;
+  (void)size;
+#endif
+  return i;
+}
+
+// Find index of the first character which differs in a and b after they are
+// converted to lower case, checking as many full vectors as possible.
+// Returns the index of the first difference if it is within the checked
+// vectors. Otherwise returns the number of checked characters, which is the
+// size rounded down to the vector width, and the characters past it are to be
+// checked by the caller.
+inline auto MismatchIgnoreCaseVector(const char* a,
+                                     const char* b,
+                                     const std::size_t size) -> std::size_t {
+  std::size_t i = 0;
+#if TL_ASCII_CASE_USE_SSE2 || TL_ASCII_CASE_USE_NEON
+  for (; i + kVectorWidth <= size; i += kVectorWidth) {
+    const uint64_t mask = EqualMask(FlipCaseInRange<'A'>(Load(a + i)),
+                                    FlipCaseInRange<'A'>(Load(b + i)));
+    if (mask != kEqualMaskAll) {
+      return i + std::countr_one(mask) / kEqualMaskBitsPerByte;
+    }
+  }
+#else
+  (void)a;
+  (void)b;
+  (void)size;
+#endif
+  return i;
+}
+
+template <char kFirst>
+constexpr void Convert(const char* src, char* dst, const std::size_t size) {
+  std::size_t i = 0;
+  if (kHasVector && !std::is_constant_evaluated()) {
+    i = ConvertVector<kFirst>(src, dst, size);
+  }
+  for (; i < size; ++i) {
+    const char ch = src[i];
+    dst[i] = (ch >= kFirst && ch <= kFirst + 25) ? char(ch ^ 0x20) : ch;
+  }
+}
+
+// Index of the first character which differs in a and b after they are
+// converted to lower case, or size if there is no such character.
+constexpr auto MismatchIgnoreCase(const char* a,
+                                  const char* b,
+                                  const std::size_t size) -> std::size_t {
+  std::size_t i = 0;
+  if (kHasVector && !std::is_constant_evaluated()) {
+    i = MismatchIgnoreCaseVector(a, b, size);
+  }
+  for (; i < size; ++i) {
+    if (ToLowerASCII(a[i]) != ToLowerASCII(b[i])) {
+      break;
+    }
+  }
+  return i;
+}
+
+}  // namespace internal
+
+// Convert all ASCII letters of the string to the lower or upper case in place.
+inline constexpr void ToLowerASCII(const std::span<char> str) {
+  internal::Convert<'A'>(str.data(), str.data(), str.size());
+}
+inline constexpr void ToUpperASCII(const std::span<char> str) {
+  internal::Convert<'a'>(str.data(), str.data(), str.size());
+}
+
+// Write src with all ASCII letters converted to the lower or upper case to
+// the dst. The dst is to have space for at least src.size() characters, and is
+// allowed to be the same as src.data().
+//
+// Returns pointer past the last written character.
+inline constexpr auto ToLowerASCII(const std::string_view src, char* dst)
+    -> char* {
+  internal::Convert<'A'>(src.data(), dst, src.size());
+  return dst + src.size();
+}
+inline constexpr auto ToUpperASCII(const std::string_view src, char* dst)
+    -> char* {
+  internal::Convert<'a'>(src.data(), dst, src.size());
+  return dst + src.size();
+}
+
+// Check whether the strings are equal, ignoring the case of ASCII letters.
+inline constexpr auto EqualsIgnoreCaseASCII(const std::string_view a,
+                                            const std::string_view b)
+    -> bool {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  return internal::MismatchIgnoreCase(a.data(), b.data(), a.size()) ==
+         a.size();
+}
+
+// Lexicographically compare the strings, ignoring the case of ASCII letters.
+// The letters are compared as if they were converted to the lower case, and
+// the characters are compared as unsigned values.
+//
+// Returns a negative value if a is ordered before b, zero if the strings are
+// equal, and a positive value if a is ordered after b.
+inline constexpr auto CompareIgnoreCaseASCII(const std::string_view a,
+                                             const std::string_view b) -> int {
+  const std::size_t size = a.size() < b.size() ? a.size() : b.size();
+  const std::size_t i = internal::MismatchIgnoreCase(a.data(), b.data(), size);
+  if (i != size) {
+    return int(uint8_t(ToLowerASCII(a[i]))) - int(uint8_t(ToLowerASCII(b[i])));
+  }
+  if (a.size() == b.size()) {
+    return 0;
+  }
+  return a.size() < b.size() ? -1 : 1;
+}
+
+}  // namespace TL_ASCII_CASE_VERSION_NAMESPACE
+}  // namespace TL_ASCII_CASE_NAMESPACE
+
+#undef TL_ASCII_CASE_VERSION_MAJOR
+#undef TL_ASCII_CASE_VERSION_MINOR
+#undef TL_ASCII_CASE_VERSION_REVISION
+
+#undef TL_ASCII_CASE_VERSION_NAMESPACE
+
+#undef TL_ASCII_CASE_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_ASCII_CASE_VERSION_NAMESPACE_CONCAT
+#undef TL_ASCII_CASE_NAMESPACE
+
+#undef TL_ASCII_CASE_USE_SSE2
+#undef TL_ASCII_CASE_USE_NEON
@@ -11,6 +11,10 @@
 // possible out of bounds access, and allows to cheaply access the length of the
 // string.
 //
+// The std::hash is specialized for the BasicCStringView using the hash from the
+// tl_string_hash library, so the hash of a view matches the hash of a string
+// with the same content computed by the StringHash.
+//
 // It is inspired by
 //
 //   Andrew Tomazos
@@ -32,6 +36,7 @@
 // Version history
 // ===============
 //
+//   0.0.2-alpha    (18 Oct 2026)    Specialize std::hash.
 //   0.0.1-alpha    (28 Dec 2023)    First public release.
 
 #pragma once
@@ -42,10 +47,12 @@
 #include <string_view>
 #include <type_traits>
 
+#include "tl_string_hash.h"
+
 // Semantic version of the tl_cstring_view library.
 #define TL_CSTRING_VIEW_VERSION_MAJOR 0
 #define TL_CSTRING_VIEW_VERSION_MINOR 0
-#define TL_CSTRING_VIEW_VERSION_REVISION 1
+#define TL_CSTRING_VIEW_VERSION_REVISION 2
 
 // Namespace of the module.
 // The outer name spaces which surrounds the ABI-version namespace.
@@ -53,6 +60,13 @@
 #  define TL_CSTRING_VIEW_NAMESPACE tiny_lib::cstring_view
 #endif
 
+// Namespace in which the string hash is defined.
+// Is to be defined when the tl_string_hash library is configured to use a
+// non-default namespace.
+#ifndef TL_CSTRING_VIEW_STRING_HASH_NAMESPACE
+#  define TL_CSTRING_VIEW_STRING_HASH_NAMESPACE tiny_lib::string_hash
+#endif
+
 // Helpers for TL_CSTRING_VIEW_VERSION_NAMESPACE.
 //
 // Typical extra indirection for such conversion to allow macro to be expanded
@@ -730,6 +744,13 @@ using CStringView = BasicCStringView<char, std::char_traits<char>>;
 }  // namespace TL_CSTRING_VIEW_VERSION_NAMESPACE
 }  // namespace TL_CSTRING_VIEW_NAMESPACE
 
+// Hash support for BasicCStringView.
+// The hasher is transparent: it accepts any type convertible to a string view.
+template <class CharT, class Traits>
+struct std::hash<TL_CSTRING_VIEW_NAMESPACE::BasicCStringView<CharT, Traits>>
+    : public TL_CSTRING_VIEW_STRING_HASH_NAMESPACE::BasicStringHash<CharT,
+                                                                   Traits> {};
+
 #undef TL_CSTRING_VIEW_VERSION_MAJOR
 #undef TL_CSTRING_VIEW_VERSION_MINOR
 #undef TL_CSTRING_VIEW_VERSION_REVISION
@@ -739,5 +760,6 @@ using CStringView = BasicCStringView<char, std::char_traits<char>>;
 #undef TL_CSTRING_VIEW_VERSION_NAMESPACE_CONCAT_HELPER
 #undef TL_CSTRING_VIEW_VERSION_NAMESPACE_CONCAT
 #undef TL_CSTRING_VIEW_NAMESPACE
+#undef TL_CSTRING_VIEW_STRING_HASH_NAMESPACE
 
 #undef TL_CSTRING_VIEW_THROW_IF
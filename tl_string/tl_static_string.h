@@ -7,6 +7,14 @@
 // Static string implements C++ string API and used in-object storage of a
 // static size. No allocations will happen be performed by the static string.
 //
+// The std::hash is specialized for the BasicStaticString using the hash from
+// the tl_string_hash library. The hash is transparent, and together with the
+// StringEqual allows heterogeneous lookup in the unordered containers.
+//
+// The stream input and output operators are defined in the
+// tl_static_string_iostream.h, which keeps this header free from the <istream>,
+// <ostream>, and <locale>.
+//
 //
 // Exceptions
 // ==========
@@ -23,6 +31,19 @@
 // Version history
 // ===============
 //
+//   0.0.6-alpha    (19 Oct 2026)    Store temporary operands of operator+ by
+//                                   value, compare concatenation expressions,
+//                                   add str() and read-only accessors to them.
+//   0.0.5-alpha    (19 Oct 2026)    Move stream operators to the
+//                                   tl_static_string_iostream.h.
+//   0.0.4-alpha    (18 Oct 2026)    Lazy concatenation with operator+.
+//                                   Breaks source compatibility: the result of
+//                                   operator+ is an expression, so it does not
+//                                   deduce StaticString template arguments and
+//                                   has no string member functions.
+//   0.0.3-alpha    (18 Oct 2026)    Fix uninitialized size when the operation
+//                                   of resize_and_overwrite() throws.
+//   0.0.2-alpha    (18 Oct 2026)    Specialize std::hash.
 //   0.0.1-alpha    (28 Dec 2023)    First public release.
 
 #pragma once
@@ -31,18 +52,18 @@
 #include <cassert>
 #include <cstddef>
 #include <initializer_list>
-#include <istream>
 #include <iterator>
-#include <locale>
-#include <ostream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
+#include "tl_string_hash.h"
+
 // Semantic version of the tl_static_string library.
 #define TL_STATIC_STRING_VERSION_MAJOR 0
 #define TL_STATIC_STRING_VERSION_MINOR 0
-#define TL_STATIC_STRING_VERSION_REVISION 1
+#define TL_STATIC_STRING_VERSION_REVISION 6
 
 // Namespace of the module.
 // The outer name spaces which surrounds the ABI-version namespace.
@@ -50,6 +71,13 @@
 #  define TL_STATIC_STRING_NAMESPACE tiny_lib::static_string
 #endif
 
+// Namespace in which the string hash is defined.
+// Is to be defined when the tl_string_hash library is configured to use a
+// non-default namespace.
+#ifndef TL_STATIC_STRING_STRING_HASH_NAMESPACE
+#  define TL_STATIC_STRING_STRING_HASH_NAMESPACE tiny_lib::string_hash
+#endif
+
 // Helpers for TL_STATIC_STRING_VERSION_NAMESPACE.
 //
 // Typical extra indirection for such conversion to allow macro to be expanded
@@ -1435,8 +1463,10 @@ class BasicStaticString {
       size_type r;
     };
 
+    // Keep the current size if the operation throws.
     SizeAssigner size_assigner;
     size_assigner.str_ptr = this;
+    size_assigner.r = size();
     size_assigner.r = std::move(op)(current_data, count);
 
     assert(size_assigner.r <= count);
@@ -1792,115 +1822,331 @@ class BasicStaticString {
 ////////////////////////////////////////////////////////////////////////////////
 // Non-member functions.
 
-// Returns a string containing characters from lhs followed by the characters
-// from rhs.
+// Concatenation
+// =============
+//
+// The operator+ does not construct a string: it returns a lightweight
+// expression which refers to its operands. Concatenation of multiple operands
+// builds a tree of such expressions, and the string is only constructed when
+// the expression is converted to the BasicStaticString. At this point the
+// total length is calculated, the capacity is checked once, and every operand
+// is copied straight into the result.
+//
+// Temporary strings are stored in the expression by value, while the other
+// string operands are referred to. An expression which refers to strings is
+// only valid while the strings are alive:
+//
+//   StaticString<32> path = dir + '/' + name;  // OK.
+//   auto path = dir + '/' + name;              // Refers to the dir and name.
+//
+// The expression can be compared with strings and string views, which
+// evaluates it. The str() evaluates the expression explicitly, for example to
+// call a function template which deduces the capacity of the string:
+//
+//   Process((dir + '/' + name).str());
+//
+// The size(), length(), empty(), and operator[] are available without
+// evaluating the expression, and the expression can be explicitly converted to
+// the std::basic_string.
+
+// Expression which represents concatenation of the Lhs and Rhs operands.
+//
+// The operands are either strings, string views, characters, or other
+// concatenation expressions.
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+class BasicStaticStringConcat {
+ public:
+  using StringType = BasicStaticString<CharT, N, Traits>;
+  using StringViewType = std::basic_string_view<CharT, Traits>;
+  using size_type = typename StringType::size_type;
+
+  constexpr BasicStaticStringConcat(Lhs lhs, Rhs rhs)
+      : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {}
+
+  // The number of characters in the result of the concatenation.
+  constexpr auto size() const -> size_type {
+    return GetPieceSize(lhs_) + GetPieceSize(rhs_);
+  }
+  constexpr auto length() const -> size_type { return size(); }
+
+  // Checks whether the result of the concatenation is empty.
+  [[nodiscard]] constexpr auto empty() const -> bool { return size() == 0; }
+
+  // The maximum number of characters the result of the concatenation can hold.
+  constexpr auto max_size() const noexcept -> size_type { return N; }
+
+  // Returns the character at the specified position of the result of the
+  // concatenation. No bounds checking is performed.
+  constexpr auto operator[](const size_type pos) const -> CharT {
+    const size_type lhs_size = GetPieceSize(lhs_);
+    if (pos < lhs_size) {
+      return GetPieceChar(lhs_, pos);
+    }
+    return GetPieceChar(rhs_, pos - lhs_size);
+  }
+
+  // Copy the result of the concatenation to the destination, and return
+  // pointer past the last copied character.
+  constexpr auto CopyTo(CharT* dest) const -> CharT* {
+    return CopyPiece(rhs_, CopyPiece(lhs_, dest));
+  }
+
+  // Evaluate the concatenation.
+  // If the result does not fit into the string, std::length_error is thrown.
+  constexpr auto str() const -> StringType {
+    StringType result;
+    result.resize_and_overwrite(size(), [this](CharT* data, size_type count) {
+      CopyTo(data);
+      return count;
+    });
+    return result;
+  }
+
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  constexpr operator StringType() const { return str(); }
+
+  // Evaluate the concatenation into a std::basic_string.
+  template <class Allocator>
+  explicit operator std::basic_string<CharT, Traits, Allocator>() const {
+    std::basic_string<CharT, Traits, Allocator> result(size(), CharT());
+    CopyTo(result.data());
+    return result;
+  }
+
+  // Compare the result of the concatenation with a string.
+  // If the result does not fit into the string, std::length_error is thrown.
+  friend constexpr auto operator==(const BasicStaticStringConcat& lhs,
+                                   const StringViewType rhs) -> bool {
+    return lhs.str().compare(rhs) == 0;
+  }
+  friend constexpr auto operator<=>(const BasicStaticStringConcat& lhs,
+                                    const StringViewType rhs) {
+    return lhs.str().compare(rhs) <=> 0;
+  }
+
+ private:
+  template <class Piece>
+  static constexpr auto GetPieceSize(const Piece& piece) -> size_type {
+    if constexpr (std::is_same_v<Piece, CharT>) {
+      return 1;
+    } else {
+      return piece.size();
+    }
+  }
+
+  template <class Piece>
+  static constexpr auto GetPieceChar(const Piece& piece, const size_type pos)
+      -> CharT {
+    if constexpr (std::is_same_v<Piece, CharT>) {
+      return piece;
+    } else {
+      return piece[pos];
+    }
+  }
+
+  template <class Piece>
+  static constexpr auto CopyPiece(const Piece& piece, CharT* dest) -> CharT* {
+    if constexpr (std::is_same_v<Piece, CharT>) {
+      Traits::assign(*dest, piece);
+      return dest + 1;
+    } else if constexpr (std::is_same_v<Piece, StringViewType> ||
+                         std::is_same_v<Piece, StringType>) {
+      Traits::copy(dest, piece.data(), piece.size());
+      return dest + piece.size();
+    } else {
+      return piece.CopyTo(dest);
+    }
+  }
+
+  Lhs lhs_;
+  Rhs rhs_;
+};
+
+namespace internal {
+
+// Conversion of operands of the operator+ to their representation in the
+// concatenation expression.
+template <class CharT, std::size_t N, class Traits>
+struct ConcatPiece {
+  using StringType = BasicStaticString<CharT, N, Traits>;
+  using StringViewType = std::basic_string_view<CharT, Traits>;
+
+  static constexpr auto Get(const StringType& str) -> StringViewType {
+    return StringViewType(str);
+  }
+  static constexpr auto Get(StringType&& str) -> StringType {
+    return std::move(str);
+  }
+  static constexpr auto Get(const CharT* s) -> StringViewType {
+    return StringViewType(s);
+  }
+  static constexpr auto Get(const CharT ch) -> CharT { return ch; }
+  template <class Lhs, class Rhs>
+  static constexpr auto Get(
+      const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& concat)
+      -> BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs> {
+    return concat;
+  }
+};
+
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+constexpr auto MakeConcat(Lhs&& lhs, Rhs&& rhs) {
+  using Piece = ConcatPiece<CharT, N, Traits>;
+  return BasicStaticStringConcat<CharT,
+                                 N,
+                                 Traits,
+                                 decltype(Piece::Get(std::forward<Lhs>(lhs))),
+                                 decltype(Piece::Get(std::forward<Rhs>(rhs)))>(
+      Piece::Get(std::forward<Lhs>(lhs)), Piece::Get(std::forward<Rhs>(rhs)));
+}
+
+}  // namespace internal
+
+// Returns an expression which evaluates to a string containing characters
+// from lhs followed by the characters from rhs.
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(const BasicStaticString<CharT, N, Traits>& lhs,
-                         const BasicStaticString<CharT, N, Traits>& rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result(lhs);
-  result += rhs;
-  return result;
+                         const BasicStaticString<CharT, N, Traits>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(const BasicStaticString<CharT, N, Traits>& lhs,
-                         const CharT* rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result(lhs);
-  result += rhs;
-  return result;
+                         const CharT* rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(const BasicStaticString<CharT, N, Traits>& lhs,
-                         const CharT rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result(lhs);
-  result += rhs;
-  return result;
+                         const CharT rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(const CharT* lhs,
-                         const BasicStaticString<CharT, N, Traits>& rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result(lhs);
-  result += rhs;
-  return result;
+                         const BasicStaticString<CharT, N, Traits>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(const CharT lhs,
-                         const BasicStaticString<CharT, N, Traits>& rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result(1, lhs);
-  result += rhs;
-  return result;
+                         const BasicStaticString<CharT, N, Traits>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
 }
 
+// Temporary strings are moved into the expression.
+
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(BasicStaticString<CharT, N, Traits>&& lhs,
-                         BasicStaticString<CharT, N, Traits>&& rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result = std::move(lhs);
-  result += std::move(rhs);
-  return result;
+                         BasicStaticString<CharT, N, Traits>&& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(std::move(lhs),
+                                                std::move(rhs));
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(BasicStaticString<CharT, N, Traits>&& lhs,
-                         const BasicStaticString<CharT, N, Traits>& rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result = std::move(lhs);
-  result += rhs;
-  return result;
+                         const BasicStaticString<CharT, N, Traits>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(std::move(lhs), rhs);
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(BasicStaticString<CharT, N, Traits>&& lhs,
-                         const CharT* rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result = std::move(lhs);
-  result += rhs;
-  return result;
+                         const CharT* rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(std::move(lhs), rhs);
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(BasicStaticString<CharT, N, Traits>&& lhs,
-                         const CharT rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result = std::move(lhs);
-  result += rhs;
-  return result;
+                         const CharT rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(std::move(lhs), rhs);
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(const BasicStaticString<CharT, N, Traits>& lhs,
-                         BasicStaticString<CharT, N, Traits>&& rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result(lhs);
-  result += rhs;
-  return result;
+                         BasicStaticString<CharT, N, Traits>&& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, std::move(rhs));
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(const CharT* lhs,
-                         BasicStaticString<CharT, N, Traits>&& rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result(lhs);
-  result += rhs;
-  return result;
+                         BasicStaticString<CharT, N, Traits>&& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, std::move(rhs));
 }
 
 template <std::size_t N, class CharT, class Traits>
 constexpr auto operator+(const CharT lhs,
-                         BasicStaticString<CharT, N, Traits>&& rhs)
-    -> BasicStaticString<CharT, N, Traits> {
-  BasicStaticString<CharT, N, Traits> result(1, lhs);
-  result += rhs;
-  return result;
+                         BasicStaticString<CharT, N, Traits>&& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, std::move(rhs));
+}
+
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+constexpr auto operator+(
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& lhs,
+    BasicStaticString<CharT, N, Traits>&& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, std::move(rhs));
+}
+
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+constexpr auto operator+(
+    BasicStaticString<CharT, N, Traits>&& lhs,
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(std::move(lhs), rhs);
+}
+
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+constexpr auto operator+(
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& lhs,
+    const BasicStaticString<CharT, N, Traits>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
+}
+
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+constexpr auto operator+(
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& lhs,
+    const CharT* rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
+}
+
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+constexpr auto operator+(
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& lhs,
+    const CharT rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
+}
+
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+constexpr auto operator+(
+    const BasicStaticString<CharT, N, Traits>& lhs,
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
+}
+
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+constexpr auto operator+(
+    const CharT* lhs,
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
+}
+
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+constexpr auto operator+(
+    const CharT lhs,
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
+}
+
+template <class CharT,
+          std::size_t N,
+          class Traits,
+          class Lhs1,
+          class Rhs1,
+          class Lhs2,
+          class Rhs2>
+constexpr auto operator+(
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs1, Rhs1>& lhs,
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs2, Rhs2>& rhs) {
+  return internal::MakeConcat<CharT, N, Traits>(lhs, rhs);
 }
 
 // Compare two BasicStaticString objects.
@@ -1961,69 +2207,6 @@ constexpr auto erase_if(BasicStaticString<CharT, N, Traits>& c, Pred pred) ->
   return r;
 }
 
-// Input/output
-// ============
-
-template <std::size_t N, class CharT, class Traits>
-auto operator<<(std::basic_ostream<CharT, Traits>& os,
-                const BasicStaticString<CharT, N, Traits>& str)
-    -> std::basic_ostream<CharT, Traits>& {
-  os << std::basic_string_view<CharT, Traits>(str);
-  return os;
-}
-
-template <std::size_t N, class CharT, class Traits>
-auto operator>>(std::basic_istream<CharT, Traits>& is,
-                BasicStaticString<CharT, N, Traits>& str)
-    -> std::basic_istream<CharT, Traits>& {
-  using StreamIntType = typename std::basic_istream<CharT, Traits>::int_type;
-  const typename BasicStaticString<CharT, N, Traits>::size_type max_size =
-      str.max_size();
-
-  const std::locale locale = is.getloc();
-  const std::streamsize width = is.width();
-
-  // Skip leading whitespace.
-  if (is.flags() & std::ios_base::skipws) {
-    while (!is.eof()) {
-      const StreamIntType next_char = is.peek();
-      if (next_char == Traits::eof()) {
-        break;
-      }
-      if (!std::isspace(CharT(next_char), locale)) {
-        break;
-      }
-      is.get();
-    }
-  }
-
-  str.erase();
-
-  std::streamsize num_characters_to_read = width ? width : max_size;
-  while (!is.eof()) {
-    if (num_characters_to_read == 0) {
-      break;
-    }
-
-    const StreamIntType next_char = is.peek();
-    if (next_char == Traits::eof()) {
-      break;
-    }
-    if (std::isspace(CharT(next_char), locale)) {
-      break;
-    }
-
-    const StreamIntType c = is.get();
-    str.append(1, CharT(c));
-
-    --num_characters_to_read;
-  }
-
-  return is;
-}
-
-// TODO(sergey): Implement getline()
-
 // NOLINTEND(readability-identifier-naming)
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2035,11 +2218,20 @@ using StaticString = BasicStaticString<char, N, std::char_traits<char>>;
 }  // namespace TL_STATIC_STRING_VERSION_NAMESPACE
 }  // namespace TL_STATIC_STRING_NAMESPACE
 
+// Hash support for BasicStaticString.
+// The hasher is transparent: it accepts any type convertible to a string view.
+template <class CharT, std::size_t N, class Traits>
+struct std::hash<
+    TL_STATIC_STRING_NAMESPACE::BasicStaticString<CharT, N, Traits>>
+    : public TL_STATIC_STRING_STRING_HASH_NAMESPACE::BasicStringHash<CharT,
+                                                                    Traits> {};
+
 #undef TL_STATIC_STRING_VERSION_MAJOR
 #undef TL_STATIC_STRING_VERSION_MINOR
 #undef TL_STATIC_STRING_VERSION_REVISION
 
 #undef TL_STATIC_STRING_NAMESPACE
+#undef TL_STATIC_STRING_STRING_HASH_NAMESPACE
 
 #undef TL_STATIC_STRING_VERSION_NAMESPACE_CONCAT_HELPER
 #undef TL_STATIC_STRING_VERSION_NAMESPACE_CONCAT
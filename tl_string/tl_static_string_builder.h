@@ -0,0 +1,267 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A builder of large strings from chained fixed capacity chunks.
+//
+// BasicStaticStringBuilder appends text into chunks of N characters which are
+// allocated from a memory resource. When the current chunk is full a new one is
+// added to the chain: the text which has been appended already is never copied
+// again, and the append is amortized O(1) per character regardless of the final
+// size of the text.
+//
+//   StaticStringBuilder<4096> builder;
+//
+//   for (const Entry& entry : entries) {
+//     builder.Append(entry.name);
+//     builder.Append(": ");
+//     builder.Append(entry.value);
+//     builder.Append('\n');
+//   }
+//
+//   file.WriteV(builder.GetChunks());
+//
+// GetChunks() returns views of the chunks in the order of the text, which is
+// suitable for vectored output. Flatten() copies the text into a single string
+// when a contiguous copy is needed.
+//
+// Memory
+// ======
+//
+// The chunks and the list of the chunks are allocated from the memory resource
+// passed to the builder, which allows to use a pool or an arena as the storage
+// of the text. The chunks are returned to the memory resource by Clear() and
+// when the builder is destroyed. Clear() keeps the list of the chunks, so that
+// a builder which is reused does not grow the list again.
+//
+//
+// Exceptions
+// ==========
+//
+// General notes on exceptions:
+//
+//  - If the memory resource fails to allocate a chunk its exception is
+//    propagated to the caller. The text which fits into the chunks allocated
+//    prior to the failure stays appended (basic exception guarantee).
+//
+//  - Flatten() propagates exceptions of the destination string type, such as
+//    an std::length_error when the text does not fit into a StaticString.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (19 Oct 2026)    First public release.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Semantic version of the tl_static_string_builder library.
+#define TL_STATIC_STRING_BUILDER_VERSION_MAJOR 0
+#define TL_STATIC_STRING_BUILDER_VERSION_MINOR 0
+#define TL_STATIC_STRING_BUILDER_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_STRING_BUILDER_NAMESPACE
+#  define TL_STATIC_STRING_BUILDER_NAMESPACE tiny_lib::static_string_builder
+#endif
+
+// Helpers for TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE_CONCAT_HELPER(              \
+    id1, id2, id3)                                                             \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE_CONCAT(id1, id2, id3)       \
+  TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE                             \
+  TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE_CONCAT(                           \
+      TL_STATIC_STRING_BUILDER_VERSION_MAJOR,                                  \
+      TL_STATIC_STRING_BUILDER_VERSION_MINOR,                                  \
+      TL_STATIC_STRING_BUILDER_VERSION_REVISION)
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_STRING_BUILDER_NAMESPACE {
+inline namespace TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE {
+
+template <class CharT,
+          std::size_t N,
+          class Traits = std::char_traits<CharT>>
+class BasicStaticStringBuilder {
+  static_assert(N > 0, "Chunks are to have non-zero capacity");
+
+ public:
+  using ViewType = std::basic_string_view<CharT, Traits>;
+  using SizeType = std::size_t;
+
+  // Number of characters in a single chunk.
+  static constexpr SizeType kChunkSize = N;
+
+  explicit BasicStaticStringBuilder(
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+      : resource_(resource), chunks_(resource) {}
+
+  BasicStaticStringBuilder(BasicStaticStringBuilder&& other) noexcept
+      : resource_(other.resource_),
+        chunks_(std::move(other.chunks_)),
+        current_chunk_(std::exchange(other.current_chunk_, nullptr)),
+        size_(std::exchange(other.size_, 0)) {
+    other.chunks_.clear();
+  }
+
+  // The chunks are allocated from the memory resource of the builder, and can
+  // not be transferred to a builder which might be using a different resource.
+  BasicStaticStringBuilder(const BasicStaticStringBuilder& other) = delete;
+  auto operator=(const BasicStaticStringBuilder& other)
+      -> BasicStaticStringBuilder& = delete;
+  auto operator=(BasicStaticStringBuilder&& other)
+      -> BasicStaticStringBuilder& = delete;
+
+  ~BasicStaticStringBuilder() { Clear(); }
+
+  // Append the string to the end of the text.
+  auto Append(const ViewType str) -> BasicStaticStringBuilder& {
+    SizeType offset = 0;
+    while (offset != str.size()) {
+      const SizeType count =
+          std::min(ReserveInCurrentChunk(), str.size() - offset);
+      Traits::copy(GetCurrentEnd(), str.data() + offset, count);
+      Commit(count);
+      offset += count;
+    }
+    return *this;
+  }
+
+  // Append count copies of the character ch to the end of the text.
+  auto Append(const SizeType count, const CharT ch)
+      -> BasicStaticStringBuilder& {
+    SizeType num_remaining = count;
+    while (num_remaining != 0) {
+      const SizeType num = std::min(ReserveInCurrentChunk(), num_remaining);
+      Traits::assign(GetCurrentEnd(), num, ch);
+      Commit(num);
+      num_remaining -= num;
+    }
+    return *this;
+  }
+
+  // Append a single character to the end of the text.
+  auto Append(const CharT ch) -> BasicStaticStringBuilder& {
+    return Append(1, ch);
+  }
+
+  auto operator+=(const ViewType str) -> BasicStaticStringBuilder& {
+    return Append(str);
+  }
+  auto operator+=(const CharT ch) -> BasicStaticStringBuilder& {
+    return Append(ch);
+  }
+
+  // Get the number of characters in the text.
+  auto GetSize() const -> SizeType { return size_; }
+
+  // Returns true if no text has been appended.
+  auto IsEmpty() const -> bool { return size_ == 0; }
+
+  // Get views of the chunks which hold the text, in the order of the text.
+  //
+  // The views stay valid until the next modification of the builder.
+  auto GetChunks() const -> std::span<const ViewType> { return chunks_; }
+
+  // Copy the text into a single contiguous string.
+  template <class StringType = std::basic_string<CharT, Traits>>
+  auto Flatten() const -> StringType {
+    StringType str;
+    str.reserve(size_);
+    for (const ViewType chunk : chunks_) {
+      str.append(chunk.data(), chunk.size());
+    }
+    return str;
+  }
+
+  // Remove all text and return the chunks to the memory resource.
+  // The memory of the list of the chunks is kept for reuse.
+  void Clear() {
+    for (const ViewType chunk : chunks_) {
+      resource_->deallocate(const_cast<CharT*>(chunk.data()),
+                            kChunkSize * sizeof(CharT),
+                            alignof(CharT));
+    }
+    chunks_.clear();
+    current_chunk_ = nullptr;
+    size_ = 0;
+  }
+
+ private:
+  // Ensure there is space in the current chunk, allocating a new chunk if the
+  // current one is full.
+  // Returns the number of characters available in the current chunk.
+  auto ReserveInCurrentChunk() -> SizeType {
+    if (chunks_.empty() || chunks_.back().size() == kChunkSize) {
+      // Reserve the list first, so that the chunk does not leak if the list
+      // fails to grow.
+      chunks_.reserve(chunks_.size() + 1);
+      current_chunk_ = static_cast<CharT*>(
+          resource_->allocate(kChunkSize * sizeof(CharT), alignof(CharT)));
+      chunks_.emplace_back(current_chunk_, 0);
+    }
+    return kChunkSize - chunks_.back().size();
+  }
+
+  auto GetCurrentEnd() const -> CharT* {
+    return current_chunk_ + chunks_.back().size();
+  }
+
+  // Mark the given number of characters past the end of the current chunk as
+  // a part of the text.
+  void Commit(const SizeType count) {
+    ViewType& chunk = chunks_.back();
+    chunk = ViewType(current_chunk_, chunk.size() + count);
+    size_ += count;
+  }
+
+  std::pmr::memory_resource* resource_;
+
+  // Views of the chunks. Every view starts at the beginning of its chunk.
+  std::pmr::vector<ViewType> chunks_;
+
+  // Beginning of the last chunk, which is where new text is written to.
+  CharT* current_chunk_{nullptr};
+
+  SizeType size_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Type definitions for common character types.
+
+template <std::size_t N>
+using StaticStringBuilder =
+    BasicStaticStringBuilder<char, N, std::char_traits<char>>;
+
+}  // namespace TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE
+}  // namespace TL_STATIC_STRING_BUILDER_NAMESPACE
+
+#undef TL_STATIC_STRING_BUILDER_VERSION_MAJOR
+#undef TL_STATIC_STRING_BUILDER_VERSION_MINOR
+#undef TL_STATIC_STRING_BUILDER_VERSION_REVISION
+
+#undef TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE
+
+#undef TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_STRING_BUILDER_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_STRING_BUILDER_NAMESPACE
@@ -0,0 +1,424 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Formatting of values into a fixed capacity string.
+//
+// AppendFormat() appends text to a StaticString following a format string with
+// `{}` placeholders, which are replaced with the arguments in the order they
+// are given:
+//
+//   StaticString<64> str;
+//   AppendFormat(str, "Frame {} of {}: {}", frame, num_frames, name);
+//
+// The format string is checked at compile time: a mismatch between the number
+// of placeholders and the number of arguments, or an unmatched brace fail the
+// compilation. Literal braces are written as `{{` and `}}`.
+//
+// The text is written directly into the remaining capacity of the string, no
+// temporary buffers are used, and no memory is allocated. The formatting does
+// not depend on the current locale.
+//
+// Supported argument types:
+//
+//  - Integer types, converted using the tl_convert library.
+//  - Floating point types, converted to the shortest representation which
+//    round-trips to the same value.
+//  - bool, written as `true` or `false`.
+//  - char, written as a single character.
+//  - Null-terminated character strings, and any type convertible to the
+//    std::string_view: StaticString, CStringView, std::string, and others.
+//
+// Format<N>() is a shortcut which formats into a new StaticString<N>.
+//
+//
+// Exceptions
+// ==========
+//
+// If the formatted text does not fit into the remaining capacity of the string,
+// AppendFormat() throws std::length_error. The error handling is customizable
+// by defining TL_STATIC_STRING_FORMAT_THROW_IF prior to including this header.
+// When code is compiled without exceptions the program execution is aborted.
+//
+// TryAppendFormat() does not throw, and returns false if the text does not fit.
+//
+// In both cases the string is left unmodified if the text does not fit (strong
+// exception guarantee).
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "tl_convert/tl_convert.h"
+#include "tl_static_string.h"
+
+// Semantic version of the tl_static_string_format library.
+#define TL_STATIC_STRING_FORMAT_VERSION_MAJOR 0
+#define TL_STATIC_STRING_FORMAT_VERSION_MINOR 0
+#define TL_STATIC_STRING_FORMAT_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STATIC_STRING_FORMAT_NAMESPACE
+#  define TL_STATIC_STRING_FORMAT_NAMESPACE tiny_lib::static_string_format
+#endif
+
+// Namespace in which the BasicStaticString is defined.
+// Is to be defined when the tl_static_string library is configured to use a
+// non-default namespace.
+#ifndef TL_STATIC_STRING_FORMAT_STATIC_STRING_NAMESPACE
+#  define TL_STATIC_STRING_FORMAT_STATIC_STRING_NAMESPACE                      \
+    tiny_lib::static_string
+#endif
+
+// Namespace in which the tl_convert functions are defined.
+// Is to be defined when the tl_convert library is configured to use a
+// non-default namespace.
+#ifndef TL_STATIC_STRING_FORMAT_CONVERT_NAMESPACE
+#  define TL_STATIC_STRING_FORMAT_CONVERT_NAMESPACE tiny_lib::convert
+#endif
+
+// Helpers for TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE_CONCAT_HELPER(               \
+    id1, id2, id3)                                                             \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE_CONCAT(id1, id2, id3)        \
+  TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE                              \
+  TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE_CONCAT(                            \
+      TL_STATIC_STRING_FORMAT_VERSION_MAJOR,                                   \
+      TL_STATIC_STRING_FORMAT_VERSION_MINOR,                                   \
+      TL_STATIC_STRING_FORMAT_VERSION_REVISION)
+
+// Throw an exception of the given type ExceptionType if the expression is
+// evaluated to a truthful value.
+// The default implementation throws an ExceptionType(#expression) if the
+// condition is met.
+// If the default behavior is not suitable for the application it should define
+// TL_STATIC_STRING_FORMAT_THROW_IF prior to including this header. The provided
+// implementation is not to return, otherwise an undefined behavior of memory
+// corruption will happen.
+#if !defined(TL_STATIC_STRING_FORMAT_THROW_IF)
+#  define TL_STATIC_STRING_FORMAT_THROW_IF(ExceptionType, expression)          \
+    internal::ThrowIf<ExceptionType>(expression, #expression)
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_STRING_FORMAT_NAMESPACE {
+inline namespace TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE {
+
+template <std::size_t N, class Traits = std::char_traits<char>>
+using BasicStaticString =
+    TL_STATIC_STRING_FORMAT_STATIC_STRING_NAMESPACE::BasicStaticString<char,
+                                                                      N,
+                                                                      Traits>;
+
+template <std::size_t N>
+using StaticString = BasicStaticString<N>;
+
+namespace internal {
+
+// If the exceptions are enabled throws a new exception of the given type
+// passing the given expression_str to its constructor as a reason. If the
+// exceptions are disabled aborts the program execution.
+template <class Exception>
+[[noreturn]] inline constexpr void ThrowOrAbort(const char* expression_str) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  throw Exception(expression_str);
+#else
+  (void)expression_str;
+  __builtin_abort();
+#endif
+}
+
+// A default implementation of the TL_STATIC_STRING_FORMAT_THROW_IF().
+template <class Exception>
+inline constexpr void ThrowIf(const bool expression_eval,
+                              const char* expression_str) {
+  if (expression_eval) {
+    ThrowOrAbort<Exception>(expression_str);
+  }
+}
+
+// Reports an error in the format string.
+//
+// The function is intentionally not constexpr: calling it from the compile
+// time check of the format string fails the compilation, and the compiler error
+// points to the call with the description of the error.
+inline void FormatStringError(const char* /*message*/) {}
+
+template <class T>
+inline constexpr bool kIsInteger =
+    std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+    !std::is_same_v<T, char>;
+
+template <class T>
+inline constexpr bool kIsString =
+    std::is_convertible_v<const T&, std::string_view>;
+
+template <class T>
+inline constexpr bool kIsFormattable =
+    kIsInteger<T> || std::is_floating_point_v<T> || std::is_same_v<T, bool> ||
+    std::is_same_v<T, char> || kIsString<T>;
+
+// Find the next placeholder in the format string starting at the given
+// position, and return the number of characters of literal text preceding it.
+// Returns the remaining number of characters in the format if there are no more
+// placeholders.
+constexpr auto FindPlaceholder(const std::string_view format,
+                               const std::size_t pos) -> std::size_t {
+  for (std::size_t i = pos; i < format.size(); ++i) {
+    if (format[i] != '{' && format[i] != '}') {
+      continue;
+    }
+    if (i + 1 < format.size() && format[i + 1] == format[i]) {
+      // Escaped brace.
+      ++i;
+      continue;
+    }
+    return i - pos;
+  }
+  return format.size() - pos;
+}
+
+// Count the number of placeholders in the format string, reporting errors for
+// malformed format strings.
+consteval auto CountPlaceholders(const std::string_view format)
+    -> std::size_t {
+  std::size_t num_placeholders = 0;
+  std::size_t pos = 0;
+  while (true) {
+    pos += FindPlaceholder(format, pos);
+    if (pos == format.size()) {
+      break;
+    }
+    if (format[pos] == '}') {
+      FormatStringError("Unmatched '}' in the format string");
+    }
+    if (pos + 1 == format.size() || format[pos + 1] != '}') {
+      FormatStringError("Only '{}' placeholders are supported");
+    }
+    ++num_placeholders;
+    pos += 2;
+  }
+  return num_placeholders;
+}
+
+// Writer of the formatted text into the storage of a string.
+class Writer {
+ public:
+  // The buffer has space for max_size characters and the null-terminator.
+  constexpr Writer(char* buffer, const std::size_t size, std::size_t max_size)
+      : buffer_(buffer), size_(size), max_size_(max_size) {}
+
+  constexpr auto GetSize() const -> std::size_t { return size_; }
+  constexpr auto IsOverflow() const -> bool { return is_overflow_; }
+
+  // Write literal text of the format string, un-escaping braces.
+  constexpr void WriteLiteral(const std::string_view text) {
+    for (std::size_t i = 0; i < text.size(); ++i) {
+      Write(text[i]);
+      if (text[i] == '{' || text[i] == '}') {
+        ++i;
+      }
+    }
+  }
+
+  constexpr void Write(const char ch) {
+    if (size_ == max_size_) {
+      is_overflow_ = true;
+      return;
+    }
+    buffer_[size_++] = ch;
+  }
+
+  constexpr void Write(const std::string_view str) {
+    if (str.size() > max_size_ - size_) {
+      is_overflow_ = true;
+      return;
+    }
+    std::char_traits<char>::copy(buffer_ + size_, str.data(), str.size());
+    size_ += str.size();
+  }
+
+  template <class T>
+  void WriteArgument(const T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+      Write(std::string_view(value ? "true" : "false"));
+    } else if constexpr (std::is_same_v<T, char>) {
+      Write(value);
+    } else if constexpr (kIsInteger<T>) {
+      // The conversion writes the null-terminator, for which the buffer always
+      // has space past the max_size.
+      const std::span<char> buffer(buffer_ + size_, max_size_ - size_ + 1);
+      if (!TL_STATIC_STRING_FORMAT_CONVERT_NAMESPACE::IntToStringBuffer(
+              value, buffer)) {
+        is_overflow_ = true;
+        return;
+      }
+      size_ += std::char_traits<char>::length(buffer.data());
+    } else if constexpr (std::is_floating_point_v<T>) {
+      const std::to_chars_result result =
+          std::to_chars(buffer_ + size_, buffer_ + max_size_, value);
+      if (result.ec != std::errc()) {
+        is_overflow_ = true;
+        return;
+      }
+      size_ = result.ptr - buffer_;
+    } else {
+      Write(std::string_view(value));
+    }
+  }
+
+ private:
+  char* buffer_;
+  std::size_t size_;
+  std::size_t max_size_;
+  bool is_overflow_{false};
+};
+
+inline void FormatTo(Writer& writer, const std::string_view format) {
+  writer.WriteLiteral(format);
+}
+
+template <class Arg, class... Args>
+void FormatTo(Writer& writer,
+              const std::string_view format,
+              const Arg& arg,
+              const Args&... args) {
+  const std::size_t literal_size = FindPlaceholder(format, 0);
+  writer.WriteLiteral(format.substr(0, literal_size));
+  writer.WriteArgument(arg);
+  if (writer.IsOverflow()) {
+    return;
+  }
+  FormatTo(writer, format.substr(literal_size + 2), args...);
+}
+
+// Format the arguments into the string.
+// Returns false if the formatted text does not fit, leaving the string as-is.
+template <std::size_t N, class Traits, class... Args>
+auto TryAppendFormatImpl(BasicStaticString<N, Traits>& str,
+                         const std::string_view format,
+                         const Args&... args) -> bool {
+  bool is_overflow = false;
+  const std::size_t old_size = str.size();
+  str.resize_and_overwrite(
+      str.max_size(), [&](char* buffer, const std::size_t max_size) {
+        Writer writer(buffer, old_size, max_size);
+        FormatTo(writer, format, args...);
+        is_overflow = writer.IsOverflow();
+        return is_overflow ? old_size : writer.GetSize();
+      });
+  return !is_overflow;
+}
+
+}  // namespace internal
+
+// A format string which is checked at compile time to be valid for the given
+// argument types.
+//
+// It is implicitly constructible from a string literal, and is not to be used
+// directly: it is a parameter type of the formatting functions.
+template <class... Args>
+class BasicFormatString {
+ public:
+  static_assert((internal::kIsFormattable<Args> && ...),
+                "Unsupported type of the format argument");
+
+  template <class T,
+            class = std::enable_if_t<
+                std::is_convertible_v<const T&, std::string_view>>>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  consteval BasicFormatString(const T& format) : format_(format) {
+    if (internal::CountPlaceholders(format_) != sizeof...(Args)) {
+      internal::FormatStringError(
+          "Number of placeholders does not match the number of arguments");
+    }
+  }
+
+  constexpr auto Get() const -> std::string_view { return format_; }
+
+ private:
+  std::string_view format_;
+};
+
+// The format string type for the given argument types.
+// Disables deduction of the argument types from the format string.
+template <class... Args>
+using FormatString = BasicFormatString<std::decay_t<Args>...>;
+
+// Append text formatted according to the format string to the str.
+//
+// If the text does not fit into the remaining capacity of the string
+// std::length_error is thrown, and the string is not modified.
+template <std::size_t N, class Traits, class... Args>
+void AppendFormat(BasicStaticString<N, Traits>& str,
+                  const std::type_identity_t<FormatString<Args...>> format,
+                  const Args&... args) {
+  const bool is_success =
+      internal::TryAppendFormatImpl(str, format.Get(), args...);
+  TL_STATIC_STRING_FORMAT_THROW_IF(std::length_error, !is_success);
+}
+
+// Append text formatted according to the format string to the str.
+//
+// Returns true on success. If the text does not fit into the remaining capacity
+// of the string false is returned, and the string is not modified.
+template <std::size_t N, class Traits, class... Args>
+[[nodiscard]] auto TryAppendFormat(
+    BasicStaticString<N, Traits>& str,
+    const std::type_identity_t<FormatString<Args...>> format,
+    const Args&... args) -> bool {
+  return internal::TryAppendFormatImpl(str, format.Get(), args...);
+}
+
+// Format the arguments according to the format string into a new string of the
+// capacity N.
+//
+// If the text does not fit into the string std::length_error is thrown.
+template <std::size_t N, class... Args>
+auto Format(const std::type_identity_t<FormatString<Args...>> format,
+            const Args&... args) -> StaticString<N> {
+  StaticString<N> str;
+  AppendFormat(str, format, args...);
+  return str;
+}
+
+}  // namespace TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE
+}  // namespace TL_STATIC_STRING_FORMAT_NAMESPACE
+
+#undef TL_STATIC_STRING_FORMAT_VERSION_MAJOR
+#undef TL_STATIC_STRING_FORMAT_VERSION_MINOR
+#undef TL_STATIC_STRING_FORMAT_VERSION_REVISION
+
+#undef TL_STATIC_STRING_FORMAT_NAMESPACE
+#undef TL_STATIC_STRING_FORMAT_STATIC_STRING_NAMESPACE
+#undef TL_STATIC_STRING_FORMAT_CONVERT_NAMESPACE
+
+#undef TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE_CONCAT
+#undef TL_STATIC_STRING_FORMAT_VERSION_NAMESPACE
+
+#undef TL_STATIC_STRING_FORMAT_THROW_IF
@@ -0,0 +1,163 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Stream input and output of the BasicStaticString.
+//
+// The operators are kept out of the tl_static_string.h so that the static
+// string itself does not depend on the <istream>, <ostream>, and <locale>.
+// Include this header in the code which puts static strings to the streams or
+// gets them from the streams:
+//
+//   #include "tl_string/tl_static_string_iostream.h"
+//
+//   StaticString<16> str;
+//   std::cin >> str;
+//   std::cout << str << std::endl;
+//
+// The operators follow the behavior of the corresponding operators of the
+// std::basic_string, with the exception that the input stops when the static
+// string reaches its capacity.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.2-alpha    (19 Oct 2026)    Put concatenation expressions to streams,
+//                                   versioned namespace of the operators.
+//   0.0.1-alpha    (19 Oct 2026)    First public release.
+
+#pragma once
+
+#include <cstddef>
+#include <ios>
+#include <istream>
+#include <locale>
+#include <ostream>
+#include <string_view>
+
+#include "tl_static_string.h"
+
+// Semantic version of the tl_static_string_iostream library.
+#define TL_STATIC_STRING_IOSTREAM_VERSION_MAJOR 0
+#define TL_STATIC_STRING_IOSTREAM_VERSION_MINOR 0
+#define TL_STATIC_STRING_IOSTREAM_VERSION_REVISION 2
+
+// Namespace in which the static string is defined.
+// Is to be defined when the tl_static_string library is configured to use a
+// non-default namespace.
+//
+// The operators are defined in this namespace, so that they are found by the
+// argument-dependent lookup.
+#ifndef TL_STATIC_STRING_IOSTREAM_STATIC_STRING_NAMESPACE
+#  define TL_STATIC_STRING_IOSTREAM_STATIC_STRING_NAMESPACE                    \
+    tiny_lib::static_string
+#endif
+
+// Helpers for TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE_CONCAT_HELPER(             \
+    id1, id2, id3)                                                             \
+  v_##id1##_##id2##_##id3
+#define TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE_CONCAT(id1, id2, id3)      \
+  TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE                            \
+  TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE_CONCAT(                          \
+      TL_STATIC_STRING_IOSTREAM_VERSION_MAJOR,                                 \
+      TL_STATIC_STRING_IOSTREAM_VERSION_MINOR,                                 \
+      TL_STATIC_STRING_IOSTREAM_VERSION_REVISION)
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STATIC_STRING_IOSTREAM_STATIC_STRING_NAMESPACE {
+inline namespace TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE {
+
+template <std::size_t N, class CharT, class Traits>
+auto operator<<(std::basic_ostream<CharT, Traits>& os,
+                const BasicStaticString<CharT, N, Traits>& str)
+    -> std::basic_ostream<CharT, Traits>& {
+  os << std::basic_string_view<CharT, Traits>(str);
+  return os;
+}
+
+// Write the result of the concatenation expression to the stream.
+template <class CharT, std::size_t N, class Traits, class Lhs, class Rhs>
+auto operator<<(
+    std::basic_ostream<CharT, Traits>& os,
+    const BasicStaticStringConcat<CharT, N, Traits, Lhs, Rhs>& concat)
+    -> std::basic_ostream<CharT, Traits>& {
+  os << BasicStaticString<CharT, N, Traits>(concat);
+  return os;
+}
+
+template <std::size_t N, class CharT, class Traits>
+auto operator>>(std::basic_istream<CharT, Traits>& is,
+                BasicStaticString<CharT, N, Traits>& str)
+    -> std::basic_istream<CharT, Traits>& {
+  using StreamIntType = typename std::basic_istream<CharT, Traits>::int_type;
+  const typename BasicStaticString<CharT, N, Traits>::size_type max_size =
+      str.max_size();
+
+  const std::locale locale = is.getloc();
+  const std::streamsize width = is.width();
+
+  // Skip leading whitespace.
+  if (is.flags() & std::ios_base::skipws) {
+    while (!is.eof()) {
+      const StreamIntType next_char = is.peek();
+      if (next_char == Traits::eof()) {
+        break;
+      }
+      if (!std::isspace(CharT(next_char), locale)) {
+        break;
+      }
+      is.get();
+    }
+  }
+
+  str.erase();
+
+  std::streamsize num_characters_to_read = width ? width : max_size;
+  while (!is.eof()) {
+    if (num_characters_to_read == 0) {
+      break;
+    }
+
+    const StreamIntType next_char = is.peek();
+    if (next_char == Traits::eof()) {
+      break;
+    }
+    if (std::isspace(CharT(next_char), locale)) {
+      break;
+    }
+
+    const StreamIntType c = is.get();
+    str.append(1, CharT(c));
+
+    --num_characters_to_read;
+  }
+
+  return is;
+}
+
+// TODO(sergey): Implement getline()
+
+}  // namespace TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE
+}  // namespace TL_STATIC_STRING_IOSTREAM_STATIC_STRING_NAMESPACE
+
+#undef TL_STATIC_STRING_IOSTREAM_VERSION_MAJOR
+#undef TL_STATIC_STRING_IOSTREAM_VERSION_MINOR
+#undef TL_STATIC_STRING_IOSTREAM_VERSION_REVISION
+
+#undef TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE
+
+#undef TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STATIC_STRING_IOSTREAM_VERSION_NAMESPACE_CONCAT
+
+#undef TL_STATIC_STRING_IOSTREAM_STATIC_STRING_NAMESPACE
@@ -0,0 +1,322 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Fast hashing of strings.
+//
+// HashString() computes a 64-bit hash of a string. The algorithm follows the
+// structure of the wyhash by Wang Yi: short strings are hashed with a couple of
+// overlapping reads, and long strings are consumed 48 bytes at a time in three
+// independent lanes. Every step is a 64x64->128 bit multiplication of the input
+// mixed with secret constants, so the CPU can keep several multiplications in
+// flight and the hash of long strings runs close to the memory bandwidth.
+//
+// The function is constexpr: when it is evaluated at compile time the bytes are
+// read one at a time, at run time they are read with unaligned loads. Both code
+// paths give the same result, so hashes computed at compile time can be used
+// to look up strings at run time.
+//
+// Strings of wide character types are hashed as a sequence of bytes of their
+// characters in the little-endian order. The hash does not depend on the
+// endianness of the platform.
+//
+// Any type which provides value_type and traits_type and is convertible to the
+// matching std::basic_string_view can be hashed directly, so the hash of a
+// BasicCStringView or a BasicStaticString literal can be computed at compile
+// time:
+//
+//   constexpr uint64_t kHash = HashString(CStringView("open"));
+//
+// The hash is not cryptographically secure and is not stable across versions of
+// this library: it is not to be stored or sent over the network.
+//
+// Heterogeneous lookup
+// ====================
+//
+// StringHash and StringEqual are transparent function objects which accept any
+// type convertible to std::string_view. Using them with standard unordered
+// containers allows to look up keys without constructing the key type:
+//
+//   std::unordered_map<StaticString<16>, int, StringHash, StringEqual> map;
+//   map.find(std::string_view("key"));
+//
+// The std::hash specializations for the BasicStaticString and BasicCStringView
+// give the same result as the StringHash.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Semantic version of the tl_string_hash library.
+#define TL_STRING_HASH_VERSION_MAJOR 0
+#define TL_STRING_HASH_VERSION_MINOR 0
+#define TL_STRING_HASH_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STRING_HASH_NAMESPACE
+#  define TL_STRING_HASH_NAMESPACE tiny_lib::string_hash
+#endif
+
+// Helpers for TL_STRING_HASH_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STRING_HASH_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)          \
+  v_##id1##_##id2##_##id3
+#define TL_STRING_HASH_VERSION_NAMESPACE_CONCAT(id1, id2, id3)                 \
+  TL_STRING_HASH_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STRING_HASH_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STRING_HASH_VERSION_NAMESPACE                                       \
+  TL_STRING_HASH_VERSION_NAMESPACE_CONCAT(TL_STRING_HASH_VERSION_MAJOR,        \
+                                          TL_STRING_HASH_VERSION_MINOR,        \
+                                          TL_STRING_HASH_VERSION_REVISION)
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STRING_HASH_NAMESPACE {
+inline namespace TL_STRING_HASH_VERSION_NAMESPACE {
+
+namespace internal {
+
+inline constexpr uint64_t kSecret[4] = {
+    0x2d358dccaa6c78a5ULL,
+    0x8bb84b93962eacc9ULL,
+    0x4b33a62ed433d4a3ULL,
+    0x4d5a2da51de1aa47ULL,
+};
+
+// Multiply a and b as 128-bit numbers, and store the low 64 bits of the result
+// in a and the high 64 bits in b.
+inline constexpr void Multiply128(uint64_t& a, uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+  using UInt128 = unsigned __int128;
+  const UInt128 r = UInt128(a) * b;
+  a = uint64_t(r);
+  b = uint64_t(r >> 64);
+#else
+  const uint64_t ha = a >> 32;
+  const uint64_t hb = b >> 32;
+  const uint64_t la = uint32_t(a);
+  const uint64_t lb = uint32_t(b);
+
+  const uint64_t rh = ha * hb;
+  const uint64_t rm0 = ha * lb;
+  const uint64_t rm1 = hb * la;
+  const uint64_t rl = la * lb;
+
+  const uint64_t t = rl + (rm0 << 32);
+  uint64_t carry = t < rl;
+  const uint64_t lo = t + (rm1 << 32);
+  carry += lo < t;
+  const uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+
+  a = lo;
+  b = hi;
+#endif
+}
+
+inline constexpr auto Mix(uint64_t a, uint64_t b) -> uint64_t {
+  Multiply128(a, b);
+  return a ^ b;
+}
+
+// Read byte with the given index from the characters of a string.
+// The bytes of every character are enumerated in the little-endian order.
+template <class CharT>
+constexpr auto ReadByte(const CharT* data, const std::size_t index)
+    -> uint64_t {
+  using UnsignedChar = std::make_unsigned_t<CharT>;
+  if constexpr (sizeof(CharT) == 1) {
+    return UnsignedChar(data[index]);
+  } else {
+    const uint64_t ch = UnsignedChar(data[index / sizeof(CharT)]);
+    return (ch >> (8 * (index % sizeof(CharT)))) & 0xff;
+  }
+}
+
+// Read NumBytes bytes starting at the given byte index as a little-endian
+// integer.
+template <std::size_t NumBytes, class CharT>
+constexpr auto Read(const CharT* data, const std::size_t index) -> uint64_t {
+  if (!std::is_constant_evaluated() &&
+      std::endian::native == std::endian::little) {
+    std::conditional_t<NumBytes == 8, uint64_t, uint32_t> value;
+    std::memcpy(&value, reinterpret_cast<const char*>(data) + index, NumBytes);
+    return value;
+  }
+
+  uint64_t value = 0;
+  for (std::size_t i = 0; i < NumBytes; ++i) {
+    value |= ReadByte(data, index + i) << (8 * i);
+  }
+  return value;
+}
+
+// Read 1 to 3 bytes of a short string.
+template <class CharT>
+constexpr auto ReadShort(const CharT* data, const std::size_t num_bytes)
+    -> uint64_t {
+  return (ReadByte(data, 0) << 16) | (ReadByte(data, num_bytes >> 1) << 8) |
+         ReadByte(data, num_bytes - 1);
+}
+
+// Check whether T can be hashed and compared as a string view.
+template <class T, class CharT, class Traits>
+inline constexpr bool kIsStringViewLike =
+    std::is_convertible_v<const T&, std::basic_string_view<CharT, Traits>>;
+
+}  // namespace internal
+
+// Calculate hash of the given string.
+//
+// The seed allows to get different hashes for the same string, for example to
+// make hash tables less predictable for an external input.
+template <class CharT, class Traits>
+constexpr auto HashString(const std::basic_string_view<CharT, Traits> str,
+                          const uint64_t seed = 0) noexcept -> uint64_t {
+  using internal::kSecret;
+  using internal::Mix;
+  using internal::Read;
+
+  const CharT* data = str.data();
+  const std::size_t length = str.size() * sizeof(CharT);
+
+  uint64_t hash = seed ^ Mix(seed ^ kSecret[0], kSecret[1]);
+  uint64_t a;
+  uint64_t b;
+
+  if (length <= 16) {
+    if (length >= 4) {
+      const std::size_t offset = (length >> 3) << 2;
+      a = (Read<4>(data, 0) << 32) | Read<4>(data, offset);
+      b = (Read<4>(data, length - 4) << 32) |
+          Read<4>(data, length - 4 - offset);
+    } else if (length > 0) {
+      a = internal::ReadShort(data, length);
+      b = 0;
+    } else {
+      a = 0;
+      b = 0;
+    }
+  } else {
+    std::size_t index = 0;
+    std::size_t remaining = length;
+
+    if (remaining > 48) {
+      uint64_t hash1 = hash;
+      uint64_t hash2 = hash;
+      do {
+        hash = Mix(Read<8>(data, index) ^ kSecret[1],
+                   Read<8>(data, index + 8) ^ hash);
+        hash1 = Mix(Read<8>(data, index + 16) ^ kSecret[2],
+                    Read<8>(data, index + 24) ^ hash1);
+        hash2 = Mix(Read<8>(data, index + 32) ^ kSecret[3],
+                    Read<8>(data, index + 40) ^ hash2);
+        index += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+      hash ^= hash1 ^ hash2;
+    }
+
+    while (remaining > 16) {
+      hash = Mix(Read<8>(data, index) ^ kSecret[1],
+                 Read<8>(data, index + 8) ^ hash);
+      index += 16;
+      remaining -= 16;
+    }
+
+    // The last 16 bytes of the string, possibly overlapping with the already
+    // hashed bytes.
+    a = Read<8>(data, length - 16);
+    b = Read<8>(data, length - 8);
+  }
+
+  a ^= kSecret[1];
+  b ^= hash;
+  internal::Multiply128(a, b);
+
+  return Mix(a ^ kSecret[0] ^ length, b ^ kSecret[1]);
+}
+
+// Calculate hash of a string-like object, such as BasicCStringView or
+// BasicStaticString. The result is the same as for the string view of the
+// object.
+template <class StringViewLike,
+          class = std::enable_if_t<internal::kIsStringViewLike<
+              StringViewLike,
+              typename StringViewLike::value_type,
+              typename StringViewLike::traits_type>>>
+constexpr auto HashString(const StringViewLike& str,
+                          const uint64_t seed = 0) noexcept -> uint64_t {
+  using CharT = typename StringViewLike::value_type;
+  using Traits = typename StringViewLike::traits_type;
+  return HashString(std::basic_string_view<CharT, Traits>(str), seed);
+}
+
+// Transparent hasher of strings.
+// Accepts any type which is convertible to the string view.
+template <class CharT, class Traits = std::char_traits<CharT>>
+struct BasicStringHash {
+  using is_transparent = void;
+
+  template <class T,
+            class = std::enable_if_t<
+                internal::kIsStringViewLike<T, CharT, Traits>>>
+  constexpr auto operator()(const T& str) const noexcept -> std::size_t {
+    return std::size_t(
+        HashString(std::basic_string_view<CharT, Traits>(str)));
+  }
+};
+
+// Transparent equality comparator of strings.
+// Accepts any types which are convertible to the string view.
+template <class CharT, class Traits = std::char_traits<CharT>>
+struct BasicStringEqual {
+  using is_transparent = void;
+
+  template <class T,
+            class U,
+            class = std::enable_if_t<
+                internal::kIsStringViewLike<T, CharT, Traits> &&
+                internal::kIsStringViewLike<U, CharT, Traits>>>
+  constexpr auto operator()(const T& lhs, const U& rhs) const noexcept
+      -> bool {
+    return std::basic_string_view<CharT, Traits>(lhs) ==
+           std::basic_string_view<CharT, Traits>(rhs);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Type definitions for common character types.
+
+using StringHash = BasicStringHash<char>;
+using StringEqual = BasicStringEqual<char>;
+
+}  // namespace TL_STRING_HASH_VERSION_NAMESPACE
+}  // namespace TL_STRING_HASH_NAMESPACE
+
+#undef TL_STRING_HASH_VERSION_MAJOR
+#undef TL_STRING_HASH_VERSION_MINOR
+#undef TL_STRING_HASH_VERSION_REVISION
+
+#undef TL_STRING_HASH_VERSION_NAMESPACE
+
+#undef TL_STRING_HASH_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STRING_HASH_VERSION_NAMESPACE_CONCAT
+#undef TL_STRING_HASH_NAMESPACE
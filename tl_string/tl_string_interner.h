@@ -0,0 +1,413 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// A thread-safe table of unique strings.
+//
+// StringInterner keeps a single null-terminated copy of every distinct string
+// passed to it, and returns a handle to that copy. Handles of equal strings are
+// equal, so interned strings can be compared by their data pointer instead of
+// their content, and a repeated string costs a handle rather than a copy.
+//
+//   StringInterner interner;
+//
+//   const CStringView a = interner.Intern("flac");
+//   const CStringView b = interner.Intern(std::string("flac"));
+//   assert(a.data() == b.data());
+//
+// The strings are stored in arenas owned by the interner and stay valid for the
+// lifetime of the interner: the returned CStringView can be stored and passed
+// to C APIs without copying.
+//
+// In addition to the string view handle every interned string has a 32-bit
+// StringID, which is useful when many handles are to be stored in a compact
+// form. The string is looked up from its ID with GetString().
+//
+// Thread safety
+// =============
+//
+// All methods of the interner can be called concurrently.
+//
+// The interner is split into a number of stripes, each with its own mutex,
+// arena, and hash table. A string is assigned to a stripe by its hash, so
+// threads which intern different strings rarely contend on the same mutex.
+//
+// Memory
+// ======
+//
+// Characters of the strings are allocated from per-stripe MonotonicArena, which
+// requests chunks from the upstream memory resource provided to the interner.
+// The hash tables and the ID tables are allocated from the upstream directly.
+// Memory is only returned to the upstream when the interner is destroyed.
+//
+//
+// Exceptions
+// ==========
+//
+// General notes on exceptions:
+//
+//  - If an exception is thrown for any reason, functions have no effect
+//    (strong exception guarantee).
+//
+//  - If the upstream memory resource fails to allocate memory its exception
+//    is propagated to the caller.
+//
+//  - If a stripe runs out of the IDs an std::length_error exception is thrown.
+//
+//  - If GetString() is called with an ID which has not been returned by the
+//    interner an std::out_of_range exception is thrown.
+//
+// When code is compiled without exceptions instead of throwing exception the
+// code aborts the program execution.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "tl_cstring_view.h"
+#include "tl_memory/tl_monotonic_arena.h"
+#include "tl_string_hash.h"
+
+// Semantic version of the tl_string_interner library.
+#define TL_STRING_INTERNER_VERSION_MAJOR 0
+#define TL_STRING_INTERNER_VERSION_MINOR 0
+#define TL_STRING_INTERNER_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STRING_INTERNER_NAMESPACE
+#  define TL_STRING_INTERNER_NAMESPACE tiny_lib::string_interner
+#endif
+
+// Namespace in which the MonotonicArena is defined.
+// Is to be defined when the tl_monotonic_arena library is configured to use a
+// non-default namespace.
+#ifndef TL_STRING_INTERNER_MONOTONIC_ARENA_NAMESPACE
+#  define TL_STRING_INTERNER_MONOTONIC_ARENA_NAMESPACE                         \
+    tiny_lib::monotonic_arena
+#endif
+
+// Namespace in which the BasicCStringView is defined.
+// Is to be defined when the tl_cstring_view library is configured to use a
+// non-default namespace.
+#ifndef TL_STRING_INTERNER_CSTRING_VIEW_NAMESPACE
+#  define TL_STRING_INTERNER_CSTRING_VIEW_NAMESPACE tiny_lib::cstring_view
+#endif
+
+// Namespace in which the string hash is defined.
+// Is to be defined when the tl_string_hash library is configured to use a
+// non-default namespace.
+#ifndef TL_STRING_INTERNER_STRING_HASH_NAMESPACE
+#  define TL_STRING_INTERNER_STRING_HASH_NAMESPACE tiny_lib::string_hash
+#endif
+
+// Helpers for TL_STRING_INTERNER_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STRING_INTERNER_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)      \
+  v_##id1##_##id2##_##id3
+#define TL_STRING_INTERNER_VERSION_NAMESPACE_CONCAT(id1, id2, id3)             \
+  TL_STRING_INTERNER_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STRING_INTERNER_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STRING_INTERNER_VERSION_NAMESPACE                                   \
+  TL_STRING_INTERNER_VERSION_NAMESPACE_CONCAT(                                 \
+      TL_STRING_INTERNER_VERSION_MAJOR,                                        \
+      TL_STRING_INTERNER_VERSION_MINOR,                                        \
+      TL_STRING_INTERNER_VERSION_REVISION)
+
+// Throw an exception of the given type ExceptionType if the expression is
+// evaluated to a truthful value.
+// The default implementation throws an ExceptionType(#expression) if the
+// condition is met.
+// If the default behavior is not suitable for the application it should define
+// TL_STRING_INTERNER_THROW_IF prior to including this header. The provided
+// implementation is not to return, otherwise an undefined behavior of memory
+// corruption will happen.
+#if !defined(TL_STRING_INTERNER_THROW_IF)
+#  define TL_STRING_INTERNER_THROW_IF(ExceptionType, expression)               \
+    internal::ThrowIfOrAbort<ExceptionType>(expression, #expression)
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STRING_INTERNER_NAMESPACE {
+inline namespace TL_STRING_INTERNER_VERSION_NAMESPACE {
+
+using TL_STRING_INTERNER_CSTRING_VIEW_NAMESPACE::CStringView;
+
+// Compact identifier of an interned string.
+enum class StringID : uint32_t {};
+
+namespace internal {
+
+// If the exceptions are enabled throws a new exception of the given type
+// passing the given expression_str to its constructor as a reason. If the
+// exceptions are disabled aborts the program execution.
+template <class Exception>
+[[noreturn]] inline void ThrowOrAbort(const char* expression_str) {
+#if defined(__cpp_exceptions) && __cpp_exceptions >= 199711L
+  throw Exception(expression_str);
+#else
+  (void)expression_str;
+  __builtin_abort();
+#endif
+}
+
+// A default implementation of the TL_STRING_INTERNER_THROW_IF().
+template <class Exception>
+inline void ThrowIfOrAbort(const bool expression_eval,
+                           const char* expression_str) {
+  if (expression_eval) {
+    ThrowOrAbort<Exception>(expression_str);
+  }
+}
+
+// Number of bits of the StringID which encode the stripe.
+inline constexpr int kNumStripeBits = 4;
+inline constexpr std::size_t kNumStripes = std::size_t(1) << kNumStripeBits;
+
+// The largest number of strings in a single stripe.
+inline constexpr std::size_t kMaxStringsPerStripe =
+    std::size_t(1) << (32 - kNumStripeBits);
+
+// Size of a cache line, used to avoid false sharing between the stripes.
+inline constexpr std::size_t kCacheLineSize = 64;
+
+// A string stored in the arena of a stripe.
+//
+// Follows the minimal interface of the std::string which is needed to
+// construct the CStringView, which allows to construct it without calculating
+// the length of the string.
+struct StoredString {
+  using value_type = char;
+  using traits_type = std::char_traits<char>;
+
+  auto c_str() const -> const char* { return data; }
+  auto size() const -> std::size_t { return length; }
+
+  const char* data;
+  std::size_t length;
+};
+
+// Slot of the open addressing hash table.
+struct Slot {
+  // Lower 32 bits of the hash of the string.
+  uint32_t hash;
+
+  // Index of the string in the stripe plus one, 0 for an empty slot.
+  uint32_t index_plus_one;
+};
+
+// A part of the interner which is protected by its own mutex.
+class alignas(kCacheLineSize) Stripe {
+ public:
+  explicit Stripe(std::pmr::memory_resource* upstream)
+      : arena_(upstream), slots_(upstream), strings_(upstream) {}
+
+  // Find the string in the stripe, inserting its copy if it is not there yet.
+  // Returns index of the string within the stripe.
+  auto FindOrInsert(const std::string_view str, const uint64_t hash)
+      -> std::pair<CStringView, uint32_t> {
+    const uint32_t short_hash = uint32_t(hash);
+
+    std::lock_guard lock(mutex_);
+
+    if (!slots_.empty()) {
+      const std::size_t mask = slots_.size() - 1;
+      for (std::size_t i = short_hash & mask;; i = (i + 1) & mask) {
+        const Slot& slot = slots_[i];
+        if (slot.index_plus_one == 0) {
+          break;
+        }
+        if (slot.hash == short_hash) {
+          const StoredString& stored = strings_[slot.index_plus_one - 1];
+          if (std::string_view(stored.data, stored.length) == str) {
+            return {CStringView(stored), slot.index_plus_one - 1};
+          }
+        }
+      }
+    }
+
+    TL_STRING_INTERNER_THROW_IF(std::length_error,
+                                strings_.size() >= kMaxStringsPerStripe);
+
+    // Make sure all the allocations succeed before the string is inserted.
+    // The load factor is kept at 3/4 at most.
+    if ((strings_.size() + 1) * 4 > slots_.size() * 3) {
+      Rehash(slots_.empty() ? 16 : slots_.size() * 2);
+    }
+    strings_.reserve(strings_.size() + 1);
+
+    char* data = static_cast<char*>(arena_.Allocate(str.size() + 1, 1));
+    std::memcpy(data, str.data(), str.size());
+    data[str.size()] = '\0';
+
+    const uint32_t index = uint32_t(strings_.size());
+    strings_.push_back({data, str.size()});
+    InsertSlot({short_hash, index + 1});
+
+    return {CStringView(strings_.back()), index};
+  }
+
+  // Get string with the given index within the stripe.
+  auto GetString(const uint32_t index) const -> CStringView {
+    std::lock_guard lock(mutex_);
+    TL_STRING_INTERNER_THROW_IF(std::out_of_range, index >= strings_.size());
+    return CStringView(strings_[index]);
+  }
+
+  auto GetNumStrings() const -> std::size_t {
+    std::lock_guard lock(mutex_);
+    return strings_.size();
+  }
+
+ private:
+  void Rehash(const std::size_t num_slots) {
+    std::pmr::vector<Slot> old_slots(num_slots, Slot{0, 0},
+                                     slots_.get_allocator());
+    old_slots.swap(slots_);
+    for (const Slot& slot : old_slots) {
+      if (slot.index_plus_one != 0) {
+        InsertSlot(slot);
+      }
+    }
+  }
+
+  // Insert the slot into the table which is known to have a free slot and to
+  // not have a string with the same index.
+  void InsertSlot(const Slot& new_slot) {
+    const std::size_t mask = slots_.size() - 1;
+    std::size_t i = new_slot.hash & mask;
+    while (slots_[i].index_plus_one != 0) {
+      i = (i + 1) & mask;
+    }
+    slots_[i] = new_slot;
+  }
+
+  mutable std::mutex mutex_;
+
+  // Storage of the characters of the strings.
+  TL_STRING_INTERNER_MONOTONIC_ARENA_NAMESPACE::MonotonicArena arena_;
+
+  // Open addressing hash table with linear probing. The size is either 0 or a
+  // power of two.
+  std::pmr::vector<Slot> slots_;
+
+  // Strings of the stripe, indexed by their index within the stripe.
+  std::pmr::vector<StoredString> strings_;
+};
+
+}  // namespace internal
+
+class StringInterner {
+ public:
+  // Construct the interner which allocates memory from the given upstream.
+  explicit StringInterner(std::pmr::memory_resource* upstream =
+                              std::pmr::get_default_resource())
+      : StringInterner(upstream,
+                       std::make_index_sequence<internal::kNumStripes>()) {}
+
+  StringInterner(const StringInterner& other) = delete;
+  StringInterner(StringInterner&& other) noexcept = delete;
+
+  ~StringInterner() = default;
+
+  auto operator=(const StringInterner& other) -> StringInterner& = delete;
+  auto operator=(StringInterner&& other) -> StringInterner& = delete;
+
+  // Get the interned copy of the string, inserting it if needed.
+  //
+  // The returned view stays valid for the lifetime of the interner, and has
+  // the same data() pointer for all equal strings.
+  auto Intern(const std::string_view str) -> CStringView {
+    return InternWithID(str).first;
+  }
+
+  // Get identifier of the interned copy of the string, inserting it if needed.
+  auto InternID(const std::string_view str) -> StringID {
+    return InternWithID(str).second;
+  }
+
+  // Get both the view and the identifier of the interned copy of the string,
+  // inserting it if needed.
+  auto InternWithID(const std::string_view str)
+      -> std::pair<CStringView, StringID> {
+    const uint64_t hash =
+        TL_STRING_INTERNER_STRING_HASH_NAMESPACE::HashString(str);
+
+    // The stripe is chosen by the upper bits of the hash, and the lower bits
+    // are used by the hash table of the stripe.
+    const std::size_t stripe = hash >> (64 - internal::kNumStripeBits);
+
+    const auto [view, index] = stripes_[stripe].FindOrInsert(str, hash);
+    return {view,
+            StringID((index << internal::kNumStripeBits) | uint32_t(stripe))};
+  }
+
+  // Get the interned string with the given identifier.
+  //
+  // The identifier is to be returned by this interner, otherwise an
+  // std::out_of_range exception is thrown.
+  auto GetString(const StringID id) const -> CStringView {
+    const uint32_t value = uint32_t(id);
+    const uint32_t stripe = value & (internal::kNumStripes - 1);
+    return stripes_[stripe].GetString(value >> internal::kNumStripeBits);
+  }
+
+  // Get the number of distinct strings in the interner.
+  //
+  // When the interner is used concurrently the result is only an estimate.
+  auto GetNumStrings() const -> std::size_t {
+    std::size_t num_strings = 0;
+    for (const internal::Stripe& stripe : stripes_) {
+      num_strings += stripe.GetNumStrings();
+    }
+    return num_strings;
+  }
+
+ private:
+  template <std::size_t... I>
+  StringInterner(std::pmr::memory_resource* upstream,
+                 std::index_sequence<I...> /*indices*/)
+      : stripes_{internal::Stripe(((void)I, upstream))...} {}
+
+  internal::Stripe stripes_[internal::kNumStripes];
+};
+
+}  // namespace TL_STRING_INTERNER_VERSION_NAMESPACE
+}  // namespace TL_STRING_INTERNER_NAMESPACE
+
+#undef TL_STRING_INTERNER_VERSION_MAJOR
+#undef TL_STRING_INTERNER_VERSION_MINOR
+#undef TL_STRING_INTERNER_VERSION_REVISION
+
+#undef TL_STRING_INTERNER_VERSION_NAMESPACE
+
+#undef TL_STRING_INTERNER_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STRING_INTERNER_VERSION_NAMESPACE_CONCAT
+#undef TL_STRING_INTERNER_NAMESPACE
+
+#undef TL_STRING_INTERNER_MONOTONIC_ARENA_NAMESPACE
+#undef TL_STRING_INTERNER_CSTRING_VIEW_NAMESPACE
+#undef TL_STRING_INTERNER_STRING_HASH_NAMESPACE
+
+#undef TL_STRING_INTERNER_THROW_IF
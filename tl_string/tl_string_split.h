@@ -0,0 +1,346 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Lazy splitting of strings into fields.
+//
+// Split() and SplitAny() return a light-weight range which yields fields of the
+// input string as std::string_view. The fields are found one at a time as the
+// range is iterated, nothing is copied and nothing is allocated. The input
+// string is to outlive the range.
+//
+//   for (std::string_view field : Split("a,b,,c", ',')) {
+//     // "a", "b", "", "c"
+//   }
+//
+//   for (std::string_view word : SplitAny(line, " \t", {.skip_empty = true})) {
+//     // Words separated by any number of spaces and tabs.
+//   }
+//
+// The delimiter is either a single character, a string, or (for SplitAny()) a
+// set of characters. Any type which is convertible to std::string_view can be
+// split, including BasicStaticString and BasicCStringView.
+//
+// Behavior of the splitting is controlled with the SplitOptions:
+//
+//   - skip_empty: Do not yield fields which are empty (after trimming when it
+//     is enabled). Useful to collapse multiple delimiters in a row.
+//
+//   - trim: Remove ASCII whitespace from both ends of every field.
+//
+// Without options the number of fields is always the number of delimiters plus
+// one: an empty string yields a single empty field.
+//
+// Delimiter search
+// ================
+//
+// A single character and a string delimiter are found using the search of the
+// std::string_view, which uses memchr() at run time. A set of characters is
+// converted to a 256-bit table, so that every character of the input is checked
+// with a single lookup regardless of the size of the set.
+//
+// All functions are usable in constant expressions.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+// Semantic version of the tl_string_split library.
+#define TL_STRING_SPLIT_VERSION_MAJOR 0
+#define TL_STRING_SPLIT_VERSION_MINOR 0
+#define TL_STRING_SPLIT_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STRING_SPLIT_NAMESPACE
+#  define TL_STRING_SPLIT_NAMESPACE tiny_lib::string_split
+#endif
+
+// Helpers for TL_STRING_SPLIT_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STRING_SPLIT_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)         \
+  v_##id1##_##id2##_##id3
+#define TL_STRING_SPLIT_VERSION_NAMESPACE_CONCAT(id1, id2, id3)                \
+  TL_STRING_SPLIT_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STRING_SPLIT_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STRING_SPLIT_VERSION_NAMESPACE                                      \
+  TL_STRING_SPLIT_VERSION_NAMESPACE_CONCAT(TL_STRING_SPLIT_VERSION_MAJOR,      \
+                                           TL_STRING_SPLIT_VERSION_MINOR,      \
+                                           TL_STRING_SPLIT_VERSION_REVISION)
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STRING_SPLIT_NAMESPACE {
+inline namespace TL_STRING_SPLIT_VERSION_NAMESPACE {
+
+struct SplitOptions {
+  // Do not yield empty fields.
+  bool skip_empty = false;
+
+  // Remove ASCII whitespace from both ends of every field.
+  bool trim = false;
+};
+
+namespace internal {
+
+// Location of a delimiter in a string.
+struct DelimiterMatch {
+  // Index of the first character of the delimiter, or npos if there is no
+  // delimiter in the string.
+  std::size_t index;
+
+  // Number of characters in the delimiter.
+  std::size_t length;
+};
+
+// Delimiter which is a single character.
+class CharDelimiter {
+ public:
+  constexpr CharDelimiter() = default;
+  constexpr explicit CharDelimiter(const char ch) : ch_(ch) {}
+
+  constexpr auto Find(const std::string_view str) const -> DelimiterMatch {
+    return {str.find(ch_), 1};
+  }
+
+ private:
+  char ch_{'\0'};
+};
+
+// Delimiter which is a string.
+// An empty string delimiter never matches.
+class StringDelimiter {
+ public:
+  constexpr StringDelimiter() = default;
+  constexpr explicit StringDelimiter(const std::string_view delimiter)
+      : delimiter_(delimiter) {}
+
+  constexpr auto Find(const std::string_view str) const -> DelimiterMatch {
+    if (delimiter_.empty()) {
+      return {std::string_view::npos, 0};
+    }
+    return {str.find(delimiter_), delimiter_.size()};
+  }
+
+ private:
+  std::string_view delimiter_;
+};
+
+// Delimiter which is any character from a set.
+class AnyOfDelimiter {
+ public:
+  constexpr AnyOfDelimiter() = default;
+  constexpr explicit AnyOfDelimiter(const std::string_view set) {
+    for (const char ch : set) {
+      const uint8_t byte = uint8_t(ch);
+      table_[byte / 64] |= uint64_t(1) << (byte % 64);
+    }
+  }
+
+  constexpr auto Find(const std::string_view str) const -> DelimiterMatch {
+    for (std::size_t i = 0; i < str.size(); ++i) {
+      const uint8_t byte = uint8_t(str[i]);
+      if (table_[byte / 64] & (uint64_t(1) << (byte % 64))) {
+        return {i, 1};
+      }
+    }
+    return {std::string_view::npos, 1};
+  }
+
+ private:
+  uint64_t table_[4]{};
+};
+
+constexpr auto IsASCIISpace(const char ch) -> bool {
+  return ch == ' ' || (ch >= '\t' && ch <= '\r');
+}
+
+constexpr auto TrimASCIISpace(std::string_view str) -> std::string_view {
+  while (!str.empty() && IsASCIISpace(str.front())) {
+    str.remove_prefix(1);
+  }
+  while (!str.empty() && IsASCIISpace(str.back())) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+}  // namespace internal
+
+// A range of fields of a string separated by a delimiter.
+// The range is a view: it is cheap to copy and does not own the string.
+template <class Delimiter>
+class SplitRange : public std::ranges::view_interface<SplitRange<Delimiter>> {
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view*;
+    // The fields are returned by value, so that they stay valid when the
+    // iterator is advanced or destroyed.
+    using reference = std::string_view;
+
+    constexpr Iterator() = default;
+
+    constexpr auto operator*() const -> reference { return field_; }
+    constexpr auto operator->() const -> pointer { return &field_; }
+
+    constexpr auto operator++() -> Iterator& {
+      Advance();
+      return *this;
+    }
+    constexpr auto operator++(int) -> Iterator {
+      Iterator result = *this;
+      Advance();
+      return result;
+    }
+
+    constexpr auto operator==(const Iterator& other) const -> bool {
+      if (at_end_ || other.at_end_) {
+        return at_end_ == other.at_end_;
+      }
+      return field_.data() == other.field_.data() &&
+             field_.size() == other.field_.size() &&
+             remaining_.data() == other.remaining_.data();
+    }
+
+    constexpr auto operator==(std::default_sentinel_t /*sentinel*/) const
+        -> bool {
+      return at_end_;
+    }
+
+   private:
+    friend class SplitRange;
+
+    constexpr explicit Iterator(const SplitRange& range)
+        : delimiter_(range.delimiter_),
+          options_(range.options_),
+          remaining_(range.str_),
+          at_end_(false) {
+      Advance();
+    }
+
+    // Find the next field which passes the options, or mark the iterator as
+    // being at the end.
+    constexpr void Advance() {
+      while (true) {
+        if (is_last_field_) {
+          at_end_ = true;
+          return;
+        }
+
+        const internal::DelimiterMatch match =
+            delimiter_.Find(remaining_);
+        if (match.index == std::string_view::npos) {
+          field_ = remaining_;
+          remaining_ = remaining_.substr(remaining_.size());
+          is_last_field_ = true;
+        } else {
+          field_ = remaining_.substr(0, match.index);
+          remaining_.remove_prefix(match.index + match.length);
+        }
+
+        if (options_.trim) {
+          field_ = internal::TrimASCIISpace(field_);
+        }
+        if (options_.skip_empty && field_.empty()) {
+          continue;
+        }
+
+        return;
+      }
+    }
+
+    Delimiter delimiter_{};
+    SplitOptions options_;
+
+    // The current field.
+    std::string_view field_;
+
+    // Part of the string past the delimiter which follows the current field.
+    std::string_view remaining_;
+
+    // True when the current field is the last one in the string.
+    bool is_last_field_{false};
+
+    // True when the iterator is past the last field.
+    bool at_end_{true};
+  };
+
+  constexpr SplitRange(const std::string_view str,
+                       const Delimiter& delimiter,
+                       const SplitOptions& options)
+      : str_(str), delimiter_(delimiter), options_(options) {}
+
+  // The iterators only refer to the string, and stay valid when the range
+  // itself is destroyed.
+  constexpr auto begin() const -> Iterator { return Iterator(*this); }
+  constexpr auto end() const -> std::default_sentinel_t { return {}; }
+
+ private:
+  std::string_view str_;
+  Delimiter delimiter_;
+  SplitOptions options_;
+};
+
+// Split the string into fields separated by the given delimiter character.
+inline constexpr auto Split(const std::string_view str,
+                            const char delimiter,
+                            const SplitOptions& options = {})
+    -> SplitRange<internal::CharDelimiter> {
+  return {str, internal::CharDelimiter(delimiter), options};
+}
+
+// Split the string into fields separated by the given delimiter string.
+// An empty delimiter yields the entire string as a single field.
+inline constexpr auto Split(const std::string_view str,
+                            const std::string_view delimiter,
+                            const SplitOptions& options = {})
+    -> SplitRange<internal::StringDelimiter> {
+  return {str, internal::StringDelimiter(delimiter), options};
+}
+
+// Split the string into fields separated by any of the characters from the
+// given set.
+inline constexpr auto SplitAny(const std::string_view str,
+                               const std::string_view set,
+                               const SplitOptions& options = {})
+    -> SplitRange<internal::AnyOfDelimiter> {
+  return {str, internal::AnyOfDelimiter(set), options};
+}
+
+}  // namespace TL_STRING_SPLIT_VERSION_NAMESPACE
+}  // namespace TL_STRING_SPLIT_NAMESPACE
+
+// The fields refer to the split string rather than to the range, so they can
+// be used after the range is destroyed.
+template <class Delimiter>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    TL_STRING_SPLIT_NAMESPACE::SplitRange<Delimiter>> = true;
+
+#undef TL_STRING_SPLIT_VERSION_MAJOR
+#undef TL_STRING_SPLIT_VERSION_MINOR
+#undef TL_STRING_SPLIT_VERSION_REVISION
+
+#undef TL_STRING_SPLIT_VERSION_NAMESPACE
+
+#undef TL_STRING_SPLIT_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STRING_SPLIT_VERSION_NAMESPACE_CONCAT
+#undef TL_STRING_SPLIT_NAMESPACE
@@ -0,0 +1,283 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Dispatch on strings using a perfect hash table built at compile time.
+//
+// StringSwitch maps a fixed set of strings known at compile time to their
+// indices. The lookup computes a single hash of the string, finds the only
+// candidate in the table, and verifies it with a single comparison. This makes
+// the dispatch O(1) regardless of the number of strings, without constructing
+// any table at run time:
+//
+//   constexpr auto kCommands = MakeStringSwitch("open", "close", "read");
+//
+//   switch (kCommands.Find(command)) {
+//     case kCommands.IndexOf("open"): ...; break;
+//     case kCommands.IndexOf("close"): ...; break;
+//     case kCommands.IndexOf("read"): ...; break;
+//     case kCommands.kNotFound: ...; break;
+//   }
+//
+// The index of a string is its position in the MakeStringSwitch() arguments.
+// IndexOf() is evaluated at compile time, and a typo in the string fails the
+// compilation rather than silently falling back to the kNotFound branch.
+//
+// Find() accepts any type convertible to std::string_view, including
+// BasicCStringView and BasicStaticString.
+//
+// The strings passed to the MakeStringSwitch() are to have static storage
+// duration, which is the case for string literals.
+//
+// Table construction
+// ==================
+//
+// The table is built using the "hash and displace" scheme. The 64-bit hash of
+// every string selects a bucket, and every bucket stores a displacement which
+// is mixed with the hash to get the slot of the string in the table. The
+// displacements are found at compile time starting from the largest buckets,
+// so that all strings end up in distinct slots. The table has twice as many
+// slots as there are strings, which keeps the search for displacements short.
+//
+// Duplicate strings and sets of strings for which the table can not be built
+// fail the compilation.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "tl_string_hash.h"
+
+// Semantic version of the tl_string_switch library.
+#define TL_STRING_SWITCH_VERSION_MAJOR 0
+#define TL_STRING_SWITCH_VERSION_MINOR 0
+#define TL_STRING_SWITCH_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_STRING_SWITCH_NAMESPACE
+#  define TL_STRING_SWITCH_NAMESPACE tiny_lib::string_switch
+#endif
+
+// Namespace in which the string hash is defined.
+// Is to be defined when the tl_string_hash library is configured to use a
+// non-default namespace.
+#ifndef TL_STRING_SWITCH_STRING_HASH_NAMESPACE
+#  define TL_STRING_SWITCH_STRING_HASH_NAMESPACE tiny_lib::string_hash
+#endif
+
+// Helpers for TL_STRING_SWITCH_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_STRING_SWITCH_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)        \
+  v_##id1##_##id2##_##id3
+#define TL_STRING_SWITCH_VERSION_NAMESPACE_CONCAT(id1, id2, id3)               \
+  TL_STRING_SWITCH_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_STRING_SWITCH_VERSION_NAMESPACE -> v_0_1_9
+#define TL_STRING_SWITCH_VERSION_NAMESPACE                                     \
+  TL_STRING_SWITCH_VERSION_NAMESPACE_CONCAT(TL_STRING_SWITCH_VERSION_MAJOR,    \
+                                            TL_STRING_SWITCH_VERSION_MINOR,    \
+                                            TL_STRING_SWITCH_VERSION_REVISION)
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_STRING_SWITCH_NAMESPACE {
+inline namespace TL_STRING_SWITCH_VERSION_NAMESPACE {
+
+namespace internal {
+
+// Report an error in the construction of the string switch.
+//
+// The function is intentionally not constexpr: calling it from the compile
+// time construction of the table fails the compilation, and the compiler error
+// points to the call with the description of the error.
+inline void StringSwitchError(const char* /*message*/) {}
+
+// Finalization mix of the MurmurHash3.
+inline constexpr auto MixBits(uint64_t x) -> uint64_t {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+// The largest displacement which is tried for a bucket.
+inline constexpr uint32_t kMaxDisplacement = 1 << 20;
+
+}  // namespace internal
+
+template <std::size_t N>
+class StringSwitch {
+  static_assert(N > 0, "StringSwitch needs at least one string");
+
+ public:
+  // Result of Find() for strings which are not in the switch.
+  static constexpr std::size_t kNotFound = std::size_t(-1);
+
+  // Build the table for the given strings.
+  // The strings are to have static storage duration.
+  consteval explicit StringSwitch(const std::array<std::string_view, N>& keys)
+      : keys_(keys) {
+    Build();
+  }
+
+  // Get index of the string in the switch, or kNotFound if the string is not
+  // in the switch.
+  constexpr auto Find(const std::string_view str) const -> std::size_t {
+    const uint64_t hash =
+        TL_STRING_SWITCH_STRING_HASH_NAMESPACE::HashString(str);
+    const uint32_t displacement = displacements_[GetBucket(hash)];
+    const uint32_t index = slots_[GetSlot(hash, displacement)];
+    if (index == kEmptySlot || keys_[index] != str) {
+      return kNotFound;
+    }
+    return index;
+  }
+
+  // Get index of the string which is known to be in the switch.
+  // Fails the compilation if the string is not in the switch.
+  consteval auto IndexOf(const std::string_view str) const -> std::size_t {
+    const std::size_t index = Find(str);
+    if (index == kNotFound) {
+      internal::StringSwitchError("String is not in the switch");
+    }
+    return index;
+  }
+
+  // Get the string with the given index.
+  constexpr auto GetKey(const std::size_t index) const -> std::string_view {
+    return keys_[index];
+  }
+
+  // Get the number of strings in the switch.
+  static constexpr auto size() -> std::size_t { return N; }
+
+ private:
+  static constexpr std::size_t kNumSlots = std::bit_ceil(2 * N);
+  static constexpr std::size_t kNumBuckets = std::bit_ceil(N);
+
+  static constexpr uint32_t kEmptySlot = uint32_t(-1);
+
+  static constexpr auto GetBucket(const uint64_t hash) -> std::size_t {
+    return (hash >> 32) & (kNumBuckets - 1);
+  }
+
+  static constexpr auto GetSlot(const uint64_t hash,
+                                const uint32_t displacement) -> std::size_t {
+    return internal::MixBits(hash ^ displacement) & (kNumSlots - 1);
+  }
+
+  consteval void Build() {
+    std::array<uint64_t, N> hashes{};
+    for (std::size_t i = 0; i < N; ++i) {
+      hashes[i] = TL_STRING_SWITCH_STRING_HASH_NAMESPACE::HashString(keys_[i]);
+      for (std::size_t j = 0; j < i; ++j) {
+        if (keys_[i] == keys_[j]) {
+          internal::StringSwitchError("Duplicate string in the switch");
+        }
+        if (hashes[i] == hashes[j]) {
+          internal::StringSwitchError("Hash collision of strings");
+        }
+      }
+    }
+
+    std::array<std::size_t, kNumBuckets> bucket_sizes{};
+    std::size_t max_bucket_size = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+      const std::size_t bucket_size = ++bucket_sizes[GetBucket(hashes[i])];
+      if (bucket_size > max_bucket_size) {
+        max_bucket_size = bucket_size;
+      }
+    }
+
+    slots_.fill(kEmptySlot);
+
+    // Place the largest buckets first, while the table is mostly empty.
+    for (std::size_t size = max_bucket_size; size > 0; --size) {
+      for (std::size_t bucket = 0; bucket < kNumBuckets; ++bucket) {
+        if (bucket_sizes[bucket] == size) {
+          PlaceBucket(hashes, bucket);
+        }
+      }
+    }
+  }
+
+  // Find the displacement for the bucket for which all its strings land into
+  // distinct empty slots, and occupy the slots.
+  consteval void PlaceBucket(const std::array<uint64_t, N>& hashes,
+                             const std::size_t bucket) {
+    for (uint32_t displacement = 0; displacement < internal::kMaxDisplacement;
+         ++displacement) {
+      std::array<bool, kNumSlots> used{};
+      bool fits = true;
+      for (std::size_t i = 0; i < N && fits; ++i) {
+        if (GetBucket(hashes[i]) != bucket) {
+          continue;
+        }
+        const std::size_t slot = GetSlot(hashes[i], displacement);
+        if (slots_[slot] != kEmptySlot || used[slot]) {
+          fits = false;
+        }
+        used[slot] = true;
+      }
+      if (!fits) {
+        continue;
+      }
+
+      displacements_[bucket] = displacement;
+      for (std::size_t i = 0; i < N; ++i) {
+        if (GetBucket(hashes[i]) == bucket) {
+          slots_[GetSlot(hashes[i], displacement)] = uint32_t(i);
+        }
+      }
+      return;
+    }
+
+    internal::StringSwitchError("Unable to build perfect hash table");
+  }
+
+  std::array<std::string_view, N> keys_{};
+  std::array<uint32_t, kNumBuckets> displacements_{};
+  std::array<uint32_t, kNumSlots> slots_{};
+};
+
+// Construct the string switch for the given strings.
+// The index of the string in the switch is its position in the arguments.
+template <class... Strings>
+consteval auto MakeStringSwitch(const Strings&... strings)
+    -> StringSwitch<sizeof...(Strings)> {
+  return StringSwitch<sizeof...(Strings)>(
+      std::array<std::string_view, sizeof...(Strings)>{
+          std::string_view(strings)...});
+}
+
+}  // namespace TL_STRING_SWITCH_VERSION_NAMESPACE
+}  // namespace TL_STRING_SWITCH_NAMESPACE
+
+#undef TL_STRING_SWITCH_VERSION_MAJOR
+#undef TL_STRING_SWITCH_VERSION_MINOR
+#undef TL_STRING_SWITCH_VERSION_REVISION
+
+#undef TL_STRING_SWITCH_VERSION_NAMESPACE
+
+#undef TL_STRING_SWITCH_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_STRING_SWITCH_VERSION_NAMESPACE_CONCAT
+#undef TL_STRING_SWITCH_NAMESPACE
+
+#undef TL_STRING_SWITCH_STRING_HASH_NAMESPACE
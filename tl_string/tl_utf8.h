@@ -0,0 +1,460 @@
+// Copyright (c) 2026 tiny lib authors
+//
+// SPDX-License-Identifier: MIT-0
+
+// Validation of UTF-8 strings and their conversion to UTF-16 and UTF-32.
+//
+// The validation follows the well-formed byte sequences table of the Unicode
+// standard (Table 3-7): overlong encodings, surrogate code points, code points
+// above U+10FFFF, and truncated sequences are rejected.
+//
+//   if (!IsValidUTF8(metadata)) {
+//     return false;
+//   }
+//
+// The conversion functions write code units to a span provided by the caller
+// and never allocate. The result tells how many code units were written and
+// whether the conversion succeeded, in the same manner as std::to_chars():
+//
+//   char16_t buffer[256];
+//   const TranscodeResult result = ConvertUTF8ToUTF16(name, buffer);
+//   if (result.ec != std::errc()) {
+//     // Either std::errc::illegal_byte_sequence for an invalid input, or
+//     // std::errc::value_too_large if the buffer is too small.
+//   }
+//
+// AssignFromUTF8() converts into a string-like container which provides
+// resize() and data(), such as std::u16string or a BasicStaticString of
+// char16_t, char32_t, or wchar_t.
+//
+// Performance
+// ===========
+//
+// Text in file names and metadata is mostly ASCII, so the functions check 16
+// bytes at a time using SSE2 or NEON instructions when they are available. A
+// block of ASCII characters is skipped by the validation, and is widened to the
+// destination code units with a couple of vector instructions by the
+// conversion. Only the blocks with non-ASCII characters are decoded one code
+// point at a time.
+//
+//
+// Version history
+// ===============
+//
+//   0.0.1-alpha    (18 Oct 2026)    First public release.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "tl_build_config/tl_build_config.h"
+
+// Semantic version of the tl_utf8 library.
+#define TL_UTF8_VERSION_MAJOR 0
+#define TL_UTF8_VERSION_MINOR 0
+#define TL_UTF8_VERSION_REVISION 1
+
+// Namespace of the module.
+// The outer name spaces which surrounds the ABI-version namespace.
+#ifndef TL_UTF8_NAMESPACE
+#  define TL_UTF8_NAMESPACE tiny_lib::utf8
+#endif
+
+// Helpers for TL_UTF8_VERSION_NAMESPACE.
+//
+// Typical extra indirection for such conversion to allow macro to be expanded
+// before it is converted to string.
+#define TL_UTF8_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)                 \
+  v_##id1##_##id2##_##id3
+#define TL_UTF8_VERSION_NAMESPACE_CONCAT(id1, id2, id3)                        \
+  TL_UTF8_VERSION_NAMESPACE_CONCAT_HELPER(id1, id2, id3)
+
+// Constructs identifier suitable for namespace denoting the current library
+// version.
+//
+// For example: TL_UTF8_VERSION_NAMESPACE -> v_0_1_9
+#define TL_UTF8_VERSION_NAMESPACE                                              \
+  TL_UTF8_VERSION_NAMESPACE_CONCAT(                                            \
+      TL_UTF8_VERSION_MAJOR, TL_UTF8_VERSION_MINOR, TL_UTF8_VERSION_REVISION)
+
+// Use of the vector instructions for the ASCII fast path. Defaults to the
+// instruction sets detected by the tl_build_config, and can be defined to 0 by
+// the application to only use the scalar code.
+#if !defined(TL_UTF8_USE_SSE2)
+#  define TL_UTF8_USE_SSE2 ISA_CPU_X86_SSE2
+#endif
+#if !defined(TL_UTF8_USE_NEON)
+#  define TL_UTF8_USE_NEON (ISA_CPU_ARM_NEON && ARCH_CPU_LITTLE_ENDIAN)
+#endif
+
+#if TL_UTF8_USE_SSE2
+#  include <emmintrin.h>
+#elif TL_UTF8_USE_NEON
+#  include <arm_neon.h>
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace TL_UTF8_NAMESPACE {
+inline namespace TL_UTF8_VERSION_NAMESPACE {
+
+// Result of a conversion between encodings.
+struct TranscodeResult {
+  // Number of code units written to the destination.
+  // On failure it is the number of code units which were written before the
+  // failure has been detected.
+  std::size_t size;
+
+  // std::errc() on success.
+  // std::errc::illegal_byte_sequence if the input is not a valid UTF-8.
+  // std::errc::value_too_large if the destination is too small.
+  std::errc ec;
+};
+
+namespace internal {
+
+// Number of bytes checked at a time by the ASCII fast path.
+inline constexpr std::size_t kBlockSize = 16;
+
+#if TL_UTF8_USE_SSE2
+
+inline auto IsASCIIBlock(const uint8_t* src) -> bool {
+  const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  return _mm_movemask_epi8(v) == 0;
+}
+
+// Widen the block of ASCII characters to 16-bit code units.
+inline void WidenASCIIBlock(const uint8_t* src, uint16_t* dst) {
+  const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i zero = _mm_setzero_si128();
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi8(v, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8),
+                   _mm_unpackhi_epi8(v, zero));
+}
+
+// Widen the block of ASCII characters to 32-bit code units.
+inline void WidenASCIIBlock(const uint8_t* src, uint32_t* dst) {
+  const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i lo = _mm_unpacklo_epi8(v, zero);
+  const __m128i hi = _mm_unpackhi_epi8(v, zero);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                   _mm_unpacklo_epi16(lo, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4),
+                   _mm_unpackhi_epi16(lo, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8),
+                   _mm_unpacklo_epi16(hi, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 12),
+                   _mm_unpackhi_epi16(hi, zero));
+}
+
+#elif TL_UTF8_USE_NEON
+
+inline auto IsASCIIBlock(const uint8_t* src) -> bool {
+  const uint8x16_t v = vld1q_u8(src);
+  const uint8x8_t folded = vorr_u8(vget_low_u8(v), vget_high_u8(v));
+  return (vget_lane_u64(vreinterpret_u64_u8(folded), 0) &
+          0x8080808080808080ULL) == 0;
+}
+
+// Widen the block of ASCII characters to 16-bit code units.
+inline void WidenASCIIBlock(const uint8_t* src, uint16_t* dst) {
+  const uint8x16_t v = vld1q_u8(src);
+  vst1q_u16(dst, vmovl_u8(vget_low_u8(v)));
+  vst1q_u16(dst + 8, vmovl_u8(vget_high_u8(v)));
+}
+
+// Widen the block of ASCII characters to 32-bit code units.
+inline void WidenASCIIBlock(const uint8_t* src, uint32_t* dst) {
+  const uint8x16_t v = vld1q_u8(src);
+  const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+  const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+  vst1q_u32(dst, vmovl_u16(vget_low_u16(lo)));
+  vst1q_u32(dst + 4, vmovl_u16(vget_high_u16(lo)));
+  vst1q_u32(dst + 8, vmovl_u16(vget_low_u16(hi)));
+  vst1q_u32(dst + 12, vmovl_u16(vget_high_u16(hi)));
+}
+
+#else
+
+inline auto IsASCIIBlock(const uint8_t* src) -> bool {
+  uint8_t mask = 0;
+  for (std::size_t i = 0; i < kBlockSize; ++i) {
+    mask |= src[i];
+  }
+  return (mask & 0x80) == 0;
+}
+
+template <class UnitT>
+inline void WidenASCIIBlock(const uint8_t* src, UnitT* dst) {
+  for (std::size_t i = 0; i < kBlockSize; ++i) {
+    dst[i] = src[i];
+  }
+}
+
+#endif
+
+// Decode a single code point from the beginning of the given bytes.
+//
+// Returns the number of bytes of the code point, or 0 if the bytes do not start
+// with a well-formed UTF-8 sequence.
+inline auto DecodeCodePoint(const uint8_t* src,
+                            const std::size_t size,
+                            char32_t& code_point) -> std::size_t {
+  const uint8_t lead = src[0];
+
+  if (lead < 0x80) {
+    code_point = lead;
+    return 1;
+  }
+
+  // Number of continuation bytes and the range of the first continuation byte
+  // for the lead byte, following the Table 3-7 of the Unicode standard.
+  std::size_t num_continuation;
+  uint8_t first_min = 0x80;
+  uint8_t first_max = 0xbf;
+  if (lead < 0xc2) {
+    return 0;
+  }
+  if (lead < 0xe0) {
+    num_continuation = 1;
+    code_point = lead & 0x1f;
+  } else if (lead < 0xf0) {
+    num_continuation = 2;
+    code_point = lead & 0x0f;
+    if (lead == 0xe0) {
+      first_min = 0xa0;
+    } else if (lead == 0xed) {
+      first_max = 0x9f;
+    }
+  } else if (lead < 0xf5) {
+    num_continuation = 3;
+    code_point = lead & 0x07;
+    if (lead == 0xf0) {
+      first_min = 0x90;
+    } else if (lead == 0xf4) {
+      first_max = 0x8f;
+    }
+  } else {
+    return 0;
+  }
+
+  if (size <= num_continuation) {
+    return 0;
+  }
+
+  if (src[1] < first_min || src[1] > first_max) {
+    return 0;
+  }
+  code_point = (code_point << 6) | (src[1] & 0x3f);
+
+  for (std::size_t i = 2; i <= num_continuation; ++i) {
+    if ((src[i] & 0xc0) != 0x80) {
+      return 0;
+    }
+    code_point = (code_point << 6) | (src[i] & 0x3f);
+  }
+
+  return num_continuation + 1;
+}
+
+// Unsigned integer type of the same size as the code unit type.
+template <class UnitT>
+using UnsignedUnit =
+    std::conditional_t<sizeof(UnitT) == 2, uint16_t, uint32_t>;
+
+// Convert UTF-8 to code units of the given type: UTF-16 for 2-byte units and
+// UTF-32 for 4-byte units.
+template <class UnitT>
+auto Convert(const std::string_view src, const std::span<UnitT> dst)
+    -> TranscodeResult {
+  static_assert(sizeof(UnitT) == 2 || sizeof(UnitT) == 4);
+
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(src.data());
+  const std::size_t size = src.size();
+  UnitT* out = dst.data();
+  const std::size_t out_size = dst.size();
+
+  std::size_t i = 0;
+  std::size_t num_written = 0;
+
+  while (i < size) {
+    if (i + kBlockSize <= size && num_written + kBlockSize <= out_size &&
+        IsASCIIBlock(data + i)) {
+#if TL_UTF8_USE_SSE2 || TL_UTF8_USE_NEON
+      WidenASCIIBlock(
+          data + i, reinterpret_cast<UnsignedUnit<UnitT>*>(out + num_written));
+#else
+      WidenASCIIBlock(data + i, out + num_written);
+#endif
+      i += kBlockSize;
+      num_written += kBlockSize;
+      continue;
+    }
+
+    char32_t code_point;
+    const std::size_t length = DecodeCodePoint(data + i, size - i, code_point);
+    if (length == 0) {
+      return {num_written, std::errc::illegal_byte_sequence};
+    }
+
+    if constexpr (sizeof(UnitT) == 2) {
+      if (code_point >= 0x10000) {
+        if (out_size - num_written < 2) {
+          return {num_written, std::errc::value_too_large};
+        }
+        const char32_t v = code_point - 0x10000;
+        out[num_written++] = UnitT(0xd800 + (v >> 10));
+        out[num_written++] = UnitT(0xdc00 + (v & 0x3ff));
+        i += length;
+        continue;
+      }
+    }
+
+    if (num_written == out_size) {
+      return {num_written, std::errc::value_too_large};
+    }
+    out[num_written++] = UnitT(code_point);
+    i += length;
+  }
+
+  return {num_written, std::errc()};
+}
+
+// Get the number of code units needed to store the UTF-8 string in the
+// encoding with units of the given size, or -1 if the string is not valid.
+template <std::size_t kUnitSize>
+auto GetConvertedLength(const std::string_view src) -> std::size_t {
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(src.data());
+  const std::size_t size = src.size();
+
+  std::size_t i = 0;
+  std::size_t length = 0;
+  while (i < size) {
+    if (i + kBlockSize <= size && IsASCIIBlock(data + i)) {
+      i += kBlockSize;
+      length += kBlockSize;
+      continue;
+    }
+
+    char32_t code_point;
+    const std::size_t num_bytes =
+        DecodeCodePoint(data + i, size - i, code_point);
+    if (num_bytes == 0) {
+      return std::size_t(-1);
+    }
+    i += num_bytes;
+    length += (kUnitSize == 2 && code_point >= 0x10000) ? 2 : 1;
+  }
+
+  return length;
+}
+
+}  // namespace internal
+
+// Get index of the first byte of the string which is not a part of a
+// well-formed UTF-8 sequence, or std::string_view::npos if the entire string is
+// valid.
+inline auto FindInvalidUTF8(const std::string_view str) -> std::size_t {
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(str.data());
+  const std::size_t size = str.size();
+
+  std::size_t i = 0;
+  while (i < size) {
+    if (i + internal::kBlockSize <= size && internal::IsASCIIBlock(data + i)) {
+      i += internal::kBlockSize;
+      continue;
+    }
+
+    char32_t code_point;
+    const std::size_t length =
+        internal::DecodeCodePoint(data + i, size - i, code_point);
+    if (length == 0) {
+      return i;
+    }
+    i += length;
+  }
+
+  return std::string_view::npos;
+}
+
+// Check whether the string is a well-formed UTF-8.
+inline auto IsValidUTF8(const std::string_view str) -> bool {
+  return FindInvalidUTF8(str) == std::string_view::npos;
+}
+
+// Get the number of UTF-16 or UTF-32 code units needed to store the converted
+// UTF-8 string.
+//
+// Returns std::string_view::npos if the string is not a valid UTF-8.
+inline auto GetUTF16Length(const std::string_view utf8) -> std::size_t {
+  return internal::GetConvertedLength<2>(utf8);
+}
+inline auto GetUTF32Length(const std::string_view utf8) -> std::size_t {
+  return internal::GetConvertedLength<4>(utf8);
+}
+
+// Convert UTF-8 string to UTF-16 or UTF-32, writing code units to the given
+// destination.
+inline auto ConvertUTF8ToUTF16(const std::string_view src,
+                               const std::span<char16_t> dst)
+    -> TranscodeResult {
+  return internal::Convert(src, dst);
+}
+inline auto ConvertUTF8ToUTF32(const std::string_view src,
+                               const std::span<char32_t> dst)
+    -> TranscodeResult {
+  return internal::Convert(src, dst);
+}
+
+// Convert UTF-8 string to the platform's wide character encoding: UTF-16 when
+// the wchar_t is 16 bit (Windows), and UTF-32 otherwise.
+inline auto ConvertUTF8ToWide(const std::string_view src,
+                              const std::span<wchar_t> dst)
+    -> TranscodeResult {
+  return internal::Convert(src, dst);
+}
+
+// Replace content of the string with the given UTF-8 string converted to the
+// encoding of the string character type: UTF-16 for char16_t, UTF-32 for
+// char32_t, and the platform's wide encoding for wchar_t.
+//
+// The StringType is to provide value_type, max_size(), resize(), and data().
+//
+// Returns false and keeps the string unchanged if the src is not a valid UTF-8
+// or if the converted string does not fit into the string.
+template <class StringType>
+auto AssignFromUTF8(StringType& dst, const std::string_view src) -> bool {
+  using CharT = typename StringType::value_type;
+  static_assert(sizeof(CharT) == 2 || sizeof(CharT) == 4);
+
+  const std::size_t length = internal::GetConvertedLength<sizeof(CharT)>(src);
+  if (length == std::size_t(-1) || length > dst.max_size()) {
+    return false;
+  }
+
+  dst.resize(length);
+  internal::Convert(src, std::span<CharT>(dst.data(), length));
+
+  return true;
+}
+
+}  // namespace TL_UTF8_VERSION_NAMESPACE
+}  // namespace TL_UTF8_NAMESPACE
+
+#undef TL_UTF8_VERSION_MAJOR
+#undef TL_UTF8_VERSION_MINOR
+#undef TL_UTF8_VERSION_REVISION
+
+#undef TL_UTF8_VERSION_NAMESPACE
+
+#undef TL_UTF8_VERSION_NAMESPACE_CONCAT_HELPER
+#undef TL_UTF8_VERSION_NAMESPACE_CONCAT
+#undef TL_UTF8_NAMESPACE
+
+#undef TL_UTF8_USE_SSE2
+#undef TL_UTF8_USE_NEON